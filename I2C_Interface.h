@@ -170,7 +170,7 @@ typedef struct
 #define I2C_INTERFACE8_CHECK_DMA_DESC(chipAddr,transactionNumber)                                                            \
   {                                                                                                                          \
     I2C_MEMBER(Config.Value) I2C_USE_NON_BLOCKING | I2C_USE_8bits_ADDRESS | I2C_ENDIAN_TRANSFORM_SET(I2C_NO_ENDIAN_CHANGE)   \
-                           | I2C_TRANSFER_TYPE_SET(I2C_SIMPLE_TRANSFER) | I2C_TRANSACTION_NUMBER_SET(CurrTransactionNumber), \
+                           | I2C_TRANSFER_TYPE_SET(I2C_SIMPLE_TRANSFER) | I2C_TRANSACTION_NUMBER_SET(transactionNumber),     \
     I2C_MEMBER(ChipAddr    ) (chipAddr) | I2C_READ_ORMASK,                                                                   \
     I2C_MEMBER(Start       ) true,                                                                                           \
     I2C_MEMBER(pBuffer     ) NULL,                                                                                           \
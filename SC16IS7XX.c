@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    SC16IS7XX.c
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.0.2
- * @date    18/06/2023
+ * @version 1.0.3
+ * @date    15/10/2026
  * @brief   SC16IS740, SC16IS741, SC16IS741A, SC16IS750, SC16IS752, SC16IS760,
  *          SC16IS762 driver
  * @details The SC16IS7XX component is a Single/Double UART with I2C-bus/SPI
@@ -63,20 +63,164 @@ static eERRORRESULT __SC16IS7XX_ReadData(SC16IS7XX *pComp, const eSC16IS7XX_Chan
  * @return Returns an #eERRORRESULT value enum
  */
 static eERRORRESULT __SC16IS7XX_WriteData(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, uint8_t *data, uint8_t size);
+//! Write data of several segments to the SC16IS7XX in one transfer. The position shall be on a data of a segment and the segments shall hold at least size data from this position
+static eERRORRESULT __SC16IS7XX_WriteDataV(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, const SC16IS7XX_TxSegment *segments, size_t segmentIndex, size_t segmentOffset, uint8_t size);
+//! Terminate a transfer whose data phase failed after the address phase: release the chip select (SPI) or send a stop (I2C). The error of the data phase is kept by the caller
+static void __SC16IS7XX_EndFailedTransfer(SC16IS7XX *pComp);
+//! Read a register of the SC16IS7XX. If SC16IS7XX_USE_SHADOW_REGISTERS is defined and the register value is known, the value is taken from the shadow registers without bus access
+static eERRORRESULT __SC16IS7XX_ReadShadowedRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t *registerValue);
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+//! Account a bus transaction in the bus statistics
+static void __SC16IS7XX_CountTransaction(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, size_t size, bool isRead);
+#endif
+#ifdef SC16IS7XX_USE_TRACE
+//! Record a bus access in the trace ring
+static void __SC16IS7XX_TraceAccess(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, const uint8_t *data, size_t size, uint8_t flags);
+#endif
+//! Read a chain of registers of the SC16IS7XX, one transfer per register, with only one interface check
+static eERRORRESULT __SC16IS7XX_ReadRegisterChain(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t *registerAddrs, uint8_t *registerValues, size_t count);
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+//! Follow the LCR value of a channel after a successful read or write of a register
+static void __SC16IS7XX_TrackLCR(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t registerValue, bool isWrite);
+//! Write back the LCR value deferred by a bank session of a channel, if any
+static eERRORRESULT __SC16IS7XX_WritePendingLCR(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel);
+#endif
+#ifdef SC16IS7XX_USE_TX_CREDIT
+//! Follow the Tx FIFO credit of a channel after a successful access of a register
+static void __SC16IS7XX_TrackTxCredit(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, const uint8_t *data, size_t size, bool isRead);
+#endif
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+//! Get the register bank accessed at an address of a SC16IS7XX channel following its shadow LCR, MCR and EFR values
+static eSC16IS7XX_RegisterBank __SC16IS7XX_GetRegisterBank(SC16IS7XX_ShadowRegisters* pShadow, const uint8_t registerAddr);
+//! Update the shadow register after a successful read or write of a register
+static void __SC16IS7XX_UpdateShadowRegister(SC16IS7XX *pComp, eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t registerValue, bool isWrite);
+//! Get a register value from the shadow registers. Returns 'true' if the value is known else 'false'
+static bool __SC16IS7XX_GetShadowRegister(SC16IS7XX *pComp, eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t *registerValue);
+#endif
+#ifdef SC16IS7XX_USE_REGISTER_SCRIPT
+//! Append a register write to the script being recorded
+static void __SC16IS7XX_RecordScriptWrite(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t registerValue);
+#endif
+#ifdef SC16IS7XX_USE_BUS_QUEUE
+//! Remove the first request of the highest priority below priorityCount from the bus queue. Shall be called with the queue locked. Returns NULL if there is no such request
+static SC16IS7XX_BusRequest* __SC16IS7XX_PopBusRequest(SC16IS7XX_BusQueue *pQueue, size_t priorityCount);
+#endif
+#ifdef SC16IS7XX_USE_NON_BLOCKING_TRANSFERS
+//! Start a non-blocking transfer with the SC16IS7XX UART
+static eERRORRESULT __SC16IS7XX_StartNonBlockingTransfer(SC16IS7XX_UART *pUART, const uint8_t address, uint8_t *data, size_t size, bool isRead);
+#endif
 //-----------------------------------------------------------------------------
+// DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! The UART channel and the buffers are checked in the SC16IS7XX_InitUART() function
+static eERRORRESULT __SC16IS7XX_ConfigureUART(SC16IS7XX_UART *pUART, const SC16IS7XX_UARTconfig *pUARTConf);
 // DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! Control Flow needs to be configured with a safe UART configuration to avoid spurious effects, which is done in the SC16IS7XX_InitUART() function
 static eERRORRESULT __SC16IS7XX_SetControlFlowConfiguration(SC16IS7XX_UART *pUART, SC16IS7XX_HardControlFlow *pHardFlow, SC16IS7XX_SoftControlFlow *pSoftFlow, const uint8_t* pSpecialChar, bool useAdressChar);
 // DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! UART configuration needs to be configured with a safe UART configuration to avoid spurious effects, which is done in the SC16IS7XX_InitUART() function
 static eERRORRESULT __SC16IS7XX_SetUARTConfiguration(SC16IS7XX_UART *pUART, const SC16IS7XX_UARTconfig *pUARTConf);
 // DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! UART configuration needs to be configured with a safe UART configuration to avoid spurious effects, which is done in the SC16IS7XX_InitUART() function
 static eERRORRESULT __SC16IS7XX_ConfigureFIFOs(SC16IS7XX_UART *pUART, bool useFIFOs, eSC16IS7XX_IntTxTriggerLevel txTrigLvl, eSC16IS7XX_IntRxTriggerLevel rxTrigLvl);
+//! Check the timeout and sleep the time of charCount chars before polling again the UART in a blocking function
+static eERRORRESULT __SC16IS7XX_WaitBeforePoll(SC16IS7XX_UART *pUART, uint32_t startTime, uint32_t charCount);
+//! Move a position in segments by count data. The position is then on a data of a segment, or at segmentCount if there is no more data
+static void __SC16IS7XX_AdvanceSegments(const SC16IS7XX_TxSegment *segments, size_t segmentCount, size_t *segmentIndex, size_t *segmentOffset, size_t count);
 //-----------------------------------------------------------------------------
 #ifdef SC16IS7XX_USE_BUFFERS
-//! Transfer available data from Rx buffer of the UART
-static void __SC16IS7XX_RxBufferToDataBuff(SC16IS7XX_Buffer* const pBuf, uint8_t *data, size_t *size, size_t *actuallyReceived);
+//! Get the count of data stored in a buffer of the UART
+static size_t __SC16IS7XX_GetBufferDataCount(SC16IS7XX_Buffer* const pBuf);
+//! Get the count of free space in a buffer of the UART up to the end of the buffer or the out position. Producer side only
+static size_t __SC16IS7XX_GetBufferContiguousSpace(SC16IS7XX_Buffer* const pBuf);
+//! Get the count of data in a buffer of the UART up to the end of the buffer or the in position. Consumer side only
+static size_t __SC16IS7XX_GetBufferContiguousData(SC16IS7XX_Buffer* const pBuf);
+//! Publish data added to a buffer of the UART by moving its in position. Producer side only
+static void __SC16IS7XX_AdvanceBufferIn(SC16IS7XX_Buffer* const pBuf, size_t count);
+//! Release data removed from a buffer of the UART by moving its out position. Consumer side only
+static void __SC16IS7XX_AdvanceBufferOut(SC16IS7XX_Buffer* const pBuf, size_t count);
+//! Find the first delimiter in a data array. Returns NULL if not found
+static const uint8_t* __SC16IS7XX_FindDelimiter(const uint8_t *data, size_t size, const char *delimiterSet, const uint8_t *delimiterMap);
+//! Transfer data to the Tx buffer of the UART, in two parts if the data wrap at the end of the buffer. Returns the count of data transferred
+static size_t __SC16IS7XX_DataBuffToTxBuffer(SC16IS7XX_Buffer* const pBuf, const uint8_t *data, size_t size);
+//! Transfer available data from Rx buffer of the UART, in two parts if the data wrap at the end of the buffer. Returns the count of data transferred
+static size_t __SC16IS7XX_RxBufferToDataBuff(SC16IS7XX_Buffer* const pBuf, uint8_t *data, size_t size);
+//! Move data from the Rx FIFO of the UART to its Rx buffer, with one burst per contiguous part of the buffer
+static eERRORRESULT __SC16IS7XX_RxFIFOtoRxBuffer(SC16IS7XX_UART *pUART, size_t count);
+//! Move data from the Rx FIFO of the UART to its Rx buffer one char at a time with the LSR check of each char (isSafeRX), or only while an error is in the Rx FIFO (hybrid)
+static eERRORRESULT __SC16IS7XX_RxFIFOtoRxBufferChecked(SC16IS7XX_UART *pUART, size_t count, bool isSafeRX);
+//! Enable again the Rx interrupts masked by SC16IS7XX_ServiceInterrupt() while the Rx buffer was full, if there is space in the Rx buffer now
+static eERRORRESULT __SC16IS7XX_UnmaskRxInterrupts(SC16IS7XX_UART *pUART);
+//! Enable again the THR interrupt masked by SC16IS7XX_ServiceInterrupt() while the Tx buffer was empty, if there is data in the Tx buffer now
+static eERRORRESULT __SC16IS7XX_UnmaskTxInterrupt(SC16IS7XX_UART *pUART);
+//! Move data from the Tx buffer of the UART to its Tx FIFO, with one burst per contiguous part of the buffer
+static eERRORRESULT __SC16IS7XX_TxBufferToTxFIFO(SC16IS7XX_UART *pUART, size_t space);
+//! Transfer data of segments to the Tx buffer of the UART while there is space. The position in the segments is moved by the count of data transferred
+static void __SC16IS7XX_SegmentsToTxBuffer(SC16IS7XX_Buffer* const pBuf, const SC16IS7XX_TxSegment *segments, size_t segmentCount, size_t *segmentIndex, size_t *segmentOffset);
+
+//! Formatted output state of SC16IS7XX_VPrintf(). The chars are written in the Tx buffer of the UART and published by packets
+typedef struct SC16IS7XX_PrintfWriter
+{
+  SC16IS7XX_UART* pUART; //!< UART where the chars are sent
+  size_t PosIn;          //!< In position of the next char to write in the Tx buffer
+  size_t Pending;        //!< Count of chars written in the Tx buffer but not published yet
+  size_t Space;          //!< Free space in the Tx buffer after the pending chars
+  uint32_t StartTime;    //!< Start time of the timeout
+  eERRORRESULT Error;    //!< First error of the output. The next chars are discarded after an error
+} SC16IS7XX_PrintfWriter;
+
+//! Write a char of a formatted output in the Tx buffer of the UART
+static void __SC16IS7XX_PrintfChar(SC16IS7XX_PrintfWriter* pWriter, char aChar);
+//! Write a padded field (prefix, leading zeros then data) of a formatted output in the Tx buffer of the UART
+static void __SC16IS7XX_PrintfField(SC16IS7XX_PrintfWriter* pWriter, const char* prefix, size_t prefixLen, size_t zeroCount, const char* data, size_t dataLen, size_t width, bool leftAlign);
+//! Convert an unsigned value to digits, written backward from pEnd. Returns the pointer to the first digit
+static char* __SC16IS7XX_PrintfUintToStr(char* pEnd, unsigned long long value, unsigned int base, bool upperCase);
+//! Publish the pending chars of a formatted output and send the Tx buffer to the Tx FIFO. If waitRoom is true, wait until there is space in the Tx buffer
+static void __SC16IS7XX_PrintfFlush(SC16IS7XX_PrintfWriter* pWriter, bool waitRoom);
+# ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+//! Add a timestamp for a Rx FIFO burst stored in the Rx buffer of the UART
+static void __SC16IS7XX_AddRxTimestamp(SC16IS7XX_UART *pUART, size_t count, uint32_t timems);
+//! Account data consumed from the Rx buffer of the UART and release the timestamps of the bursts fully consumed
+static void __SC16IS7XX_ReleaseRxTimestamps(SC16IS7XX_UART *pUART, size_t count);
+# endif
+# ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+//! Account a service of SC16IS7XX_ServiceInterrupt() and adjust the trigger levels at the end of each window
+static eERRORRESULT __SC16IS7XX_TriggerControlService(SC16IS7XX_UART *pUART);
+# endif
 #endif
 //-----------------------------------------------------------------------------
 #define SC16IS7XX_ABSOLUTE(value)  ( (value) < 0.0f ? -(value) : value )
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+#  define SC16IS7XX_BUFFER_INDEX(pBuf,pos)  ( (pos) & ((pBuf)->BufferSize - 1) ) // Positions are free-running, the index is the position modulo the power of two size
+#  define SC16IS7XX_BUFFER_CAPACITY(pBuf)   ( (pBuf)->BufferSize )                // The data count is PosIn - PosOut, the buffer can be completely filled
+#else
+#  define SC16IS7XX_BUFFER_INDEX(pBuf,pos)  ( pos )                               // Positions are wrapped at each increment
+#  define SC16IS7XX_BUFFER_CAPACITY(pBuf)   ( (pBuf)->BufferSize - 1 )            // One byte is always left free to tell a full buffer from an empty one
+#endif
+#define SC16IS7XX_TRIGGER_LEVEL_STEP  ( 4u ) // The TLR trigger levels have a granularity of 4 chars
+#if defined(SC16IS7XX_USE_BUFFERS) && defined(SC16IS7XX_USE_ADAPTIVE_TRIGGER)
+#  define SC16IS7XX_KEEP_TLR_ACCESS(pUART)  ( (pUART)->pTriggerControl != NULL ) // TCR and TLR access (MCR[2]) stays enabled while the trigger levels are adaptive
+#else
+#  define SC16IS7XX_KEEP_TLR_ACCESS(pUART)  ( false )
+#endif
+#define SC16IS7XX_TIME_DIFF(begin,end)  ( ((end) >= (begin)) ? ((end) - (begin)) : (UINT32_MAX - ((begin) - (end) - 1)) ) // Works only if time difference is strictly inferior to (UINT32_MAX/2) and call often
+//-----------------------------------------------------------------------------
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+#  define SC16IS7XX_SHADOW_REG_MASK(registerAddr)  ( (uint16_t)(1u << (registerAddr)) )
+
+//! Registers whose read value can be stored in the shadow registers (one bit per register address). Volatile registers (RHR, IIR, LSR, MSR, TXLVL, RXLVL, IOState) are never stored
+static const uint16_t SC16IS7XX_SHADOW_READ_MASK[SC16IS7XX_BANK_COUNT] =
+{
+  0xD49A, // General register set: IER, LCR, MCR, SPR, IODir, IOIntEna, IOControl, EFCR
+  0x00C0, // TCR and TLR
+  0x0003, // Special register set: DLL, DLH
+  0x00F4, // Enhanced register set: EFR, XON1, XON2, XOFF1, XOFF2
+};
+
+//! Registers whose written value can be stored in the shadow registers (one bit per register address). Same as the read mask plus the write only FCR register
+static const uint16_t SC16IS7XX_SHADOW_WRITE_MASK[SC16IS7XX_BANK_COUNT] =
+{
+  0xD49E, // General register set: IER, FCR, LCR, MCR, SPR, IODir, IOIntEna, IOControl, EFCR
+  0x00C0, // TCR and TLR
+  0x0003, // Special register set: DLL, DLH
+  0x00F4, // Enhanced register set: EFR, XON1, XON2, XOFF1, XOFF2
+};
+#endif
 //-----------------------------------------------------------------------------
 
 
@@ -113,6 +257,16 @@ eERRORRESULT Init_SC16IS7XX(SC16IS7XX *pComp, const SC16IS7XX_Config *pConf)
   if ((pComp->OscFreq  != 0) && (pComp->OscFreq  > SC16IS7XX_OSC_FREQ_MAX )) return ERR__FREQUENCY_ERROR; // The device oscillator should not be > 80MHz
   if ((pComp->XtalFreq == 0) && (pComp->OscFreq  == 0)) return ERR__CONFIGURATION;                        // Both XtalFreq and OscFreq are configured to 0
 
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+  memset(&pComp->Statistics, 0, sizeof(SC16IS7XX_BusStatistics));          // Reset the bus statistics
+#endif
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  memset(&pComp->BankState[0], 0, sizeof(pComp->BankState));               // No LCR value known and no bank session in progress
+#endif
+#ifdef SC16IS7XX_USE_TX_CREDIT
+  memset(&pComp->TxFIFOcredit[0], 0, sizeof(pComp->TxFIFOcredit));         // No Tx FIFO space known, the first transmit will read TXLVL
+#endif
+
   //--- Configure the Interface -----------------------------
 #ifdef SC16IS7XX_I2C_DEFINED
   if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
@@ -173,6 +327,12 @@ eERRORRESULT SC16IS7XX_SoftResetDevice(SC16IS7XX *pComp)
 {
   eERRORRESULT Error;
   Error = SC16IS7XX_WriteRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IOControl, SC16IS7XX_IOCTRL_SOFTWARE_RESET); // Write the IOControl register
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+  SC16IS7XX_InvalidateShadowRegisters(pComp);                            // All registers are back to their default values
+#endif
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  SC16IS7XX_InvalidateBankState(pComp);                                  // The LCR of all channels are back to their default values
+#endif
   if (Error == ERR__I2C_NACK_DATA) return ERR_OK;                        // Device returns NACK on I2C-bus when set bit "UART software reset" is written
   return Error;
 }
@@ -232,6 +392,31 @@ bool SC16IS7XX_IsReady(SC16IS7XX *pComp)
 
 
 
+//=============================================================================
+// [STATIC] Terminate a transfer whose data phase failed
+//=============================================================================
+void __SC16IS7XX_EndFailedTransfer(SC16IS7XX *pComp)
+{
+#ifdef SC16IS7XX_I2C_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
+  {
+    I2C_Interface* pI2C = GET_I2C_INTERFACE;
+    I2CInterface_Packet StopPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(pComp->I2Caddress, false, NULL, 0, true, I2C_SIMPLE_TRANSFER);
+    (void)pI2C->fnI2C_Transfer(pI2C, &StopPacketDesc);            // Send only a stop to free the bus
+  }
+#endif
+#ifdef SC16IS7XX_SPI_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_SPI)
+  {
+    SPI_Interface* pSPI = GET_SPI_INTERFACE;
+    SPIInterface_Packet EndPacketDesc = SPI_INTERFACE_TX_DATA_DESC(NULL, 0, true);
+    (void)pSPI->fnSPI_Transfer(pSPI, &EndPacketDesc);             // Transfer no data and release the chip select
+  }
+#endif
+}
+
+
+
 //=============================================================================
 // [STATIC] Read data from the SC16IS7XX
 //=============================================================================
@@ -243,6 +428,10 @@ eERRORRESULT __SC16IS7XX_ReadData(SC16IS7XX *pComp, const eSC16IS7XX_Channel cha
   if (size == 0) return ERR_OK;
   eERRORRESULT Error = ERR_OK;
   uint8_t Address = SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(address);
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  Error = __SC16IS7XX_WritePendingLCR(pComp, channel);                     // Write back a deferred LCR before accessing the register
+  if (Error != ERR_OK) return Error;                                       // If there is an error while calling __SC16IS7XX_WritePendingLCR() then return the error
+#endif
 
 #ifdef SC16IS7XX_I2C_DEFINED
   if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
@@ -265,6 +454,7 @@ eERRORRESULT __SC16IS7XX_ReadData(SC16IS7XX *pComp, const eSC16IS7XX_Channel cha
     //--- Get the data ---
     I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_RX_DATA_DESC(ChipAddrR, true, data, size, true, I2C_WRITE_THEN_READ_SECOND_PART);
     Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc); // Restart at first data read transfer, get the data and stop transfer at last byte
+    if (Error != ERR_OK) __SC16IS7XX_EndFailedTransfer(pComp); // The stop may not have been sent, free the bus
   }
 #endif
 #ifdef SC16IS7XX_SPI_DEFINED
@@ -279,14 +469,39 @@ eERRORRESULT __SC16IS7XX_ReadData(SC16IS7XX *pComp, const eSC16IS7XX_Channel cha
 # endif
     Address |= SC16IS7XX_SPI_READ;
 
-    //--- Send the address ---
-    SPIInterface_Packet AddrPacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Address, sizeof(uint8_t), false);      // Prepare SPI packet description to use
-    Error = pSPI->fnSPI_Transfer(pSPI, &AddrPacketDesc);                                                    // Transfer the address
-    if (Error != ERR_OK) return Error;                                                                      // If there is an error while calling fnSPI_Transfer() then return the Error
-    //--- Get the data ---
-    SPIInterface_Packet DataPacketDesc = SPI_INTERFACE_RX_DATA_WITH_DUMMYBYTE_DESC(0x00, data, size, true); // Prepare SPI packet description to use
-    Error = pSPI->fnSPI_Transfer(pSPI, &DataPacketDesc);                                                    // Get the data and stop transfer at last byte
+#ifdef SC16IS7XX_USE_SPI_SINGLE_PACKET
+    if (size < SC16IS7XX_SPI_SCRATCH_BUFFER_SIZE)
+    {
+      //--- Send the address and get the data in one transfer ---
+      uint8_t Buffer[SC16IS7XX_SPI_SCRATCH_BUFFER_SIZE];
+      Buffer[0] = Address;
+      memset(&Buffer[1], 0x00, size);                                                                        // Dummy bytes to send while receiving the data
+      SPIInterface_Packet PacketDesc = SPI_INTERFACE_RX_DATA_DESC(&Buffer[0], (size + 1), true);             // Prepare SPI packet description to use
+      Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);                                                       // Transfer the address, get the data and stop transfer at last byte
+      if (Error == ERR_OK) memcpy(data, &Buffer[1], size);                                                   // Copy received data
+    }
+    else
+#endif
+    {
+      //--- Send the address ---
+      SPIInterface_Packet AddrPacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Address, sizeof(uint8_t), false);      // Prepare SPI packet description to use
+      Error = pSPI->fnSPI_Transfer(pSPI, &AddrPacketDesc);                                                    // Transfer the address
+      if (Error != ERR_OK) return Error;                                                                      // If there is an error while calling fnSPI_Transfer() then return the Error
+      //--- Get the data ---
+      SPIInterface_Packet DataPacketDesc = SPI_INTERFACE_RX_DATA_WITH_DUMMYBYTE_DESC(0x00, data, size, true); // Prepare SPI packet description to use
+      Error = pSPI->fnSPI_Transfer(pSPI, &DataPacketDesc);                                                    // Get the data and stop transfer at last byte
+      if (Error != ERR_OK) __SC16IS7XX_EndFailedTransfer(pComp);                                              // The chip select may still be asserted, release it
+    }
   }
+#endif
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+  if (Error == ERR_OK) __SC16IS7XX_CountTransaction(pComp, channel, address, size, true);                     // Account the transaction
+#endif
+#ifdef SC16IS7XX_USE_TRACE
+  if ((Error == ERR_OK) && (pComp->pTrace != NULL)) __SC16IS7XX_TraceAccess(pComp, channel, address, data, size, SC16IS7XX_TRACE_READ); // Record the access
+#endif
+#ifdef SC16IS7XX_USE_TX_CREDIT
+  if (Error == ERR_OK) __SC16IS7XX_TrackTxCredit(pComp, channel, address, data, size, true);                  // Keep the Tx FIFO credit up to date
 #endif
   return Error;
 }
@@ -298,7 +513,18 @@ eERRORRESULT __SC16IS7XX_ReadData(SC16IS7XX *pComp, const eSC16IS7XX_Channel cha
 //=============================================================================
 inline eERRORRESULT SC16IS7XX_ReadRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t *registerValue)
 {
+#if defined(SC16IS7XX_USE_SHADOW_REGISTERS) || defined(SC16IS7XX_USE_BANK_TRACKING)
+  eERRORRESULT Error = __SC16IS7XX_ReadData(pComp, channel, registerAddr, registerValue, 1);
+# ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+  if (Error == ERR_OK) __SC16IS7XX_UpdateShadowRegister(pComp, channel, registerAddr, *registerValue, false); // Keep the shadow register up to date
+# endif
+# ifdef SC16IS7XX_USE_BANK_TRACKING
+  if (Error == ERR_OK) __SC16IS7XX_TrackLCR(pComp, channel, registerAddr, *registerValue, false);             // Keep the LCR value up to date
+# endif
+  return Error;
+#else
   return __SC16IS7XX_ReadData(pComp, channel, registerAddr, registerValue, 1);
+#endif
 }
 
 
@@ -314,6 +540,13 @@ eERRORRESULT __SC16IS7XX_WriteData(SC16IS7XX *pComp, const eSC16IS7XX_Channel ch
   if (size == 0) return ERR_OK;
   eERRORRESULT Error = ERR_OK;
   uint8_t Address = SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(address) | SC16IS7XX_SPI_WRITE;
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  if (address != RegSC16IS7XX_LCR)                                         // A LCR write supersedes a deferred LCR
+  {
+    Error = __SC16IS7XX_WritePendingLCR(pComp, channel);                   // Write back a deferred LCR before accessing the register
+    if (Error != ERR_OK) return Error;                                     // If there is an error while calling __SC16IS7XX_WritePendingLCR() then return the error
+  }
+#endif
 
 #ifdef SC16IS7XX_I2C_DEFINED
   if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
@@ -336,6 +569,7 @@ eERRORRESULT __SC16IS7XX_WriteData(SC16IS7XX *pComp, const eSC16IS7XX_Channel ch
     //--- Send the data ---
     I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, false, data, size, true, I2C_WRITE_THEN_WRITE_SECOND_PART);
     Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc);              // Continue by transferring the data, and stop transfer at last byte
+    if (Error != ERR_OK) __SC16IS7XX_EndFailedTransfer(pComp);        // The stop may not have been sent, free the bus
   }
 #endif
 #ifdef SC16IS7XX_SPI_DEFINED
@@ -343,6 +577,97 @@ eERRORRESULT __SC16IS7XX_WriteData(SC16IS7XX *pComp, const eSC16IS7XX_Channel ch
   {
     SPI_Interface* pSPI = GET_SPI_INTERFACE;
 # if defined(CHECK_NULL_PARAM)
+#   if defined(USE_DYNAMIC_INTERFACE)
+    if (pSPI == NULL) return ERR__PARAMETER_ERROR;
+#   endif
+    if (pSPI->fnSPI_Transfer == NULL) return ERR__PARAMETER_ERROR;
+# endif
+#ifdef SC16IS7XX_USE_SPI_SINGLE_PACKET
+    if (size < SC16IS7XX_SPI_SCRATCH_BUFFER_SIZE)
+    {
+      //--- Send the address and the data in one transfer ---
+      uint8_t Buffer[SC16IS7XX_SPI_SCRATCH_BUFFER_SIZE];
+      Buffer[0] = Address;
+      memcpy(&Buffer[1], data, size);                                                                   // Copy data to send after the address
+      SPIInterface_Packet PacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Buffer[0], (size + 1), true);        // Prepare SPI packet description to use
+      Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);                                                  // Transfer the address, send the data and stop transfer at last byte
+    }
+    else
+#endif
+    {
+      //--- Send the address ---
+      SPIInterface_Packet AddrPacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Address, sizeof(uint8_t), false); // Prepare SPI packet description to use
+      Error = pSPI->fnSPI_Transfer(pSPI, &AddrPacketDesc);                                               // Transfer the address
+      if (Error != ERR_OK) return Error;                                                                 // If there is an error while calling fnSPI_Transfer() then return the Error
+      //--- Send the data ---
+      SPIInterface_Packet DataPacketDesc = SPI_INTERFACE_TX_DATA_DESC(data, size, true);                 // Prepare SPI packet description to use
+      Error = pSPI->fnSPI_Transfer(pSPI, &DataPacketDesc);                                               // Send the data and stop transfer at last byte
+      if (Error != ERR_OK) __SC16IS7XX_EndFailedTransfer(pComp);                                         // The chip select may still be asserted, release it
+    }
+  }
+#endif
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+  if (Error == ERR_OK) __SC16IS7XX_CountTransaction(pComp, channel, address, size, false);               // Account the transaction
+#endif
+#ifdef SC16IS7XX_USE_TRACE
+  if ((Error == ERR_OK) && (pComp->pTrace != NULL)) __SC16IS7XX_TraceAccess(pComp, channel, address, data, size, 0); // Record the access
+  if ((Error != ERR_OK) && (address == RegSC16IS7XX_LCR) && (pComp->pTrace != NULL) && (channel < SC16IS7XX_CHANNEL_COUNT))
+    pComp->pTrace->LCRknown &= ~(1u << channel);                                                 // The LCR value of the device is unknown after a failed write
+#endif
+#ifdef SC16IS7XX_USE_TX_CREDIT
+  if (Error == ERR_OK) __SC16IS7XX_TrackTxCredit(pComp, channel, address, data, size, false);                 // Keep the Tx FIFO credit up to date
+#endif
+  return Error;
+}
+
+
+
+//=============================================================================
+// [STATIC] Write data of several segments to the SC16IS7XX
+//=============================================================================
+eERRORRESULT __SC16IS7XX_WriteDataV(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, const SC16IS7XX_TxSegment *segments, size_t segmentIndex, size_t segmentOffset, uint8_t size)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (segments == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  if (size == 0) return ERR_OK;
+  eERRORRESULT Error = ERR_OK;
+  uint8_t Address = SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(address) | SC16IS7XX_SPI_WRITE;
+#ifdef SC16IS7XX_USE_TX_CREDIT
+  const uint8_t* const pFirstData = &segments[segmentIndex].pData[segmentOffset];
+#endif
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  Error = __SC16IS7XX_WritePendingLCR(pComp, channel);                     // Write back a deferred LCR before accessing the register
+  if (Error != ERR_OK) return Error;                                       // If there is an error while calling __SC16IS7XX_WritePendingLCR() then return the error
+#endif
+#ifdef SC16IS7XX_USE_TRACE
+  uint8_t TraceData[SC16IS7XX_TRACE_DATA_SIZE] = { 0 };                    // The trace records the first data of the transfer, which can span several segments
+  size_t TraceDataCount = 0;
+#endif
+
+#ifdef SC16IS7XX_I2C_DEFINED
+  I2C_Interface* pI2C = GET_I2C_INTERFACE;
+  uint8_t ChipAddrW = (pComp->I2Caddress & I2C_WRITE_ANDMASK);
+  if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
+  {
+# if defined(CHECK_NULL_PARAM)
+#   if defined(USE_DYNAMIC_INTERFACE)
+    if (pI2C == NULL) return ERR__PARAMETER_ERROR;
+#   endif
+    if (pI2C->fnI2C_Transfer == NULL) return ERR__PARAMETER_ERROR;
+# endif
+    //--- Send the address ---
+    I2CInterface_Packet AddrPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, true, &Address, sizeof(uint8_t), false, I2C_WRITE_THEN_WRITE_FIRST_PART);
+    Error = pI2C->fnI2C_Transfer(pI2C, &AddrPacketDesc);              // Transfer the address
+    if (Error == ERR__I2C_NACK) return ERR__NOT_READY;                // If the device receive a NAK, then the device is not ready
+    if (Error != ERR_OK) return Error;                                // If there is an error while calling fnI2C_Transfer() then return the Error
+  }
+#endif
+#ifdef SC16IS7XX_SPI_DEFINED
+  SPI_Interface* pSPI = GET_SPI_INTERFACE;
+  if (pComp->Interface == SC16IS7XX_INTERFACE_SPI)
+  {
+# if defined(CHECK_NULL_PARAM)
 #   if defined(USE_DYNAMIC_INTERFACE)
     if (pSPI == NULL) return ERR__PARAMETER_ERROR;
 #   endif
@@ -352,12 +677,56 @@ eERRORRESULT __SC16IS7XX_WriteData(SC16IS7XX *pComp, const eSC16IS7XX_Channel ch
     SPIInterface_Packet AddrPacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Address, sizeof(uint8_t), false); // Prepare SPI packet description to use
     Error = pSPI->fnSPI_Transfer(pSPI, &AddrPacketDesc);                                               // Transfer the address
     if (Error != ERR_OK) return Error;                                                                 // If there is an error while calling fnSPI_Transfer() then return the Error
-    //--- Send the data ---
-    SPIInterface_Packet DataPacketDesc = SPI_INTERFACE_TX_DATA_DESC(data, size, true);                 // Prepare SPI packet description to use
-    Error = pSPI->fnSPI_Transfer(pSPI, &DataPacketDesc);                                               // Send the data and stop transfer at last byte
   }
 #endif
-  return Error;
+
+  //--- Send the data of each segment ---
+  size_t RemainingSize = size;
+  while (RemainingSize > 0)
+  {
+    const SC16IS7XX_TxSegment* pSegment = &segments[segmentIndex];
+    size_t PartSize = pSegment->Size - segmentOffset;
+    if (PartSize > RemainingSize) PartSize = RemainingSize;
+    uint8_t* pPartData = (uint8_t*)&pSegment->pData[segmentOffset];
+    const bool IsLastPart = (PartSize == RemainingSize);
+    ++segmentIndex;
+    segmentOffset = 0;
+    if (PartSize == 0) continue;                                      // Nothing to send in an empty segment
+#ifdef SC16IS7XX_I2C_DEFINED
+    if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
+    {
+      I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, false, pPartData, PartSize, IsLastPart, I2C_WRITE_THEN_WRITE_SECOND_PART);
+      Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc);            // Continue by transferring the data, and stop transfer at last byte of the last part
+      if (Error == ERR__I2C_NACK_DATA) return ERR__I2C_INVALID_ADDRESS; // If the device receive a NAK while transferring data, then this is an invalid address
+    }
+#endif
+#ifdef SC16IS7XX_SPI_DEFINED
+    if (pComp->Interface == SC16IS7XX_INTERFACE_SPI)
+    {
+      SPIInterface_Packet DataPacketDesc = SPI_INTERFACE_TX_DATA_DESC(pPartData, PartSize, IsLastPart); // Prepare SPI packet description to use
+      Error = pSPI->fnSPI_Transfer(pSPI, &DataPacketDesc);                                            // Send the data and stop transfer at last byte of the last part
+    }
+#endif
+    if (Error != ERR_OK)
+    {
+      __SC16IS7XX_EndFailedTransfer(pComp);                           // The chip select may still be asserted or the stop not sent, free the bus
+      return Error;                                                   // If there is an error while calling fnI2C_Transfer() or fnSPI_Transfer() then return the Error
+    }
+#ifdef SC16IS7XX_USE_TRACE
+    for (size_t zData = 0; (zData < PartSize) && (TraceDataCount < SC16IS7XX_TRACE_DATA_SIZE); ++zData) TraceData[TraceDataCount++] = pPartData[zData];
+#endif
+    RemainingSize -= PartSize;
+  }
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+  __SC16IS7XX_CountTransaction(pComp, channel, address, size, false);                                         // Account the transaction
+#endif
+#ifdef SC16IS7XX_USE_TRACE
+  if (pComp->pTrace != NULL) __SC16IS7XX_TraceAccess(pComp, channel, address, &TraceData[0], size, 0);        // Record the access
+#endif
+#ifdef SC16IS7XX_USE_TX_CREDIT
+  __SC16IS7XX_TrackTxCredit(pComp, channel, address, pFirstData, size, false);                                // Keep the Tx FIFO credit up to date
+#endif
+  return ERR_OK;
 }
 
 
@@ -367,7 +736,37 @@ eERRORRESULT __SC16IS7XX_WriteData(SC16IS7XX *pComp, const eSC16IS7XX_Channel ch
 //=============================================================================
 inline eERRORRESULT SC16IS7XX_WriteRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t registerValue)
 {
-  return __SC16IS7XX_WriteData(pComp, channel, registerAddr, &registerValue, 1);
+  eERRORRESULT Error = __SC16IS7XX_WriteData(pComp, channel, registerAddr, &registerValue, 1);
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+  if (Error == ERR_OK) __SC16IS7XX_UpdateShadowRegister(pComp, channel, registerAddr, registerValue, true); // Keep the shadow register up to date
+#endif
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  if (Error == ERR_OK) __SC16IS7XX_TrackLCR(pComp, channel, registerAddr, registerValue, true);             // Keep the LCR value up to date
+#endif
+#ifdef SC16IS7XX_USE_REGISTER_SCRIPT
+  if ((Error == ERR_OK) && (pComp->pRecordScript != NULL)) __SC16IS7XX_RecordScriptWrite(pComp, channel, registerAddr, registerValue); // Record the write in the script
+#endif
+  return Error;
+}
+
+
+
+//=============================================================================
+// [STATIC] Read a register of the SC16IS7XX, from the shadow registers if the value is known
+//=============================================================================
+eERRORRESULT __SC16IS7XX_ReadShadowedRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t *registerValue)
+{
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+# ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (registerValue == NULL)) return ERR__PARAMETER_ERROR;
+# endif
+# ifdef SC16IS7XX_USE_BANK_TRACKING
+  eERRORRESULT Error = __SC16IS7XX_WritePendingLCR(pComp, channel);       // The shadow register bank follows the shadow LCR, write back a deferred LCR before the lookup
+  if (Error != ERR_OK) return Error;                                       // If there is an error while calling __SC16IS7XX_WritePendingLCR() then return the error
+# endif
+  if (__SC16IS7XX_GetShadowRegister(pComp, channel, registerAddr, registerValue)) return ERR_OK; // The register value is known, no need to read it on the bus
+#endif
+  return SC16IS7XX_ReadRegister(pComp, channel, registerAddr, registerValue);
 }
 
 
@@ -379,8 +778,8 @@ eERRORRESULT SC16IS7XX_ModifyRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel
 {
   eERRORRESULT Error;
   uint8_t RegValue;
-  Error = SC16IS7XX_ReadRegister(pComp, channel, registerAddr, &RegValue); // Read the register value
-  if (Error != ERR_OK) return Error;                                       // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+  Error = __SC16IS7XX_ReadShadowedRegister(pComp, channel, registerAddr, &RegValue); // Read the register value
+  if (Error != ERR_OK) return Error;                                                 // If there is an error while calling __SC16IS7XX_ReadShadowedRegister() then return the error
   RegValue &= ~registerMask;                                               // Clear bits to modify
   RegValue |= (registerValue & registerMask);                              // Set the new value
   return SC16IS7XX_WriteRegister(pComp, channel, registerAddr, RegValue);  // Write the value to register
@@ -394,9 +793,31 @@ eERRORRESULT SC16IS7XX_ModifyRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel
 eERRORRESULT SC16IS7XX_SetRegisterAccess(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, eSC16IS7XX_AccessTo setAccessTo, uint8_t *originalLCRregValue)
 {
   eERRORRESULT Error;
-  Error = SC16IS7XX_ReadRegister(pComp, channel, RegSC16IS7XX_LCR, originalLCRregValue); // Read the LCR register
-  if (Error != ERR_OK) return Error;                                                     // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
-  return SC16IS7XX_WriteRegister(pComp, channel, RegSC16IS7XX_LCR, setAccessTo);         // Write the LCR register
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+# ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (originalLCRregValue == NULL)) return ERR__PARAMETER_ERROR;
+# endif
+  if (channel < SC16IS7XX_CHANNEL_COUNT)
+  {
+    SC16IS7XX_BankState* pBank = &pComp->BankState[channel];
+    if (pBank->IsPending)                                                                            // A return to general registers has been deferred by a bank session
+    {
+      pBank->IsPending = false;
+      *originalLCRregValue = pBank->PendingLCR;                                                      // The original LCR is the one that would have been written back
+    }
+    else if (pBank->IsKnown) *originalLCRregValue = pBank->LCR;                                      // The LCR value is known, no need to read it
+    else
+    {
+      Error = __SC16IS7XX_ReadShadowedRegister(pComp, channel, RegSC16IS7XX_LCR, originalLCRregValue); // Read the LCR register
+      if (Error != ERR_OK) return Error;                                                             // If there is an error while calling __SC16IS7XX_ReadShadowedRegister() then return the error
+    }
+    if (pBank->IsKnown && (pBank->LCR == (uint8_t)setAccessTo)) return ERR_OK;                       // The register set is already selected, nothing to write
+    return SC16IS7XX_WriteRegister(pComp, channel, RegSC16IS7XX_LCR, setAccessTo);                   // Write the LCR register
+  }
+#endif
+  Error = __SC16IS7XX_ReadShadowedRegister(pComp, channel, RegSC16IS7XX_LCR, originalLCRregValue); // Read the LCR register
+  if (Error != ERR_OK) return Error;                                                               // If there is an error while calling __SC16IS7XX_ReadShadowedRegister() then return the error
+  return SC16IS7XX_WriteRegister(pComp, channel, RegSC16IS7XX_LCR, setAccessTo);                   // Write the LCR register
 }
 
 
@@ -407,6 +828,26 @@ eERRORRESULT SC16IS7XX_SetRegisterAccess(SC16IS7XX *pComp, const eSC16IS7XX_Chan
 eERRORRESULT SC16IS7XX_ReturnAccessToGeneralRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, uint8_t originalLCRregValue)
 {
   originalLCRregValue &= SC16IS7XX_LCR_VALUE_SET_GENERAL_REGISTER;                       // Force access to general registers
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+# ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__PARAMETER_ERROR;
+# endif
+  if (channel < SC16IS7XX_CHANNEL_COUNT)
+  {
+    SC16IS7XX_BankState* pBank = &pComp->BankState[channel];
+    if (pBank->IsKnown && (pBank->LCR == originalLCRregValue))                           // The LCR already has this value, nothing to write
+    {
+      pBank->IsPending = false;
+      return ERR_OK;
+    }
+    if (pBank->SessionDepth > 0)                                                         // Inside a bank session, defer the write until another register is accessed or the session ends
+    {
+      pBank->PendingLCR = originalLCRregValue;
+      pBank->IsPending  = true;
+      return ERR_OK;
+    }
+  }
+#endif
   return SC16IS7XX_WriteRegister(pComp, channel, RegSC16IS7XX_LCR, originalLCRregValue); // Write the LCR register
 }
 
@@ -415,1257 +856,3537 @@ eERRORRESULT SC16IS7XX_ReturnAccessToGeneralRegister(SC16IS7XX *pComp, const eSC
 
 
 //**********************************************************************************************************************************************************
+#ifdef SC16IS7XX_USE_BANK_TRACKING
 //=============================================================================
-// Enable Enhanced Functions of the SC16IS7XX device
+// [STATIC] Follow the LCR value of a channel after a successful read or write of a register
 //=============================================================================
-eERRORRESULT SC16IS7XX_EnableEnhancedFunctions(SC16IS7XX *pComp, eSC16IS7XX_Channel channel)
+void __SC16IS7XX_TrackLCR(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t registerValue, bool isWrite)
 {
-  eERRORRESULT Error;
-
-  //--- Enable access to enhanced registers ---
-  SC16IS7XX_LCR_Register OriginalLCR;
-  Error = SC16IS7XX_SetRegisterAccess(pComp, channel, SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER, &OriginalLCR.LCR);
-  if (Error != ERR_OK) return Error;                                                // If there is an error while calling SC16IS7XX_SetRegisterAccess() then return the error
-
-  //--- Enable Enhanced Functions ---
-  Error = SC16IS7XX_ModifyRegister(pComp, channel, RegSC16IS7XX_EFR, SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE, SC16IS7XX_EFR_ENHANCED_FUNCTION_Mask);
-  if (Error != ERR_OK) return Error;                                                // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
-
-  //--- Return access to general registers ---
-  return SC16IS7XX_ReturnAccessToGeneralRegister(pComp, channel, OriginalLCR.LCR); // Return access to general registers
+  if ((registerAddr == RegSC16IS7XX_IOControl) && isWrite && ((registerValue & SC16IS7XX_IOCTRL_SOFTWARE_RESET) > 0))
+  {
+    SC16IS7XX_InvalidateBankState(pComp);                                  // A software reset puts the LCR of all channels back to their default values
+    return;
+  }
+  if ((registerAddr != RegSC16IS7XX_LCR) || (channel >= SC16IS7XX_CHANNEL_COUNT)) return;
+  SC16IS7XX_BankState* pBank = &pComp->BankState[channel];
+  pBank->LCR     = registerValue;
+  pBank->IsKnown = true;
+  if (isWrite) pBank->IsPending = false;                                   // The LCR written supersedes a deferred LCR
 }
 
 
 
-
-
-//**********************************************************************************************************************************************************
 //=============================================================================
-// Verify if the SC16IS7XX device has sleep mode enabled
+// [STATIC] Write back the LCR value deferred by a bank session of a channel
 //=============================================================================
-eERRORRESULT SC16IS7XX_IsDeviceInSleepMode(SC16IS7XX *pComp, bool* isSleepModeEnable)
+eERRORRESULT __SC16IS7XX_WritePendingLCR(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel)
 {
-#ifdef CHECK_NULL_PARAM
-  if (isSleepModeEnable == NULL) return ERR__PARAMETER_ERROR;
-#endif
-  eERRORRESULT Error;
-  SC16IS7XX_IER_Register RegIER;
-  Error = SC16IS7XX_ReadRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IER, &RegIER.IER); // Read the IER register
-  if (Error != ERR_OK) return Error;                                                          // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
-  *isSleepModeEnable = ((RegIER.IER & SC16IS7XX_IER_SLEEP_MODE_ENABLE) > 0);
-  return ERR_OK;
+  if (channel >= SC16IS7XX_CHANNEL_COUNT) return ERR_OK;
+  SC16IS7XX_BankState* pBank = &pComp->BankState[channel];
+  if (pBank->IsPending == false) return ERR_OK;                            // Nothing deferred
+  pBank->IsPending = false;
+  return SC16IS7XX_WriteRegister(pComp, channel, RegSC16IS7XX_LCR, pBank->PendingLCR); // Write the LCR register
 }
 
 
 
-
-
-//**********************************************************************************************************************************************************
 //=============================================================================
-// Configure GPIOs of the SC16IS7XX device
+// Begin a bank session on a channel of the SC16IS7XX
 //=============================================================================
-eERRORRESULT SC16IS7XX_ConfigureGPIOs(SC16IS7XX *pComp, uint8_t pinsDirection, uint8_t pinsLevel, uint8_t pinsInterruptEnable)
+eERRORRESULT SC16IS7XX_BeginBankSession(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel)
 {
 #ifdef CHECK_NULL_PARAM
   if (pComp == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  eERRORRESULT Error;
-  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED; // Only if the device have I/O pins
-
-  Error = SC16IS7XX_SetGPIOPinsDirection(pComp, pinsDirection, 0xFF);                  // Write the GPIOs pin direction
-  if (Error != ERR_OK) return Error;                                                   // If there is an error while calling SC16IS7XX_SetGPIOPinsDirection() then return the error
-  Error = SC16IS7XX_SetGPIOPinsOutputLevel(pComp, pinsLevel, 0xFF);                    // Write the GPIOs output level
-  if (Error != ERR_OK) return Error;                                                   // If there is an error while calling SC16IS7XX_SetGPIOPinsOutputLevel() then return the error
-  return SC16IS7XX_SetGPIOPinsInterruptEnable(pComp, pinsInterruptEnable, 0xFF);       // Write the pin interrupt enable
+  if (channel >= SC16IS7XX_CHANNEL_COUNT) return ERR__UNKNOWN_ELEMENT;
+  SC16IS7XX_BankState* pBank = &pComp->BankState[channel];
+  if (pBank->SessionDepth == UINT8_MAX) return ERR__OUT_OF_RANGE;          // Too many nested sessions
+  pBank->SessionDepth++;
+  return ERR_OK;
 }
 
 
+
 //=============================================================================
-// Set I/O pins direction of the SC16IS7XX
+// End a bank session on a channel of the SC16IS7XX
 //=============================================================================
-eERRORRESULT SC16IS7XX_SetGPIOPinsDirection(SC16IS7XX *pComp, const uint8_t pinsDirection, const uint8_t pinsChangeMask)
+eERRORRESULT SC16IS7XX_EndBankSession(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel)
 {
 #ifdef CHECK_NULL_PARAM
   if (pComp == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED; // Only if the device have I/O pins
-  pComp->GPIOsOutDir &= ~pinsChangeMask;                                               // Force change bits to 0
-  pComp->GPIOsOutDir |= (~pinsDirection & pinsChangeMask);                             // Apply new direction only on changed pins. Invert pin direction to fit GPIO_Interface logic
-  return SC16IS7XX_WriteRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IODir, pComp->GPIOsOutDir);
+  if (channel >= SC16IS7XX_CHANNEL_COUNT) return ERR__UNKNOWN_ELEMENT;
+  SC16IS7XX_BankState* pBank = &pComp->BankState[channel];
+  if (pBank->SessionDepth == 0) return ERR__OUT_OF_RANGE;                  // No session in progress
+  pBank->SessionDepth--;
+  if (pBank->SessionDepth > 0) return ERR_OK;                              // Still inside an outer session
+  return __SC16IS7XX_WritePendingLCR(pComp, channel);                      // Restore the general registers access once at the end of the outermost session
 }
 
 
+
 //=============================================================================
-// Get I/O pins input level of the SC16IS7XX
+// Invalidate the register bank state of all channels of the SC16IS7XX
 //=============================================================================
-eERRORRESULT SC16IS7XX_GetGPIOPinsInputLevel(SC16IS7XX *pComp, uint8_t *pinsState)
+void SC16IS7XX_InvalidateBankState(SC16IS7XX *pComp)
 {
 #ifdef CHECK_NULL_PARAM
-  if ((pComp == NULL) || (pinsState == NULL)) return ERR__PARAMETER_ERROR;
+  if (pComp == NULL) return;
 #endif
-  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED;         // Only if the device have I/O pins
-  return SC16IS7XX_ReadRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IOState, pinsState); // Read the IOState register
+  for (size_t zChannel = 0; zChannel < SC16IS7XX_CHANNEL_COUNT; ++zChannel)
+  {
+    pComp->BankState[zChannel].IsKnown   = false;
+    pComp->BankState[zChannel].IsPending = false;
+  }
 }
+#endif
 
 
+
+
+
+//**********************************************************************************************************************************************************
+#ifdef SC16IS7XX_USE_TX_CREDIT
 //=============================================================================
-// Set I/O pins output level of the SC16IS7XX
+// [STATIC] Follow the Tx FIFO credit of a channel after a successful access of a register
 //=============================================================================
-eERRORRESULT SC16IS7XX_SetGPIOPinsOutputLevel(SC16IS7XX *pComp, const uint8_t pinsLevel, const uint8_t pinsChangeMask)
+void __SC16IS7XX_TrackTxCredit(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, const uint8_t *data, size_t size, bool isRead)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__PARAMETER_ERROR;
-#endif
-  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED;                     // Only if the device have I/O pins
-  pComp->GPIOsOutLevel &= ~pinsChangeMask;                                                                 // Force change bits to 0
-  pComp->GPIOsOutLevel |= (pinsLevel & pinsChangeMask);                                                    // Apply new output level only on changed pins
-  return SC16IS7XX_WriteRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IOState, pComp->GPIOsOutLevel); // Write the IOState register
+  if ((channel >= SC16IS7XX_CHANNEL_COUNT) || (size == 0)) return;
+  uint8_t* pCredit = &pComp->TxFIFOcredit[channel];
+  if (isRead)
+  {
+    if (address == RegSC16IS7XX_TXLVL) *pCredit = data[size - 1];          // The last TXLVL value read is the new credit
+  }
+  else if (address == RegSC16IS7XX_THR)                                    // A write at this address can also be a DLL write, the credit is then only more pessimistic
+  {
+    *pCredit = (size >= (size_t)*pCredit ? 0 : (uint8_t)(*pCredit - size)); // Each byte written consumes one credit
+  }
 }
+#endif
 
-//-----------------------------------------------------------------------------
 
 
 
-#ifdef USE_GENERICS_DEFINED
 
+//**********************************************************************************************************************************************************
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
 //=============================================================================
-// Set PORT direction of the SC16IS7XX device
+// [STATIC] Get the register bank accessed at an address of a SC16IS7XX channel
 //=============================================================================
-eERRORRESULT SC16IS7XX_SetPORTdirection_Gen(PORT_Interface *pIntDev, const uint32_t pinsDirection)
+eSC16IS7XX_RegisterBank __SC16IS7XX_GetRegisterBank(SC16IS7XX_ShadowRegisters* pShadow, const uint8_t registerAddr)
+{
+  if (registerAddr == RegSC16IS7XX_LCR) return SC16IS7XX_BANK_GENERAL;    // The LCR register is accessible whatever the register set selected
+  if ((pShadow->Valid[SC16IS7XX_BANK_GENERAL] & SC16IS7XX_SHADOW_REG_MASK(RegSC16IS7XX_LCR)) == 0) return SC16IS7XX_BANK_UNKNOWN; // Without the LCR value, the register set is unknown
+  const uint8_t RegLCR = pShadow->Value[SC16IS7XX_BANK_GENERAL][RegSC16IS7XX_LCR];
+
+  //--- Enhanced register set ---
+  if (RegLCR == SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER)
+    return ((SC16IS7XX_SHADOW_WRITE_MASK[SC16IS7XX_BANK_ENHANCED] & SC16IS7XX_SHADOW_REG_MASK(registerAddr)) > 0 ? SC16IS7XX_BANK_ENHANCED : SC16IS7XX_BANK_UNKNOWN);
+  //--- Special register set ---
+  if ((RegLCR & SC16IS7XX_LCR_DIVISOR_LATCH_ENABLE) > 0)
+    return (registerAddr <= RegSC16IS7XX_DLH ? SC16IS7XX_BANK_SPECIAL : SC16IS7XX_BANK_UNKNOWN);
+  //--- TCR and TLR registers ---
+  if ((registerAddr == RegSC16IS7XX_TCR) || (registerAddr == RegSC16IS7XX_TLR))
+  {
+    if ((pShadow->Valid[SC16IS7XX_BANK_GENERAL ] & SC16IS7XX_SHADOW_REG_MASK(RegSC16IS7XX_MCR)) == 0) return SC16IS7XX_BANK_UNKNOWN; // Without the MCR value, TCR/TLR access is unknown
+    if ((pShadow->Valid[SC16IS7XX_BANK_ENHANCED] & SC16IS7XX_SHADOW_REG_MASK(RegSC16IS7XX_EFR)) == 0) return SC16IS7XX_BANK_UNKNOWN; // Without the EFR value, TCR/TLR access is unknown
+    if (((pShadow->Value[SC16IS7XX_BANK_GENERAL ][RegSC16IS7XX_MCR] & SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE) > 0)
+     && ((pShadow->Value[SC16IS7XX_BANK_ENHANCED][RegSC16IS7XX_EFR] & SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE   ) > 0)) return SC16IS7XX_BANK_TCR_TLR;
+  }
+  return SC16IS7XX_BANK_GENERAL;
+}
+
+
+
+//=============================================================================
+// [STATIC] Update the shadow register after a successful read or write of a register
+//=============================================================================
+void __SC16IS7XX_UpdateShadowRegister(SC16IS7XX *pComp, eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t registerValue, bool isWrite)
+{
+  if ((registerAddr >= RegSC16IS7XX_IODir) && (registerAddr <= RegSC16IS7XX_IOControl)) channel = SC16IS7XX_CHANNEL_A; // GPIO and IOControl registers are common to both channels
+  if (channel >= SC16IS7XX_CHANNEL_COUNT) return;
+  SC16IS7XX_ShadowRegisters* pShadow = &pComp->Shadow[channel];
+  const eSC16IS7XX_RegisterBank Bank = __SC16IS7XX_GetRegisterBank(pShadow, registerAddr);
+  const uint16_t RegMask = SC16IS7XX_SHADOW_REG_MASK(registerAddr);
+  if (Bank == SC16IS7XX_BANK_UNKNOWN)                                      // Unknown register bank, nothing can be stored
+  {
+    if (isWrite == false) return;                                          // A read does not change the register
+    if ((registerAddr == RegSC16IS7XX_IOControl) && ((registerValue & SC16IS7XX_IOCTRL_SOFTWARE_RESET) > 0))
+    {
+      SC16IS7XX_InvalidateShadowRegisters(pComp);                          // This may be a software reset, all registers may be back to their default values
+      return;
+    }
+    for (size_t zBank = 0; zBank < SC16IS7XX_BANK_COUNT; ++zBank) pShadow->Valid[zBank] &= ~RegMask; // The register written is not known, forget its value in all the banks it could map to
+    return;
+  }
+  if (((isWrite ? SC16IS7XX_SHADOW_WRITE_MASK[Bank] : SC16IS7XX_SHADOW_READ_MASK[Bank]) & RegMask) == 0) return; // Volatile register, nothing to store
+
+  if (Bank == SC16IS7XX_BANK_GENERAL)
+  {
+    if ((registerAddr == RegSC16IS7XX_IOControl) && isWrite && ((registerValue & SC16IS7XX_IOCTRL_SOFTWARE_RESET) > 0))
+    {
+      SC16IS7XX_InvalidateShadowRegisters(pComp);                          // A software reset puts all registers back to their default values
+      return;
+    }
+    if (isWrite && ((registerAddr == RegSC16IS7XX_IER) || (registerAddr == RegSC16IS7XX_FCR) || (registerAddr == RegSC16IS7XX_MCR)))
+    {
+      // IER[7:4], FCR[5:4] and MCR[7:5] can only be modified when enhanced functions are enabled, else the written value is not the register value
+      const bool EnhancedKnown = ((pShadow->Valid[SC16IS7XX_BANK_ENHANCED] & SC16IS7XX_SHADOW_REG_MASK(RegSC16IS7XX_EFR)) > 0)
+                              && ((pShadow->Value[SC16IS7XX_BANK_ENHANCED][RegSC16IS7XX_EFR] & SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE) > 0);
+      if (EnhancedKnown == false)
+      {
+        pShadow->Valid[Bank] &= ~RegMask;                                  // The register value is not known anymore
+        return;
+      }
+    }
+    if (registerAddr == RegSC16IS7XX_FCR      ) registerValue &= ~(SC16IS7XX_FCR_RESET_RX_FIFO | SC16IS7XX_FCR_RESET_TX_FIFO); // FIFO reset bits are self clearing
+    if (registerAddr == RegSC16IS7XX_IOControl) registerValue &= ~SC16IS7XX_IOCTRL_SOFTWARE_RESET;                              // Software reset bit is self clearing
+  }
+  pShadow->Value[Bank][registerAddr] = registerValue;
+  pShadow->Valid[Bank] |= RegMask;
+}
+
+
+
+//=============================================================================
+// [STATIC] Get a register value from the shadow registers
+//=============================================================================
+bool __SC16IS7XX_GetShadowRegister(SC16IS7XX *pComp, eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t *registerValue)
+{
+  if ((registerAddr >= RegSC16IS7XX_IODir) && (registerAddr <= RegSC16IS7XX_IOControl)) channel = SC16IS7XX_CHANNEL_A; // GPIO and IOControl registers are common to both channels
+  if (channel >= SC16IS7XX_CHANNEL_COUNT) return false;
+  SC16IS7XX_ShadowRegisters* pShadow = &pComp->Shadow[channel];
+  const eSC16IS7XX_RegisterBank Bank = __SC16IS7XX_GetRegisterBank(pShadow, registerAddr);
+  if (Bank == SC16IS7XX_BANK_UNKNOWN) return false;                        // Unknown register bank, the value cannot be known
+  if ((pShadow->Valid[Bank] & SC16IS7XX_SHADOW_READ_MASK[Bank] & SC16IS7XX_SHADOW_REG_MASK(registerAddr)) == 0) return false; // Value not known or volatile register
+  *registerValue = pShadow->Value[Bank][registerAddr];
+  return true;
+}
+
+
+
+//=============================================================================
+// Invalidate all shadow registers of the SC16IS7XX
+//=============================================================================
+void SC16IS7XX_InvalidateShadowRegisters(SC16IS7XX *pComp)
 {
 #ifdef CHECK_NULL_PARAM
-  if (pIntDev == NULL) return ERR__NULL_POINTER;
-#endif
-  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
-  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice);       // Get the MCP251XFD device of this GPIO port
-#ifdef CHECK_NULL_PARAM
-  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+  if (pComp == NULL) return;
 #endif
-  return SC16IS7XX_SetGPIOPinsDirection(pDevice, (uint8_t)pinsDirection, 0xFF);
+  memset(&pComp->Shadow[0], 0, sizeof(pComp->Shadow));
 }
+#endif
+
 
 
+
+
+//**********************************************************************************************************************************************************
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
 //=============================================================================
-// Get PORT pins input level of the SC16IS7XX device
+// [STATIC] Account a bus transaction in the bus statistics
 //=============================================================================
-eERRORRESULT SC16IS7XX_GetPORTinputLevel_Gen(PORT_Interface *pIntDev, uint32_t *pinsLevel)
+void __SC16IS7XX_CountTransaction(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, size_t size, bool isRead)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pIntDev == NULL) return ERR__NULL_POINTER;
+  if ((channel >= SC16IS7XX_CHANNEL_COUNT) || (address >= SC16IS7XX_REGISTER_ADDRESS_COUNT)) return;
+  SC16IS7XX_BusCounters* pCounters = (isRead ? &pComp->Statistics.Read[channel][address] : &pComp->Statistics.Write[channel][address]);
+  pCounters->Transactions++;
+  pCounters->PayloadBytes += size;
+#ifdef SC16IS7XX_I2C_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
+    pCounters->OverheadBytes += (isRead ? 3 : 2);                          // Chip address and register address, plus the chip address of the restart for a read
 #endif
-  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
-  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice); // Get the MCP251XFD device of this GPIO port
-#ifdef CHECK_NULL_PARAM
-  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+#ifdef SC16IS7XX_SPI_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_SPI)
+    pCounters->OverheadBytes += 1;                                         // Register address
 #endif
-  uint8_t Value = 0;
-  eERRORRESULT Error = SC16IS7XX_GetGPIOPinsInputLevel(pDevice, &Value);
-  *pinsLevel = Value;
-  return Error;
 }
 
 
+
 //=============================================================================
-// Set PORT pins output level of the SC16IS7XX device
+// Get a snapshot of the bus statistics of the SC16IS7XX
 //=============================================================================
-eERRORRESULT SC16IS7XX_SetPORToutputLevel_Gen(PORT_Interface *pIntDev, const uint32_t pinsLevel)
+eERRORRESULT SC16IS7XX_GetBusStatistics(SC16IS7XX *pComp, SC16IS7XX_BusStatistics *pStatistics, bool resetAfterCopy)
 {
 #ifdef CHECK_NULL_PARAM
-  if (pIntDev == NULL) return ERR__NULL_POINTER;
+  if ((pComp == NULL) || (pStatistics == NULL)) return ERR__PARAMETER_ERROR;
 #endif
-  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
-  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice);   // Get the MCP251XFD device of this GPIO port
+  memcpy(pStatistics, &pComp->Statistics, sizeof(SC16IS7XX_BusStatistics));
+  if (resetAfterCopy) memset(&pComp->Statistics, 0, sizeof(SC16IS7XX_BusStatistics));
+  return ERR_OK;
+}
+
+
+
+//=============================================================================
+// Reset the bus statistics of the SC16IS7XX
+//=============================================================================
+eERRORRESULT SC16IS7XX_ResetBusStatistics(SC16IS7XX *pComp)
+{
 #ifdef CHECK_NULL_PARAM
-  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+  if (pComp == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  return SC16IS7XX_SetGPIOPinsOutputLevel(pDevice, (uint8_t)pinsLevel, 0xFF);
+  memset(&pComp->Statistics, 0, sizeof(SC16IS7XX_BusStatistics));
+  return ERR_OK;
 }
 
-//-----------------------------------------------------------------------------
-
 
 
 //=============================================================================
-// Set a pin on PORT direction of the SC16IS7XX device
+// Get the total bus counters of a channel of the SC16IS7XX
 //=============================================================================
-eERRORRESULT SC16IS7XX_SetPinState_Gen(GPIO_Interface *pIntDev, const eGPIO_State pinState)
+void SC16IS7XX_GetBusTotalCounters(const SC16IS7XX_BusStatistics *pStatistics, const eSC16IS7XX_Channel channel, SC16IS7XX_BusCounters *pTotal)
 {
 #ifdef CHECK_NULL_PARAM
-  if (pIntDev == NULL) return ERR__NULL_POINTER;
+  if ((pStatistics == NULL) || (pTotal == NULL)) return;
 #endif
-  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
-  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice); // Get the MCP251XFD device of this GPIO port
-#ifdef CHECK_NULL_PARAM
-  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+  memset(pTotal, 0, sizeof(SC16IS7XX_BusCounters));
+  if (channel >= SC16IS7XX_CHANNEL_COUNT) return;
+  for (size_t zReg = 0; zReg < SC16IS7XX_REGISTER_ADDRESS_COUNT; ++zReg)
+  {
+    pTotal->Transactions  += pStatistics->Read[channel][zReg].Transactions  + pStatistics->Write[channel][zReg].Transactions;
+    pTotal->PayloadBytes  += pStatistics->Read[channel][zReg].PayloadBytes  + pStatistics->Write[channel][zReg].PayloadBytes;
+    pTotal->OverheadBytes += pStatistics->Read[channel][zReg].OverheadBytes + pStatistics->Write[channel][zReg].OverheadBytes;
+  }
+}
 #endif
-  switch (pinState)
+
+
+
+
+
+//**********************************************************************************************************************************************************
+#ifdef SC16IS7XX_USE_TRACE
+//=============================================================================
+// [STATIC] Record a bus access in the trace ring
+//=============================================================================
+void __SC16IS7XX_TraceAccess(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, const uint8_t *data, size_t size, uint8_t flags)
+{
+  SC16IS7XX_Trace* pTrace = pComp->pTrace;
+  if ((pTrace->pEntries == NULL) || (pTrace->EntryCount == 0) || (channel >= SC16IS7XX_CHANNEL_COUNT)) return;
+  const uint8_t ChannelMask = (1u << channel);
+  SC16IS7XX_TraceEntry* pEntry = &pTrace->pEntries[pTrace->PosIn];
+
+  //--- Fill the entry ---
+  pEntry->Timestamp = (pComp->fnGetCurrentms != NULL ? pComp->fnGetCurrentms() : 0u);
+  pEntry->CallSite  = pTrace->CallSite;
+  pEntry->Command   = SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(address);
+  pEntry->LCR       = pTrace->LastLCR[channel];
+  pEntry->Flags     = flags | ((pTrace->LCRknown & ChannelMask) > 0 ? SC16IS7XX_TRACE_LCR_KNOWN : 0);
+  pEntry->Size      = (size > 0xFF ? 0xFF : (uint8_t)size);
+  memset(&pEntry->Data[0], 0, SC16IS7XX_TRACE_DATA_SIZE);
+  memcpy(&pEntry->Data[0], data, (size > SC16IS7XX_TRACE_DATA_SIZE ? SC16IS7XX_TRACE_DATA_SIZE : size));
+  if (++pTrace->PosIn >= pTrace->EntryCount) pTrace->PosIn = 0;                                 // Wrap the ring, the oldest entry will be overwritten
+  pTrace->TotalCount++;
+
+  //--- Follow the LCR value of the channel to know the register bank of the next accesses ---
+  if (address == RegSC16IS7XX_LCR)
   {
-    default: break;
-    case GPIO_STATE_OUTPUT: return SC16IS7XX_SetGPIOPinsDirection(pDevice, 0x00, pIntDev->PinBitMask);
-    case GPIO_STATE_INPUT : return SC16IS7XX_SetGPIOPinsDirection(pDevice, pIntDev->PinBitMask, pIntDev->PinBitMask);
-    case GPIO_STATE_RESET : return SC16IS7XX_SetGPIOPinsOutputLevel(pDevice, 0x00, pIntDev->PinBitMask);
-    case GPIO_STATE_SET   : return SC16IS7XX_SetGPIOPinsOutputLevel(pDevice, pIntDev->PinBitMask, pIntDev->PinBitMask);
-    case GPIO_STATE_TOGGLE: return SC16IS7XX_SetGPIOPinsOutputLevel(pDevice, pDevice->GPIOsOutLevel ^ (uint8_t)pIntDev->PinBitMask, pIntDev->PinBitMask);
+    if (((flags & SC16IS7XX_TRACE_NON_BLOCKING) == 0) || ((flags & SC16IS7XX_TRACE_READ) > 0)) // Value read or written on the bus, a non-blocking read is recorded at its completion
+    {
+      pTrace->LastLCR[channel] = data[0];
+      pTrace->LCRknown |= ChannelMask;
+    }
+    else if ((flags & SC16IS7XX_TRACE_READ) == 0) pTrace->LCRknown &= ~ChannelMask;             // A non-blocking write can still fail, the LCR value is unknown until the next blocking access
   }
-  return ERR__PARAMETER_ERROR;
+  if ((address == RegSC16IS7XX_IOControl) && ((flags & SC16IS7XX_TRACE_READ) == 0) && ((data[0] & SC16IS7XX_IOCTRL_SOFTWARE_RESET) > 0))
+    pTrace->LCRknown = 0;                                                                       // A software reset puts the LCR of all channels back to their default values
 }
 
 
+
 //=============================================================================
-// Get a pin on PORT input level of the SC16IS7XX device
+// Start the trace of the bus accesses of the SC16IS7XX
 //=============================================================================
-eERRORRESULT SC16IS7XX_GetPinInputLevel_Gen(GPIO_Interface *pIntDev, eGPIO_State *pinLevel)
+eERRORRESULT SC16IS7XX_StartTrace(SC16IS7XX *pComp, SC16IS7XX_Trace* pTrace)
 {
 #ifdef CHECK_NULL_PARAM
-  if (pIntDev == NULL) return ERR__NULL_POINTER;
-#endif
-  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
-  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice); // Get the MCP251XFD device of this GPIO port
-#ifdef CHECK_NULL_PARAM
-  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+  if ((pComp == NULL) || (pTrace == NULL)) return ERR__PARAMETER_ERROR;
 #endif
-  uint8_t PinState = 0;
-  eERRORRESULT Error = SC16IS7XX_GetGPIOPinsInputLevel(pDevice, &PinState);
-  *pinLevel = (PinState > 0 ? GPIO_STATE_SET : GPIO_STATE_RESET);
-  return Error;
+  if ((pTrace->pEntries == NULL) || (pTrace->EntryCount == 0)) return ERR__CONFIGURATION;
+  pTrace->PosIn      = 0;
+  pTrace->TotalCount = 0;
+  pTrace->CallSite   = 0;
+  pTrace->LCRknown   = 0;
+  pComp->pTrace = pTrace;
+  return ERR_OK;
 }
 
-#endif
-
-//-----------------------------------------------------------------------------
-
 
 
 //=============================================================================
-// Set I/O pins interrupt enable of the SC16IS7XX
+// Stop the trace of the bus accesses of the SC16IS7XX
 //=============================================================================
-eERRORRESULT SC16IS7XX_SetGPIOPinsInterruptEnable(SC16IS7XX *pComp, uint8_t pinsIntEna, uint8_t pinsChangeMask)
+eERRORRESULT SC16IS7XX_StopTrace(SC16IS7XX *pComp)
 {
 #ifdef CHECK_NULL_PARAM
   if (pComp == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED; // Only if the device have I/O pins
-  return SC16IS7XX_ModifyRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IOIntEna, pinsIntEna, pinsChangeMask);
+  pComp->pTrace = NULL;
+  return ERR_OK;
 }
 
-//-----------------------------------------------------------------------------
 
 
+//=============================================================================
+// Set the call site tag of the next traced accesses of the SC16IS7XX
+//=============================================================================
+void SC16IS7XX_SetTraceCallSite(SC16IS7XX *pComp, uint16_t callSite)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return;
+#endif
+  if (pComp->pTrace != NULL) pComp->pTrace->CallSite = callSite;
+}
 
 
 
-//**********************************************************************************************************************************************************
 //=============================================================================
-// SC16IS7XX UART initialization
+// Get the entries of a trace ring from the oldest to the newest
 //=============================================================================
-eERRORRESULT SC16IS7XX_InitUART(SC16IS7XX_UART *pUART, const SC16IS7XX_UARTconfig *pUARTConf)
+eERRORRESULT SC16IS7XX_GetTraceEntries(const SC16IS7XX_Trace* pTrace, SC16IS7XX_TraceEntry* pEntries, size_t maxCount, size_t *pCount)
 {
 #ifdef CHECK_NULL_PARAM
-  if ((pUART == NULL) || (pUARTConf == NULL)) return ERR__PARAMETER_ERROR;
-#endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+  if ((pTrace == NULL) || (pEntries == NULL) || (pCount == NULL)) return ERR__PARAMETER_ERROR;
 #endif
-  SC16IS7XX_UARTconfig *pConf = (SC16IS7XX_UARTconfig*)pUARTConf;
-  eERRORRESULT Error;
-
-  //--- Check the UART channel ------------------------------
-  if (pUART->Channel >= SC16IS7XX_CHANNEL_COUNT) return ERR__UNKNOWN_ELEMENT;
-  if ((pUART->Channel == SC16IS7XX_CHANNEL_B) && (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_2_UARTS == false)) return ERR__UNKNOWN_ELEMENT;
-
-#ifdef SC16IS7XX_USE_BUFFERS
-  //--- Configure buffers ---
-  if (pUART->TxBuffer.pData != NULL)
+  size_t Count = (pTrace->TotalCount < pTrace->EntryCount ? pTrace->TotalCount : pTrace->EntryCount);
+  size_t PosOut = (pTrace->TotalCount < pTrace->EntryCount ? 0 : pTrace->PosIn);               // When the ring has wrapped, the oldest entry is the next to be overwritten
+  if (Count > maxCount)                                                                         // Keep only the newest entries
   {
-    pUART->TxBuffer.PosIn  = pUART->TxBuffer.PosOut = 0;
-    pUART->TxBuffer.IsFull = false;
+    PosOut += (Count - maxCount);
+    if (PosOut >= pTrace->EntryCount) PosOut -= pTrace->EntryCount;
+    Count = maxCount;
   }
-  if (pUART->RxBuffer.pData != NULL)
+  for (size_t zEntry = 0; zEntry < Count; ++zEntry)
   {
-    pUART->RxBuffer.PosIn  = pUART->RxBuffer.PosOut = 0;
-    pUART->RxBuffer.IsFull = false;
+    pEntries[zEntry] = pTrace->pEntries[PosOut];
+    if (++PosOut >= pTrace->EntryCount) PosOut = 0;
   }
+  *pCount = Count;
+  return ERR_OK;
+}
 #endif
 
-  //--- Enable Enhanced Functions ---------------------------
-  Error = SC16IS7XX_EnableEnhancedFunctions(pComp, pUART->Channel); // Enable the enhanced function of the UART channel
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_EnableEnhancedFunctions() then return the error
-
-  //--- Enable TCR and TLR ---
-  Error = SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask);
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
-
-  //--- Disable Interrupts, Tx, Rx and clear FIFOs ----------
-  SC16IS7XX_IER_Register OriginalIER;
-  Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, &OriginalIER.IER); // Read and save configuration of the IER register
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
-  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, 0x00); // Disable all interrupts. And with this, the device sleep will be disabled
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-  Error = SC16IS7XX_TxRxDisable(pUART, true, true);                 // Disable Transmitter and receiver
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_TxRxDisable() then return the error
-  Error = SC16IS7XX_ResetFIFO(pUART, true, true);                   // Reset and clear Transmit and receive FIFOs
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_ResetFIFO() then return the error
-
-  //--- Disable control flow --------------------------------
-  Error = __SC16IS7XX_SetControlFlowConfiguration(pUART, NULL, NULL, NULL, false); // Disable the control flow
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling __SC16IS7XX_SetControlFlowConfiguration() then return the error
-
-  //--- Set UART configuration ------------------------------
-  Error = __SC16IS7XX_SetUARTConfiguration(pUART, pUARTConf);       // Configure UART
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_SetUARTConfiguration() then return the error
 
-  //--- Set Baudrate ----------------------------------------
-  Error = SC16IS7XX_SetUARTBaudRate(pUART, pUARTConf);              // Configure UART baudrate
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_SetUARTBaudRate() then return the error
 
-  //--- Set FIFO configuration ------------------------------
-  Error = __SC16IS7XX_ConfigureFIFOs(pUART, pUARTConf->UseFIFOs, pUARTConf->TxTrigLvl, pUARTConf->RxTrigLvl); // Configure FIFOs
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling __SC16IS7XX_ConfigureFIFOs() then return the error
 
-  //--- Return to original interrupt configuration ----------
-  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, OriginalIER.IER); // Re-enable previous interrupts with the sleep state if previously set
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
 
-  //--- Transmitter and receiver configuration --------------
-  Error = SC16IS7XX_TxRxDisable(pUART, pUARTConf->DisableTransmitter, pUARTConf->DisableReceiver); // Disable Transmitter and receiver
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_TxRxDisable() then return the error
+//**********************************************************************************************************************************************************
+#ifdef SC16IS7XX_USE_BUS_QUEUE
+//=============================================================================
+// Submit a request to the bus queue of the SC16IS7XX
+//=============================================================================
+eERRORRESULT SC16IS7XX_SubmitBusRequest(SC16IS7XX *pComp, SC16IS7XX_BusRequest *pRequest, eSC16IS7XX_BusPriority priority)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (pRequest == NULL)) return ERR__PARAMETER_ERROR;
+  if (pRequest->fnExecute == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  if (priority >= SC16IS7XX_PRIORITY_COUNT) return ERR__PARAMETER_ERROR;
+  SC16IS7XX_BusQueue* pQueue = pComp->BusQueue;
 
-  //--- Test UART connection --------------------------------
-  if (((pUART->DriverConfig & SC16IS7XX_TEST_LOOPBACK_AT_INIT) > 0) && (pUARTConf->DisableTransmitter == false) && (pUARTConf->DisableReceiver == false)) // If a UART loopback test is asked...
+  //--- Device with exclusive access to the interface ---
+  if (pQueue == NULL)
   {
-    Error = SC16IS7XX_UARTCommTest(pUART);                          // Test the UART before Control Flow because the Control Flow may interfere with the test
-    if (Error != ERR_OK) return Error;                              // If there is an error while calling SC16IS7XX_UARTCommTest() then return the error
+    pRequest->IsDone = false;
+    pRequest->Result = pRequest->fnExecute(pRequest);                      // Execute the request immediately
+    pRequest->IsDone = true;
+    return pRequest->Result;
   }
 
-  //--- Set Control Flow ------------------------------------
-  SC16IS7XX_HardControlFlow* pHardFlow = NULL;
-  SC16IS7XX_SoftControlFlow* pSoftFlow = NULL;
-  const uint8_t* pSpecialChar = (pUARTConf->UseSpecialChar ? &pUARTConf->SpecialChar : NULL);
-  bool UseAddressChar = false;
-  switch (pUARTConf->UARTtype)
+  //--- Add the request to the queue ---
+  if (pQueue->fnLock != NULL) pQueue->fnLock();
+  if (pRequest->IsQueued)                                                  // The request is still pending, it will be executed once
   {
-    case SC16IS7XX_UART_RS232:
-      switch (pUARTConf->RS232.ControlFlowType)
-      {
-        case SC16IS7XX_NO_CONTROL_FLOW:
-        default: break;
-        case SC16IS7XX_HARDWARE_CONTROL_FLOW: pHardFlow = &pConf->RS232.HardFlowControl; break;
-        case SC16IS7XX_SOFTWARE_CONTROL_FLOW: pSoftFlow = &pConf->RS232.SoftFlowControl; break;
-      }
-      break;
-    case SC16IS7XX_UART_RS485:
-      if (pUARTConf->RS485.UseHardwareControlFlow) pHardFlow = &pConf->RS485.HardFlowControl;
-      if (pUARTConf->RS485.AutoRS485mode == SC16IS7XX_AUTO_ADDRESS_DETECT) UseAddressChar = true;
-      break;
-    case SC16IS7XX_UART_IrDA:
-      if (pUARTConf->IrDA.UseSoftwareControlFlow)  pSoftFlow = &pConf->IrDA.SoftFlowControl;
-      break;
-    case SC16IS7XX_UART_Modem:
-      if (pUARTConf->Modem.UseHardwareControlFlow) pHardFlow = &pConf->Modem.HardFlowControl;
-      break;
-    default: break;
+    if (pQueue->fnUnlock != NULL) pQueue->fnUnlock();
+    return ERR__BUSY;
   }
-  if ((pHardFlow != NULL) || (pSoftFlow != NULL) || (pSpecialChar != NULL))
-    Error = __SC16IS7XX_SetControlFlowConfiguration(pUART, pHardFlow, pSoftFlow, pSpecialChar, UseAddressChar); // Configure the control flow
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling __SC16IS7XX_SetControlFlowConfiguration() then return the error
-
-  //--- Disable TCR and TLR access --------------------------
-  Error = SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_DISABLE, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask);
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
-
-  //--- Configure interrupts --------------------------------
-  return SC16IS7XX_ConfigureInterrupt(pUART, pConf->Interrupts);
+  pRequest->IsQueued = true;
+  pRequest->IsDone   = false;
+  pRequest->pNext    = NULL;
+  if (pQueue->pTail[priority] == NULL) pQueue->pHead[priority] = pRequest;
+  else pQueue->pTail[priority]->pNext = pRequest;
+  pQueue->pTail[priority] = pRequest;
+  if (pQueue->fnUnlock != NULL) pQueue->fnUnlock();
+
+  //--- Try to process the queue ---
+  (void)SC16IS7XX_ProcessBusQueue(pQueue);                                 // The result is the one of the last request executed, not necessarily this one
+  if (pRequest->IsDone) return pRequest->Result;                           // The request has been executed by this call or by the current bus owner
+  return ERR__BUSY;                                                        // The request is pending, it will be executed by the current bus owner
 }
 
 
 
 //=============================================================================
-// UART communication tests of the SC16IS7XX UART
+// Process the requests of a bus queue
 //=============================================================================
-eERRORRESULT SC16IS7XX_UARTCommTest(SC16IS7XX_UART *pUART)
+eERRORRESULT SC16IS7XX_ProcessBusQueue(SC16IS7XX_BusQueue *pQueue)
 {
 #ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__PARAMETER_ERROR;
-#endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+  if (pQueue == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  eERRORRESULT Error;
-  setSC16IS7XX_ReceiveError CharError;
-  char Value;
-
-  //--- Set UART in loopback mode ---
-  SC16IS7XX_MCR_Register RegMCR;
-  Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, &RegMCR.MCR); // Read the MCR register
-  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
-  RegMCR.MCR |= SC16IS7XX_MCR_LOOPBACK_ENABLE;                                          // Set enable local Loopback mode (internal)
-  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegMCR.MCR); // Write the MCR register
-  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-
-  //--- Reset UART FIFOs ---
-  Error = SC16IS7XX_ResetFIFO(pUART, true, true);                                       // Reset both Transmit and Receive FIFOs
-  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ResetFIFO() then return the error
-
-  //--- Test UART communication ---
-  Error = SC16IS7XX_TransmitChar(pUART, (char)(0x55 & 0x1F));                           // Transmit char 0x55 (reduced to 5 bits for 5-bits compatibility) by UART
-  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_TransmitCharByUART() then return the error
-  Error = SC16IS7XX_ReceiveChar(pUART, &Value, &CharError);                             // Receive a char UART by UART
-  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ReceiveCharByUART() then return the error
-  if (CharError != SC16IS7XX_NO_RX_ERROR) return ERR__PERIPHERAL_NOT_VALID;             // If the received data create an error then the peripheral is not valid
-  if (Value != (char)(0x55 & 0x1F)) return ERR__PERIPHERAL_NOT_VALID;                   // If the read back value is not the same as the one written, return an error
+  eERRORRESULT Error = ERR_OK;
 
-  Error = SC16IS7XX_TransmitChar(pUART, (char)(0xAA & 0x1F));                           // Transmit char 0xAA (reduced to 5 bits for 5-bits compatibility) by UART
-  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_TransmitCharByUART() then return the error
-  Error = SC16IS7XX_ReceiveChar(pUART, &Value, &CharError);                             // Receive a char UART by UART
-  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ReceiveCharByUART() then return the error
-  if (CharError != SC16IS7XX_NO_RX_ERROR) return ERR__PERIPHERAL_NOT_VALID;             // If the received data create an error then the peripheral is not valid
-  if (Value != (char)(0xAA & 0x1F)) return ERR__PERIPHERAL_NOT_VALID;                   // If the read back value is not the same as the one written, return an error
+  //--- Take the bus ownership ---
+  if (pQueue->fnLock != NULL) pQueue->fnLock();
+  if (pQueue->IsOwned)
+  {
+    if (pQueue->fnUnlock != NULL) pQueue->fnUnlock();
+    return ERR__BUSY;                                                      // Another bus owner will execute the queued requests
+  }
+  pQueue->IsOwned = true;
+  if (pQueue->fnUnlock != NULL) pQueue->fnUnlock();
 
-  RegMCR.MCR &= SC16IS7XX_MCR_NORMAL_OPERATING_MODE;                                    // Set normal operating mode
-  return SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegMCR.MCR);  // Write the MCR register
+  //--- Execute requests back to back ---
+  while (true)
+  {
+    if (pQueue->fnLock != NULL) pQueue->fnLock();
+    SC16IS7XX_BusRequest* pRequest = __SC16IS7XX_PopBusRequest(pQueue, SC16IS7XX_PRIORITY_COUNT); // Get the first request of the highest priority
+    if (pRequest == NULL) pQueue->IsOwned = false;                         // Release the bus ownership in the same critical section as the empty check, so no request can be left in the queue
+    if (pQueue->fnUnlock != NULL) pQueue->fnUnlock();
+    if (pRequest == NULL) break;                                           // The queue is empty
+
+    Error = pRequest->fnExecute(pRequest);                                 // Execute the request
+    pRequest->Result = Error;
+    pRequest->IsDone = true;
+  }
+  return Error;
 }
 
 
 
 //=============================================================================
-// [STATIC] Set UART configuration of the SC16IS7XX UART
+// Execute the pending Rx drain requests of a bus queue from the current request
 //=============================================================================
-// DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! UART configuration needs to be configured with a safe UART configuration to avoid spurious effects, which is done in the SC16IS7XX_InitUART() function
-eERRORRESULT __SC16IS7XX_SetUARTConfiguration(SC16IS7XX_UART *pUART, const SC16IS7XX_UARTconfig *pUARTConf)
+eERRORRESULT SC16IS7XX_YieldBusQueue(SC16IS7XX_BusQueue *pQueue)
 {
 #ifdef CHECK_NULL_PARAM
-  if ((pUART == NULL) || (pUARTConf == NULL)) return ERR__PARAMETER_ERROR;
-#endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+  if (pQueue == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  eERRORRESULT Error, ErrorReturn = 0;
-  SC16IS7XX_MCR_Register RegMCR;
-  SC16IS7XX_EFCR_Register RegEFCR;
-  SC16IS7XX_IOControl_Register RegIOC;
-  SC16IS7XX_EFR_Register RegEFR;
-  uint8_t RegIOCmask = 0x00;
-  RegEFCR.EFCR = SC16IS7XX_EFCR_IrDA_3_16_PULSE_RATIO | SC16IS7XX_EFCR_9BIT_MODE_DISABLE // Default configuration
-               | SC16IS7XX_EFCR_TX_NOT_CONTROL_RTS | SC16IS7XX_EFCR_NORMAL_RTS_PIN;
+  if (pQueue->IsOwned == false) return ERR__NOT_AVAILABLE;                 // Only the bus owner can execute requests
 
-  //--- Select the IO control mask ---
-  RegIOC.IOControl = SC16IS7XX_IOCTRL_GPIO7_4_AS_IO | SC16IS7XX_IOCTRL_GPIO3_0_AS_IO;
-  switch (pUART->Channel)
+  //--- Execute the Rx drain requests back to back ---
+  while (true)
   {
-    case SC16IS7XX_CHANNEL_A: RegIOCmask = SC16IS7XX_IOCTRL_UARTA_MODEM_MODE_Mask; break;
-    case SC16IS7XX_CHANNEL_B: RegIOCmask = SC16IS7XX_IOCTRL_UARTB_MODEM_MODE_Mask; break;
-    default: return ERR__UNKNOWN_ELEMENT;
+    if (pQueue->fnLock != NULL) pQueue->fnLock();
+    SC16IS7XX_BusRequest* pRequest = __SC16IS7XX_PopBusRequest(pQueue, SC16IS7XX_PRIORITY_RX_DRAIN + 1); // Get the first Rx drain request
+    if (pQueue->fnUnlock != NULL) pQueue->fnUnlock();
+    if (pRequest == NULL) break;                                           // No more Rx drain request
+    pRequest->Result = pRequest->fnExecute(pRequest);                      // Execute the request
+    pRequest->IsDone = true;
   }
+  return ERR_OK;
+}
 
-  //--- Configure the UART type ---
-  switch (pUARTConf->UARTtype)
+
+
+//=============================================================================
+// [STATIC] Remove the first request of the highest priority from the bus queue
+//=============================================================================
+SC16IS7XX_BusRequest* __SC16IS7XX_PopBusRequest(SC16IS7XX_BusQueue *pQueue, size_t priorityCount)
+{
+  for (size_t zPriority = 0; zPriority < priorityCount; ++zPriority)
   {
-    case SC16IS7XX_UART_RS232:
-      RegMCR.MCR = SC16IS7XX_MCR_NORMAL_UART_MODE;
-      break;
+    SC16IS7XX_BusRequest* const pRequest = pQueue->pHead[zPriority];
+    if (pRequest == NULL) continue;
+    pQueue->pHead[zPriority] = pRequest->pNext;
+    if (pQueue->pHead[zPriority] == NULL) pQueue->pTail[zPriority] = NULL;
+    pRequest->IsQueued = false;                                            // The request can be submitted again from now, even while it is executed
+    return pRequest;
+  }
+  return NULL;
+}
+#endif
 
-    case SC16IS7XX_UART_RS485:
-      RegMCR.MCR = SC16IS7XX_MCR_NORMAL_UART_MODE;
-      switch (pUARTConf->RS485.RTScontrol)
-      {
-        //--- Configure RTS mode ---
-        case SC16IS7XX_RS485_AUTO_RTS:
-          if (pUARTConf->RS485.UseHardwareControlFlow) return ERR__CONFIGURATION;          // If auto RTS mode then the hardware control flow shall not be used
-          RegEFCR.EFCR |= SC16IS7XX_EFCR_TX_CONTROL_RTS;                                   // Set automatic RTS mode
-          break;
-        case SC16IS7XX_RS485_HARD_FLOW_CONTROL_RTS:
-          if (pUARTConf->RS485.UseHardwareControlFlow == false) return ERR__CONFIGURATION; // If hardware control flow RTS mode then the hardware control flow shall be used
-          break;
-        case SC16IS7XX_RS485_MANUAL_EXTERNAL_RTS:
-          if (pUARTConf->RS485.UseHardwareControlFlow) return ERR__CONFIGURATION;          // If manual/external RTS mode then the hardware control flow shall not be used
-          break;
-        default: break;
-      }
-      if (pUARTConf->RS485.RTSoutInversion) RegEFCR.EFCR |= SC16IS7XX_EFCR_INVERT_RTS_PIN; // Invert RTS output if configured
-      //--- Configure RS-485 mode ---
-      switch (pUARTConf->RS485.AutoRS485mode)
-      {
-        case SC16IS7XX_NO_AUTO_RS485_MODE: break;
-        case SC16IS7XX_MULTIDROP_MODE: RegEFCR.EFCR |= SC16IS7XX_EFCR_9BIT_MODE_ENABLE; break;
-        case SC16IS7XX_AUTO_ADDRESS_DETECT:
-          RegEFCR.EFCR |= SC16IS7XX_EFCR_9BIT_MODE_ENABLE;
-          //--- Enable access to enhanced registers ---
-          SC16IS7XX_LCR_Register OriginalLCR;
-          Error = SC16IS7XX_SetRegisterAccess(pComp, pUART->Channel, SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER, &OriginalLCR.LCR);
-          if (Error != ERR_OK) return Error;                                                                        // If there is an error while calling SC16IS7XX_SetRegisterAccess() then return the error
-          //--- Configure the auto address detect ---
-          RegEFR.EFR = SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_ENABLE;
-          SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_EFR, RegEFR.EFR, SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_Mask); // Modify the EFR register
-          if (Error != ERR_OK) ErrorReturn = Error;                                                                 // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
-          Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XOFF2, pUARTConf->RS485.AddressChar); // Write the Address char in Xoff2 register
-          if (Error != ERR_OK) ErrorReturn = Error;                                                                 // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-          //--- Return access to general registers ---
-          Error = SC16IS7XX_ReturnAccessToGeneralRegister(pComp, pUART->Channel, OriginalLCR.LCR);                  // Return access to general registers
-          if (ErrorReturn != ERR_OK) return ErrorReturn;                                                            // If there is an error while Enhanced Features are enabled then return the error
-          if (Error != ERR_OK) return Error;                                                                        // If there is an error while calling SC16IS7XX_ReturnAccessToGeneralRegister() then return the error
-          break;
-        default: return ERR__CONFIGURATION;
-      }
-      break;
 
-    case SC16IS7XX_UART_IrDA:
-      RegMCR.MCR = SC16IS7XX_MCR_IrDA_MODE;                         // Set IrDA mode
-      RegEFCR.EFCR = SC16IS7XX_EFCR_IrDA_3_16_PULSE_RATIO;          // By default, set IrDA 3/16 pulse ratio
-      if (pUARTConf->IrDA.IrDAmode == SC16IS7XX_IrDA_SIR_1_4_RATIO) // If IrDA mode is 1/4 ratio
-      {
-        if (SC16IS7XX_LIMITS[pComp->DevicePN].IrDA_1_4_RATIO)       // If 1/4 ratio mode supported
-             RegEFCR.EFCR = SC16IS7XX_EFCR_IrDA_1_4_PULSE_RATIO;    // Then set the 1/4 ratio configuration
-        else return ERR__NOT_SUPPORTED;                             // Else return an error
-      }
-      break;
 
-    case SC16IS7XX_UART_Modem:
-      RegMCR.MCR = SC16IS7XX_MCR_NORMAL_UART_MODE;
-      switch (pUART->Channel)
-      {
-        case SC16IS7XX_CHANNEL_A: RegIOC.IOControl = SC16IS7XX_IOCTRL_GPIO7_4_AS_MODEM; break;
-        case SC16IS7XX_CHANNEL_B: RegIOC.IOControl = SC16IS7XX_IOCTRL_GPIO3_0_AS_MODEM; break;
-        default: return ERR__UNKNOWN_ELEMENT;
-      }
-      break;
 
-    default: return ERR__UNKNOWN_ELEMENT;
+
+//**********************************************************************************************************************************************************
+#ifdef SC16IS7XX_USE_REGISTER_SCRIPT
+//=============================================================================
+// [STATIC] Append a register write to the script being recorded
+//=============================================================================
+void __SC16IS7XX_RecordScriptWrite(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t registerValue)
+{
+  SC16IS7XX_Script* pScript = pComp->pRecordScript;
+  if (pScript->StepCount < pScript->MaxSteps)
+  {
+    SC16IS7XX_ScriptStep* pStep = &pScript->pSteps[pScript->StepCount];
+    pStep->Operation = SC16IS7XX_SCRIPT_WRITE;
+    pStep->Command   = SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(registerAddr);
+    pStep->Value     = registerValue;
+    pStep->Mask      = 0x00;
   }
+  pScript->StepCount++;                                                    // Count the step even if the script is full to detect the overflow at the end of the recording
+}
 
-  //--- Now apply parameters to registers ---
-  SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegMCR.MCR, SC16IS7XX_MCR_IrDA_MODE_Mask); // Modify the LCR register
-  if (Error != ERR_OK) return Error;                                                                           // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
-  SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_EFCR, RegEFCR.EFCR, SC16IS7XX_EFCR_LINE_CONTROL_MODE_Mask); // Modify the EFCR register
-  if (Error != ERR_OK) return Error;                                                                           // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
-  SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_IOControl, RegIOC.IOControl, RegIOCmask);       // Modify the IOControl register
-  if (Error != ERR_OK) return Error;                                                                           // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
 
-  //--- Configuration of the data communication format ---
-  SC16IS7XX_LCR_Register RegLCR;
-  RegLCR.LCR = SC16IS7XX_LCR_NO_BREAK_CONDITION | SC16IS7XX_LCR_DIVISOR_LATCH_DISABLE
-             | SC16IS7XX_LCR_DATA_LENGTH_SET(pUARTConf->UARTwordLen)                                                                 // UART word length
-             | (pUARTConf->UARTstopBit != SC16IS7XX_STOP_BIT_1bit ? SC16IS7XX_LCR_EXTENDED_STOP_BIT : SC16IS7XX_LCR_ONLY_1_STOP_BIT) // UART stop bit
-             | SC16IS7XX_LCR_PARITY_SET(pUARTConf->UARTparity);                                                                      // UART parity
-  return SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_LCR, RegLCR.LCR);                                               // Write the LCR register
+
+//=============================================================================
+// Start recording register writes of the SC16IS7XX into a script
+//=============================================================================
+eERRORRESULT SC16IS7XX_StartScriptRecording(SC16IS7XX *pComp, SC16IS7XX_Script* pScript)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (pScript == NULL)) return ERR__PARAMETER_ERROR;
+  if ((pScript->pSteps == NULL) && (pScript->MaxSteps > 0)) return ERR__NULL_BUFFER;
+#endif
+  pScript->StepCount = 0;
+  pComp->pRecordScript = pScript;
+  return ERR_OK;
 }
 
 
 
 //=============================================================================
-// Set UART baudrate of the SC16IS7XX UART
+// Stop recording register writes of the SC16IS7XX
 //=============================================================================
-eERRORRESULT SC16IS7XX_SetUARTBaudRate(SC16IS7XX_UART *pUART, const SC16IS7XX_UARTconfig *pUARTConf)
+eERRORRESULT SC16IS7XX_StopScriptRecording(SC16IS7XX *pComp)
 {
 #ifdef CHECK_NULL_PARAM
-  if ((pUART == NULL) || (pUARTConf == NULL)) return ERR__PARAMETER_ERROR;
+  if (pComp == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+  SC16IS7XX_Script* pScript = pComp->pRecordScript;
+  pComp->pRecordScript = NULL;
+  if (pScript == NULL) return ERR_OK;                                      // No recording in progress
+  return (pScript->StepCount > pScript->MaxSteps ? ERR__BUFFER_FULL : ERR_OK);
+}
+
+
+
+//=============================================================================
+// Execute a register script on the SC16IS7XX
+//=============================================================================
+eERRORRESULT SC16IS7XX_ExecuteScript(SC16IS7XX *pComp, const SC16IS7XX_ScriptStep* pSteps, size_t stepCount)
+{
 #ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__UNKNOWN_DEVICE;
+  if (pComp == NULL) return ERR__PARAMETER_ERROR;
+  if ((pSteps == NULL) && (stepCount > 0)) return ERR__NULL_BUFFER;
 #endif
-  eERRORRESULT Error;
-
-  //--- Check that the device is not in sleep mode ---
-  bool DeviceInSleepMode;
-  Error = SC16IS7XX_IsDeviceInSleepMode(pComp, &DeviceInSleepMode); // Ask if device is in sleep mode
-  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_IsDeviceInSleepMode() then return the error
-  if (DeviceInSleepMode) return ERR__NOT_IN_SLEEP_MODE;             // To perform the set baudrate operation, the device should not be in sleep mode
+  eERRORRESULT Error = ERR_OK;
+  uint8_t OriginalLCR[SC16IS7XX_CHANNEL_COUNT] = { 0x00 };                // Original LCR of each channel, a script can span several UARTs
 
-  //--- Limits tests ---
-  if ((pComp->XtalFreq != 0) && (pComp->XtalFreq < SC16IS7XX_FREQ_MIN     )) return ERR__FREQUENCY_ERROR; // The device crystal should not be < 1.6kHz (100 bauds min)
-  if ((pComp->XtalFreq != 0) && (pComp->XtalFreq > SC16IS7XX_XTAL_FREQ_MAX)) return ERR__FREQUENCY_ERROR; // The device crystal should not be > 24MHz
-  if ((pComp->OscFreq  != 0) && (pComp->OscFreq  < SC16IS7XX_FREQ_MIN     )) return ERR__FREQUENCY_ERROR; // The device oscillator should not be < 1.6kMHz (100 bauds min)
-  if ((pComp->OscFreq  != 0) && (pComp->OscFreq  > SC16IS7XX_OSC_FREQ_MAX )) return ERR__FREQUENCY_ERROR; // The device oscillator should not be > 80MHz
-  uint32_t CompFreq = 0;
-  if (pComp->XtalFreq != 0) CompFreq = pComp->XtalFreq; else CompFreq = pComp->OscFreq;                   // Select the device frequency
-  if (CompFreq == 0) return ERR__FREQUENCY_ERROR;                                                         // Both XtalFreq and OscFreq are configured to 0
-  if (pUARTConf->UARTbaudrate < SC16IS7XX_BAUDRATE_MIN) return ERR__BAUDRATE_ERROR;                       // The UART baudrate should not be < 100 bauds
-  if (pUARTConf->UARTbaudrate > SC16IS7XX_BAUDRATE_MAX) return ERR__BAUDRATE_ERROR;                       // In All modes the baudrate max is 5Mbauds
-  if (pUARTConf->UARTtype == SC16IS7XX_UART_IrDA)                                                         // If the device is in IrDA mode
+  for (size_t zStep = 0; zStep < stepCount; ++zStep)
   {
-    if (pUARTConf->IrDA.IrDAmode == SC16IS7XX_IrDA_SIR_1_4_RATIO)
+    const SC16IS7XX_ScriptStep* pStep = &pSteps[zStep];
+    const eSC16IS7XX_Channel Channel = SC16IS7XX_CHANNEL_GET(pStep->Command);
+    const uint8_t Address = SC16IS7XX_ADDRESS_GET(pStep->Command);
+    switch (pStep->Operation)
     {
-      if (SC16IS7XX_LIMITS[pComp->DevicePN].IrDA_1_4_RATIO)
-      {
-        if (pUARTConf->UARTbaudrate > SC16IS76X_IrDA_SPEED_MAX) return ERR__BAUDRATE_ERROR;  // The UART baudrate should not be > max IrDA baudrate (SC16IS76X only)
-      }
-      else return ERR__NOT_SUPPORTED;                                                        // IrDA SIR 1/4 ratio not supported on SC16IS7XX who are not SC16IS76X
+      case SC16IS7XX_SCRIPT_WRITE:
+        Error = SC16IS7XX_WriteRegister(pComp, Channel, Address, pStep->Value);                                   // Write the register
+        break;
+      case SC16IS7XX_SCRIPT_MODIFY:
+        Error = SC16IS7XX_ModifyRegister(pComp, Channel, Address, pStep->Value, pStep->Mask);                     // Modify the register
+        break;
+      case SC16IS7XX_SCRIPT_SET_ACCESS:
+        if (Channel >= SC16IS7XX_CHANNEL_COUNT) return ERR__UNKNOWN_ELEMENT;
+        Error = SC16IS7XX_SetRegisterAccess(pComp, Channel, (eSC16IS7XX_AccessTo)pStep->Value, &OriginalLCR[Channel]); // Set register access and save the original LCR of the channel
+        break;
+      case SC16IS7XX_SCRIPT_RESTORE_ACCESS:
+        if (Channel >= SC16IS7XX_CHANNEL_COUNT) return ERR__UNKNOWN_ELEMENT;
+        Error = SC16IS7XX_ReturnAccessToGeneralRegister(pComp, Channel, OriginalLCR[Channel]);                   // Return access to general registers
+        break;
+      case SC16IS7XX_SCRIPT_DELAY:
+        {
+          if (pComp->fnGetCurrentms == NULL) return ERR__PARAMETER_ERROR;
+          const uint32_t StartTime = pComp->fnGetCurrentms();                                                    // Start the delay
+          while (true)
+          {
+            const uint32_t Elapsedms = SC16IS7XX_TIME_DIFF(StartTime, pComp->fnGetCurrentms());
+            if (Elapsedms > pStep->Value) break;                                                                 // The delay started anywhere in the first tick, one more tick ensures the whole delay
+            if (pComp->fnSleep != NULL) pComp->fnSleep(pComp, ((uint32_t)pStep->Value - Elapsedms + 1u) * 1000u); // Sleep the time left
+          }
+        }
+        break;
+      default: return ERR__UNKNOWN_COMMAND;
     }
-    else if (pUARTConf->UARTbaudrate > SC16IS7XX_IrDA_SPEED_MAX) return ERR__BAUDRATE_ERROR; // The UART baudrate should not be > max IrDA baudrate
-  }
-
-  //--- Calculate Divisor with Prescaler = 1 and its error ---
-  uint32_t DivisorPrescaler1 = (uint32_t)(((float)CompFreq / ((float)pUARTConf->UARTbaudrate * 16.0f * 1.0f)) + 0.5f);          // (ComponentXtalFreq/1)/(DesiredBaudRate*16)+0.5 for rounding
-  if (DivisorPrescaler1 < 0x0001) DivisorPrescaler1 =     1;                                                                    // Cannot be < 1
-  if (DivisorPrescaler1 > 0xFFFF) DivisorPrescaler1 = 65535;                                                                    // Cannot be > 65535
-  float BaudRatePrescaler1 = (float)CompFreq / ((float)DivisorPrescaler1 * 16.0f * 1.0f);                                       // Get actual baudrate with prescaler set to 1
-  float ErrorPrescaler1    = ((BaudRatePrescaler1 - (float)pUARTConf->UARTbaudrate) * 100000) / (float)pUARTConf->UARTbaudrate; // Calculate error with prescaler set to 1
-  //--- Calculate Divisor with Prescaler = 4 and its error ---
-  uint32_t DivisorPrescaler4 = (uint32_t)(((float)CompFreq / ((float)pUARTConf->UARTbaudrate * 16.0f * 4.0f)) + 0.5f);          // (ComponentXtalFreq/4)/(DesiredBaudRate*16)+0.5 for rounding
-  if (DivisorPrescaler4 < 0x0001) DivisorPrescaler4 =     1;                                                                    // Cannot be < 1
-  if (DivisorPrescaler4 > 0xFFFF) DivisorPrescaler4 = 65535;                                                                    // Cannot be > 65535
-  float BaudRatePrescaler4 = (float)CompFreq / ((float)DivisorPrescaler4 * 16.0f * 4.0f);                                       // Get actual baudrate with prescaler set to 4
-  float ErrorPrescaler4    = ((BaudRatePrescaler4 - (float)pUARTConf->UARTbaudrate) * 100000) / (float)pUARTConf->UARTbaudrate; // Calculate error with prescaler set to 4
-
-  //--- Configure clock divisor ---
-  uint32_t DivPresToSet;
-  uint8_t RegValue = 0;
-  if (SC16IS7XX_ABSOLUTE(ErrorPrescaler1) < SC16IS7XX_ABSOLUTE(ErrorPrescaler4))
-  {                                                                                 // Set prescaler to 1 and set divisor for prescaler 1
-    *(pUARTConf->UARTbaudrateError) = (int32_t)ErrorPrescaler1;                     // Divide UARTbaudrateError by 1000 to get the real error
-    RegValue = SC16IS7XX_MCR_CLOCK_INPUT_DIVIDE_BY_1;                               // Set divide-by-1 clock input
-    DivPresToSet = DivisorPrescaler1;
-  }
-  else                                                                              // Set prescaler to 4 and set divisor for prescaler 4
-  {
-    *(pUARTConf->UARTbaudrateError) = (int32_t)ErrorPrescaler4;                     // Divide UARTbaudrateError by 1000 to get the real error
-    RegValue = SC16IS7XX_MCR_CLOCK_INPUT_DIVIDE_BY_4;                               // Set divide-by-4 clock input
-    DivPresToSet = DivisorPrescaler4;
+    if (Error != ERR_OK) return Error;                                     // If there is an error while executing the step then return the error
   }
-  Error = SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegValue, SC16IS7XX_MCR_CLOCK_INPUT_DIVIDE_Mask);
-  if (Error != ERR_OK) return Error;                                                // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-
-  //--- Set baudrate divisors ---
-  SC16IS7XX_LCR_Register OriginalLCR;
-  Error = SC16IS7XX_SetRegisterAccess(pComp, pUART->Channel, SC16IS7XX_LCR_VALUE_SET_SPECIAL_REGISTER, &OriginalLCR.LCR);
-  if (Error != ERR_OK) return Error;                                                // If there is an error while calling SC16IS7XX_SetRegisterAccess() then return the error
+  return ERR_OK;
+}
+#endif
 
-  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_DLL, (uint8_t)(DivPresToSet & 0xFF)); // Write the DLL register
-  if (Error != ERR_OK) return Error;                                                                        // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_DLH, (uint8_t)(DivPresToSet >> 8));   // Write the DLH register
-  if (Error != ERR_OK) return Error;                                                                        // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
 
-  //--- Return access to general registers ---
-  return SC16IS7XX_ReturnAccessToGeneralRegister(pComp, pUART->Channel, OriginalLCR.LCR); // Return access to general registers
-}
 
 
 
+//**********************************************************************************************************************************************************
 //=============================================================================
-// [STATIC] Configure an UART Control Flow of the SC16IS7XX UART
+// Enable Enhanced Functions of the SC16IS7XX device
 //=============================================================================
-// DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! Control Flow needs to be configured with a safe UART configuration to avoid spurious effects, which is done in the SC16IS7XX_InitUART() function
-eERRORRESULT __SC16IS7XX_SetControlFlowConfiguration(SC16IS7XX_UART *pUART, SC16IS7XX_HardControlFlow *pHardFlow, SC16IS7XX_SoftControlFlow *pSoftFlow, const uint8_t* pSpecialChar, bool useAddressChar)
+eERRORRESULT SC16IS7XX_EnableEnhancedFunctions(SC16IS7XX *pComp, eSC16IS7XX_Channel channel)
+{
+  eERRORRESULT Error;
+
+  //--- Enable access to enhanced registers ---
+  SC16IS7XX_LCR_Register OriginalLCR;
+  Error = SC16IS7XX_SetRegisterAccess(pComp, channel, SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER, &OriginalLCR.LCR);
+  if (Error != ERR_OK) return Error;                                                // If there is an error while calling SC16IS7XX_SetRegisterAccess() then return the error
+
+  //--- Enable Enhanced Functions ---
+  Error = SC16IS7XX_ModifyRegister(pComp, channel, RegSC16IS7XX_EFR, SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE, SC16IS7XX_EFR_ENHANCED_FUNCTION_Mask);
+  if (Error != ERR_OK) return Error;                                                // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+
+  //--- Return access to general registers ---
+  return SC16IS7XX_ReturnAccessToGeneralRegister(pComp, channel, OriginalLCR.LCR); // Return access to general registers
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Verify if the SC16IS7XX device has sleep mode enabled
+//=============================================================================
+eERRORRESULT SC16IS7XX_IsDeviceInSleepMode(SC16IS7XX *pComp, bool* isSleepModeEnable)
+{
+#ifdef CHECK_NULL_PARAM
+  if (isSleepModeEnable == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  eERRORRESULT Error;
+  SC16IS7XX_IER_Register RegIER;
+  Error = SC16IS7XX_ReadRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IER, &RegIER.IER); // Read the IER register
+  if (Error != ERR_OK) return Error;                                                          // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+  *isSleepModeEnable = ((RegIER.IER & SC16IS7XX_IER_SLEEP_MODE_ENABLE) > 0);
+  return ERR_OK;
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Configure GPIOs of the SC16IS7XX device
+//=============================================================================
+eERRORRESULT SC16IS7XX_ConfigureGPIOs(SC16IS7XX *pComp, uint8_t pinsDirection, uint8_t pinsLevel, uint8_t pinsInterruptEnable)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  eERRORRESULT Error;
+  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED; // Only if the device have I/O pins
+
+  Error = SC16IS7XX_SetGPIOPinsDirection(pComp, pinsDirection, 0xFF);                  // Write the GPIOs pin direction
+  if (Error != ERR_OK) return Error;                                                   // If there is an error while calling SC16IS7XX_SetGPIOPinsDirection() then return the error
+  Error = SC16IS7XX_SetGPIOPinsOutputLevel(pComp, pinsLevel, 0xFF);                    // Write the GPIOs output level
+  if (Error != ERR_OK) return Error;                                                   // If there is an error while calling SC16IS7XX_SetGPIOPinsOutputLevel() then return the error
+  return SC16IS7XX_SetGPIOPinsInterruptEnable(pComp, pinsInterruptEnable, 0xFF);       // Write the pin interrupt enable
+}
+
+
+//=============================================================================
+// Set I/O pins direction of the SC16IS7XX
+//=============================================================================
+eERRORRESULT SC16IS7XX_SetGPIOPinsDirection(SC16IS7XX *pComp, const uint8_t pinsDirection, const uint8_t pinsChangeMask)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED; // Only if the device have I/O pins
+  pComp->GPIOsOutDir &= ~pinsChangeMask;                                               // Force change bits to 0
+  pComp->GPIOsOutDir |= (~pinsDirection & pinsChangeMask);                             // Apply new direction only on changed pins. Invert pin direction to fit GPIO_Interface logic
+  return SC16IS7XX_WriteRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IODir, pComp->GPIOsOutDir);
+}
+
+
+//=============================================================================
+// Get I/O pins input level of the SC16IS7XX
+//=============================================================================
+eERRORRESULT SC16IS7XX_GetGPIOPinsInputLevel(SC16IS7XX *pComp, uint8_t *pinsState)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pComp == NULL) || (pinsState == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED;         // Only if the device have I/O pins
+  return SC16IS7XX_ReadRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IOState, pinsState); // Read the IOState register
+}
+
+
+//=============================================================================
+// Set I/O pins output level of the SC16IS7XX
+//=============================================================================
+eERRORRESULT SC16IS7XX_SetGPIOPinsOutputLevel(SC16IS7XX *pComp, const uint8_t pinsLevel, const uint8_t pinsChangeMask)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED;                     // Only if the device have I/O pins
+  pComp->GPIOsOutLevel &= ~pinsChangeMask;                                                                 // Force change bits to 0
+  pComp->GPIOsOutLevel |= (pinsLevel & pinsChangeMask);                                                    // Apply new output level only on changed pins
+  return SC16IS7XX_WriteRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IOState, pComp->GPIOsOutLevel); // Write the IOState register
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+#ifdef USE_GENERICS_DEFINED
+
+//=============================================================================
+// Set PORT direction of the SC16IS7XX device
+//=============================================================================
+eERRORRESULT SC16IS7XX_SetPORTdirection_Gen(PORT_Interface *pIntDev, const uint32_t pinsDirection)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR__NULL_POINTER;
+#endif
+  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
+  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice);       // Get the MCP251XFD device of this GPIO port
+#ifdef CHECK_NULL_PARAM
+  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  return SC16IS7XX_SetGPIOPinsDirection(pDevice, (uint8_t)pinsDirection, 0xFF);
+}
+
+
+//=============================================================================
+// Get PORT pins input level of the SC16IS7XX device
+//=============================================================================
+eERRORRESULT SC16IS7XX_GetPORTinputLevel_Gen(PORT_Interface *pIntDev, uint32_t *pinsLevel)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR__NULL_POINTER;
+#endif
+  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
+  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice); // Get the MCP251XFD device of this GPIO port
+#ifdef CHECK_NULL_PARAM
+  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  uint8_t Value = 0;
+  eERRORRESULT Error = SC16IS7XX_GetGPIOPinsInputLevel(pDevice, &Value);
+  *pinsLevel = Value;
+  return Error;
+}
+
+
+//=============================================================================
+// Set PORT pins output level of the SC16IS7XX device
+//=============================================================================
+eERRORRESULT SC16IS7XX_SetPORToutputLevel_Gen(PORT_Interface *pIntDev, const uint32_t pinsLevel)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR__NULL_POINTER;
+#endif
+  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
+  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice);   // Get the MCP251XFD device of this GPIO port
+#ifdef CHECK_NULL_PARAM
+  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  return SC16IS7XX_SetGPIOPinsOutputLevel(pDevice, (uint8_t)pinsLevel, 0xFF);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Set a pin on PORT direction of the SC16IS7XX device
+//=============================================================================
+eERRORRESULT SC16IS7XX_SetPinState_Gen(GPIO_Interface *pIntDev, const eGPIO_State pinState)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR__NULL_POINTER;
+#endif
+  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
+  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice); // Get the MCP251XFD device of this GPIO port
+#ifdef CHECK_NULL_PARAM
+  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  switch (pinState)
+  {
+    default: break;
+    case GPIO_STATE_OUTPUT: return SC16IS7XX_SetGPIOPinsDirection(pDevice, 0x00, pIntDev->PinBitMask);
+    case GPIO_STATE_INPUT : return SC16IS7XX_SetGPIOPinsDirection(pDevice, pIntDev->PinBitMask, pIntDev->PinBitMask);
+    case GPIO_STATE_RESET : return SC16IS7XX_SetGPIOPinsOutputLevel(pDevice, 0x00, pIntDev->PinBitMask);
+    case GPIO_STATE_SET   : return SC16IS7XX_SetGPIOPinsOutputLevel(pDevice, pIntDev->PinBitMask, pIntDev->PinBitMask);
+    case GPIO_STATE_TOGGLE: return SC16IS7XX_SetGPIOPinsOutputLevel(pDevice, pDevice->GPIOsOutLevel ^ (uint8_t)pIntDev->PinBitMask, pIntDev->PinBitMask);
+  }
+  return ERR__PARAMETER_ERROR;
+}
+
+
+//=============================================================================
+// Get a pin on PORT input level of the SC16IS7XX device
+//=============================================================================
+eERRORRESULT SC16IS7XX_GetPinInputLevel_Gen(GPIO_Interface *pIntDev, eGPIO_State *pinLevel)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR__NULL_POINTER;
+#endif
+  if (pIntDev->UniqueID != SC16IS7XX_UNIQUE_ID) return ERR__UNKNOWN_ELEMENT;
+  SC16IS7XX* pDevice = (SC16IS7XX*)(pIntDev->InterfaceDevice); // Get the MCP251XFD device of this GPIO port
+#ifdef CHECK_NULL_PARAM
+  if (pDevice == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  uint8_t PinState = 0;
+  eERRORRESULT Error = SC16IS7XX_GetGPIOPinsInputLevel(pDevice, &PinState);
+  *pinLevel = (PinState > 0 ? GPIO_STATE_SET : GPIO_STATE_RESET);
+  return Error;
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Set I/O pins interrupt enable of the SC16IS7XX
+//=============================================================================
+eERRORRESULT SC16IS7XX_SetGPIOPinsInterruptEnable(SC16IS7XX *pComp, uint8_t pinsIntEna, uint8_t pinsChangeMask)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  if (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_GPIO == false) return ERR__NOT_SUPPORTED; // Only if the device have I/O pins
+  return SC16IS7XX_ModifyRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IOIntEna, pinsIntEna, pinsChangeMask);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// SC16IS7XX UART initialization
+//=============================================================================
+eERRORRESULT SC16IS7XX_InitUART(SC16IS7XX_UART *pUART, const SC16IS7XX_UARTconfig *pUARTConf)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pUART == NULL) || (pUARTConf == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+
+  //--- Check the UART channel ------------------------------
+  if (pUART->Channel >= SC16IS7XX_CHANNEL_COUNT) return ERR__UNKNOWN_ELEMENT;
+  if ((pUART->Channel == SC16IS7XX_CHANNEL_B) && (SC16IS7XX_LIMITS[pComp->DevicePN].HAVE_2_UARTS == false)) return ERR__UNKNOWN_ELEMENT;
+
+#ifdef SC16IS7XX_USE_BUFFERS
+  //--- Configure buffers ---
+  if (pUART->TxBuffer.pData != NULL) pUART->TxBuffer.PosIn = pUART->TxBuffer.PosOut = 0;
+  if (pUART->RxBuffer.pData != NULL) pUART->RxBuffer.PosIn = pUART->RxBuffer.PosOut = 0;
+  pUART->RxScanned    = 0;
+  pUART->RxIERmasked  = 0;
+  pUART->TxIERmasked  = 0;
+# ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+  pUART->RxTimestamps.PosIn  = pUART->RxTimestamps.PosOut  = 0;
+  pUART->RxTimestamps.DataIn = pUART->RxTimestamps.DataOut = 0;
+  if ((pUART->RxTimestamps.pStamps != NULL) && (pUART->RxTimestamps.StampCount < 2)) return ERR__CONFIGURATION; // The ring shall hold at least one timestamp
+# endif
+# ifdef SC16IS7XX_USE_POW2_BUFFERS
+  if ((pUART->TxBuffer.pData != NULL) && ((pUART->TxBuffer.BufferSize == 0) || ((pUART->TxBuffer.BufferSize & (pUART->TxBuffer.BufferSize - 1)) != 0))) return ERR__CONFIGURATION; // The Tx buffer size shall be a power of two
+  if ((pUART->RxBuffer.pData != NULL) && ((pUART->RxBuffer.BufferSize == 0) || ((pUART->RxBuffer.BufferSize & (pUART->RxBuffer.BufferSize - 1)) != 0))) return ERR__CONFIGURATION; // The Rx buffer size shall be a power of two
+# endif
+#endif
+
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  //--- Configure the UART in a bank session ----------------
+  eERRORRESULT Error = SC16IS7XX_BeginBankSession(pComp, pUART->Channel); // The returns to general registers are deferred until another register is accessed
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_BeginBankSession() then return the error
+  Error = __SC16IS7XX_ConfigureUART(pUART, pUARTConf);              // Configure the UART registers
+  eERRORRESULT ErrorSession = SC16IS7XX_EndBankSession(pComp, pUART->Channel); // Write back a deferred LCR, even after an error
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling __SC16IS7XX_ConfigureUART() then return the error
+  return ErrorSession;
+#else
+  return __SC16IS7XX_ConfigureUART(pUART, pUARTConf);               // Configure the UART registers
+#endif
+}
+
+
+
+//=============================================================================
+// [STATIC] Configure the registers of a SC16IS7XX UART
+//=============================================================================
+// DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! The UART channel and the buffers are checked in the SC16IS7XX_InitUART() function
+eERRORRESULT __SC16IS7XX_ConfigureUART(SC16IS7XX_UART *pUART, const SC16IS7XX_UARTconfig *pUARTConf)
+{
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+  SC16IS7XX_UARTconfig *pConf = (SC16IS7XX_UARTconfig*)pUARTConf;
+  eERRORRESULT Error;
+
+  //--- Enable Enhanced Functions ---------------------------
+  Error = SC16IS7XX_EnableEnhancedFunctions(pComp, pUART->Channel); // Enable the enhanced function of the UART channel
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_EnableEnhancedFunctions() then return the error
+
+  //--- Enable TCR and TLR ---
+  Error = SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask);
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
+
+  //--- Disable Interrupts, Tx, Rx and clear FIFOs ----------
+  SC16IS7XX_IER_Register OriginalIER;
+  Error = __SC16IS7XX_ReadShadowedRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, &OriginalIER.IER); // Read and save configuration of the IER register
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling __SC16IS7XX_ReadShadowedRegister() then return the error
+  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, 0x00); // Disable all interrupts. And with this, the device sleep will be disabled
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+  Error = SC16IS7XX_TxRxDisable(pUART, true, true);                 // Disable Transmitter and receiver
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_TxRxDisable() then return the error
+  Error = SC16IS7XX_ResetFIFO(pUART, true, true);                   // Reset and clear Transmit and receive FIFOs
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_ResetFIFO() then return the error
+
+  //--- Disable control flow --------------------------------
+  Error = __SC16IS7XX_SetControlFlowConfiguration(pUART, NULL, NULL, NULL, false); // Disable the control flow
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling __SC16IS7XX_SetControlFlowConfiguration() then return the error
+
+  //--- Set UART configuration ------------------------------
+  Error = __SC16IS7XX_SetUARTConfiguration(pUART, pUARTConf);       // Configure UART
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_SetUARTConfiguration() then return the error
+
+  //--- Set Baudrate ----------------------------------------
+  Error = SC16IS7XX_SetUARTBaudRate(pUART, pUARTConf);              // Configure UART baudrate
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_SetUARTBaudRate() then return the error
+
+  //--- Set FIFO configuration ------------------------------
+  Error = __SC16IS7XX_ConfigureFIFOs(pUART, pUARTConf->UseFIFOs, pUARTConf->TxTrigLvl, pUARTConf->RxTrigLvl); // Configure FIFOs
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling __SC16IS7XX_ConfigureFIFOs() then return the error
+
+  //--- Return to original interrupt configuration ----------
+  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, OriginalIER.IER); // Re-enable previous interrupts with the sleep state if previously set
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+
+  //--- Transmitter and receiver configuration --------------
+  Error = SC16IS7XX_TxRxDisable(pUART, pUARTConf->DisableTransmitter, pUARTConf->DisableReceiver); // Disable Transmitter and receiver
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_TxRxDisable() then return the error
+
+  //--- Test UART connection --------------------------------
+  if (((pUART->DriverConfig & SC16IS7XX_TEST_LOOPBACK_AT_INIT) > 0) && (pUARTConf->DisableTransmitter == false) && (pUARTConf->DisableReceiver == false)) // If a UART loopback test is asked...
+  {
+    Error = SC16IS7XX_UARTCommTest(pUART);                          // Test the UART before Control Flow because the Control Flow may interfere with the test
+    if (Error != ERR_OK) return Error;                              // If there is an error while calling SC16IS7XX_UARTCommTest() then return the error
+  }
+
+  //--- Set Control Flow ------------------------------------
+  SC16IS7XX_HardControlFlow* pHardFlow = NULL;
+  SC16IS7XX_SoftControlFlow* pSoftFlow = NULL;
+  const uint8_t* pSpecialChar = (pUARTConf->UseSpecialChar ? &pUARTConf->SpecialChar : NULL);
+  bool UseAddressChar = false;
+  switch (pUARTConf->UARTtype)
+  {
+    case SC16IS7XX_UART_RS232:
+      switch (pUARTConf->RS232.ControlFlowType)
+      {
+        case SC16IS7XX_NO_CONTROL_FLOW:
+        default: break;
+        case SC16IS7XX_HARDWARE_CONTROL_FLOW: pHardFlow = &pConf->RS232.HardFlowControl; break;
+        case SC16IS7XX_SOFTWARE_CONTROL_FLOW: pSoftFlow = &pConf->RS232.SoftFlowControl; break;
+      }
+      break;
+    case SC16IS7XX_UART_RS485:
+      if (pUARTConf->RS485.UseHardwareControlFlow) pHardFlow = &pConf->RS485.HardFlowControl;
+      if (pUARTConf->RS485.AutoRS485mode == SC16IS7XX_AUTO_ADDRESS_DETECT) UseAddressChar = true;
+      break;
+    case SC16IS7XX_UART_IrDA:
+      if (pUARTConf->IrDA.UseSoftwareControlFlow)  pSoftFlow = &pConf->IrDA.SoftFlowControl;
+      break;
+    case SC16IS7XX_UART_Modem:
+      if (pUARTConf->Modem.UseHardwareControlFlow) pHardFlow = &pConf->Modem.HardFlowControl;
+      break;
+    default: break;
+  }
+  if ((pHardFlow != NULL) || (pSoftFlow != NULL) || (pSpecialChar != NULL))
+    Error = __SC16IS7XX_SetControlFlowConfiguration(pUART, pHardFlow, pSoftFlow, pSpecialChar, UseAddressChar); // Configure the control flow
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling __SC16IS7XX_SetControlFlowConfiguration() then return the error
+
+  //--- Disable TCR and TLR access --------------------------
+  if (SC16IS7XX_KEEP_TLR_ACCESS(pUART) == false)                    // Else the adaptive trigger levels write only TLR at runtime
+  {
+    Error = SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_DISABLE, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask);
+    if (Error != ERR_OK) return Error;                              // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
+  }
+
+  //--- Configure interrupts --------------------------------
+  return SC16IS7XX_ConfigureInterrupt(pUART, pConf->Interrupts);
+}
+
+
+
+//=============================================================================
+// UART communication tests of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_UARTCommTest(SC16IS7XX_UART *pUART)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  eERRORRESULT Error;
+  setSC16IS7XX_ReceiveError CharError;
+  char Value;
+
+  //--- Set UART in loopback mode ---
+  SC16IS7XX_MCR_Register RegMCR;
+  Error = __SC16IS7XX_ReadShadowedRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, &RegMCR.MCR); // Read the MCR register
+  if (Error != ERR_OK) return Error;                                                              // If there is an error while calling __SC16IS7XX_ReadShadowedRegister() then return the error
+  RegMCR.MCR |= SC16IS7XX_MCR_LOOPBACK_ENABLE;                                          // Set enable local Loopback mode (internal)
+  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegMCR.MCR); // Write the MCR register
+  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+
+  //--- Reset UART FIFOs ---
+  Error = SC16IS7XX_ResetFIFO(pUART, true, true);                                       // Reset both Transmit and Receive FIFOs
+  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ResetFIFO() then return the error
+
+  //--- Test UART communication ---
+  Error = SC16IS7XX_TransmitChar(pUART, (char)(0x55 & 0x1F));                           // Transmit char 0x55 (reduced to 5 bits for 5-bits compatibility) by UART
+  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_TransmitCharByUART() then return the error
+  Error = SC16IS7XX_ReceiveChar(pUART, &Value, &CharError);                             // Receive a char UART by UART
+  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ReceiveCharByUART() then return the error
+  if (CharError != SC16IS7XX_NO_RX_ERROR) return ERR__PERIPHERAL_NOT_VALID;             // If the received data create an error then the peripheral is not valid
+  if (Value != (char)(0x55 & 0x1F)) return ERR__PERIPHERAL_NOT_VALID;                   // If the read back value is not the same as the one written, return an error
+
+  Error = SC16IS7XX_TransmitChar(pUART, (char)(0xAA & 0x1F));                           // Transmit char 0xAA (reduced to 5 bits for 5-bits compatibility) by UART
+  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_TransmitCharByUART() then return the error
+  Error = SC16IS7XX_ReceiveChar(pUART, &Value, &CharError);                             // Receive a char UART by UART
+  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ReceiveCharByUART() then return the error
+  if (CharError != SC16IS7XX_NO_RX_ERROR) return ERR__PERIPHERAL_NOT_VALID;             // If the received data create an error then the peripheral is not valid
+  if (Value != (char)(0xAA & 0x1F)) return ERR__PERIPHERAL_NOT_VALID;                   // If the read back value is not the same as the one written, return an error
+
+  RegMCR.MCR &= SC16IS7XX_MCR_NORMAL_OPERATING_MODE;                                    // Set normal operating mode
+  return SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegMCR.MCR);  // Write the MCR register
+}
+
+
+
+//=============================================================================
+// [STATIC] Set UART configuration of the SC16IS7XX UART
+//=============================================================================
+// DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! UART configuration needs to be configured with a safe UART configuration to avoid spurious effects, which is done in the SC16IS7XX_InitUART() function
+eERRORRESULT __SC16IS7XX_SetUARTConfiguration(SC16IS7XX_UART *pUART, const SC16IS7XX_UARTconfig *pUARTConf)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pUART == NULL) || (pUARTConf == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  eERRORRESULT Error, ErrorReturn = 0;
+  SC16IS7XX_MCR_Register RegMCR;
+  SC16IS7XX_EFCR_Register RegEFCR;
+  SC16IS7XX_IOControl_Register RegIOC;
+  SC16IS7XX_EFR_Register RegEFR;
+  uint8_t RegIOCmask = 0x00;
+  RegEFCR.EFCR = SC16IS7XX_EFCR_IrDA_3_16_PULSE_RATIO | SC16IS7XX_EFCR_9BIT_MODE_DISABLE // Default configuration
+               | SC16IS7XX_EFCR_TX_NOT_CONTROL_RTS | SC16IS7XX_EFCR_NORMAL_RTS_PIN;
+
+  //--- Select the IO control mask ---
+  RegIOC.IOControl = SC16IS7XX_IOCTRL_GPIO7_4_AS_IO | SC16IS7XX_IOCTRL_GPIO3_0_AS_IO;
+  switch (pUART->Channel)
+  {
+    case SC16IS7XX_CHANNEL_A: RegIOCmask = SC16IS7XX_IOCTRL_UARTA_MODEM_MODE_Mask; break;
+    case SC16IS7XX_CHANNEL_B: RegIOCmask = SC16IS7XX_IOCTRL_UARTB_MODEM_MODE_Mask; break;
+    default: return ERR__UNKNOWN_ELEMENT;
+  }
+
+  //--- Configure the UART type ---
+  switch (pUARTConf->UARTtype)
+  {
+    case SC16IS7XX_UART_RS232:
+      RegMCR.MCR = SC16IS7XX_MCR_NORMAL_UART_MODE;
+      break;
+
+    case SC16IS7XX_UART_RS485:
+      RegMCR.MCR = SC16IS7XX_MCR_NORMAL_UART_MODE;
+      switch (pUARTConf->RS485.RTScontrol)
+      {
+        //--- Configure RTS mode ---
+        case SC16IS7XX_RS485_AUTO_RTS:
+          if (pUARTConf->RS485.UseHardwareControlFlow) return ERR__CONFIGURATION;          // If auto RTS mode then the hardware control flow shall not be used
+          RegEFCR.EFCR |= SC16IS7XX_EFCR_TX_CONTROL_RTS;                                   // Set automatic RTS mode
+          break;
+        case SC16IS7XX_RS485_HARD_FLOW_CONTROL_RTS:
+          if (pUARTConf->RS485.UseHardwareControlFlow == false) return ERR__CONFIGURATION; // If hardware control flow RTS mode then the hardware control flow shall be used
+          break;
+        case SC16IS7XX_RS485_MANUAL_EXTERNAL_RTS:
+          if (pUARTConf->RS485.UseHardwareControlFlow) return ERR__CONFIGURATION;          // If manual/external RTS mode then the hardware control flow shall not be used
+          break;
+        default: break;
+      }
+      if (pUARTConf->RS485.RTSoutInversion) RegEFCR.EFCR |= SC16IS7XX_EFCR_INVERT_RTS_PIN; // Invert RTS output if configured
+      //--- Configure RS-485 mode ---
+      switch (pUARTConf->RS485.AutoRS485mode)
+      {
+        case SC16IS7XX_NO_AUTO_RS485_MODE: break;
+        case SC16IS7XX_MULTIDROP_MODE: RegEFCR.EFCR |= SC16IS7XX_EFCR_9BIT_MODE_ENABLE; break;
+        case SC16IS7XX_AUTO_ADDRESS_DETECT:
+          RegEFCR.EFCR |= SC16IS7XX_EFCR_9BIT_MODE_ENABLE;
+          //--- Enable access to enhanced registers ---
+          SC16IS7XX_LCR_Register OriginalLCR;
+          Error = SC16IS7XX_SetRegisterAccess(pComp, pUART->Channel, SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER, &OriginalLCR.LCR);
+          if (Error != ERR_OK) return Error;                                                                        // If there is an error while calling SC16IS7XX_SetRegisterAccess() then return the error
+          //--- Configure the auto address detect ---
+          RegEFR.EFR = SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_ENABLE;
+          SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_EFR, RegEFR.EFR, SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_Mask); // Modify the EFR register
+          if (Error != ERR_OK) ErrorReturn = Error;                                                                 // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
+          Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XOFF2, pUARTConf->RS485.AddressChar); // Write the Address char in Xoff2 register
+          if (Error != ERR_OK) ErrorReturn = Error;                                                                 // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+          //--- Return access to general registers ---
+          Error = SC16IS7XX_ReturnAccessToGeneralRegister(pComp, pUART->Channel, OriginalLCR.LCR);                  // Return access to general registers
+          if (ErrorReturn != ERR_OK) return ErrorReturn;                                                            // If there is an error while Enhanced Features are enabled then return the error
+          if (Error != ERR_OK) return Error;                                                                        // If there is an error while calling SC16IS7XX_ReturnAccessToGeneralRegister() then return the error
+          break;
+        default: return ERR__CONFIGURATION;
+      }
+      break;
+
+    case SC16IS7XX_UART_IrDA:
+      RegMCR.MCR = SC16IS7XX_MCR_IrDA_MODE;                         // Set IrDA mode
+      RegEFCR.EFCR = SC16IS7XX_EFCR_IrDA_3_16_PULSE_RATIO;          // By default, set IrDA 3/16 pulse ratio
+      if (pUARTConf->IrDA.IrDAmode == SC16IS7XX_IrDA_SIR_1_4_RATIO) // If IrDA mode is 1/4 ratio
+      {
+        if (SC16IS7XX_LIMITS[pComp->DevicePN].IrDA_1_4_RATIO)       // If 1/4 ratio mode supported
+             RegEFCR.EFCR = SC16IS7XX_EFCR_IrDA_1_4_PULSE_RATIO;    // Then set the 1/4 ratio configuration
+        else return ERR__NOT_SUPPORTED;                             // Else return an error
+      }
+      break;
+
+    case SC16IS7XX_UART_Modem:
+      RegMCR.MCR = SC16IS7XX_MCR_NORMAL_UART_MODE;
+      switch (pUART->Channel)
+      {
+        case SC16IS7XX_CHANNEL_A: RegIOC.IOControl = SC16IS7XX_IOCTRL_GPIO7_4_AS_MODEM; break;
+        case SC16IS7XX_CHANNEL_B: RegIOC.IOControl = SC16IS7XX_IOCTRL_GPIO3_0_AS_MODEM; break;
+        default: return ERR__UNKNOWN_ELEMENT;
+      }
+      break;
+
+    default: return ERR__UNKNOWN_ELEMENT;
+  }
+
+  //--- Now apply parameters to registers ---
+  SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegMCR.MCR, SC16IS7XX_MCR_IrDA_MODE_Mask); // Modify the LCR register
+  if (Error != ERR_OK) return Error;                                                                           // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
+  SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_EFCR, RegEFCR.EFCR, SC16IS7XX_EFCR_LINE_CONTROL_MODE_Mask); // Modify the EFCR register
+  if (Error != ERR_OK) return Error;                                                                           // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
+  SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_IOControl, RegIOC.IOControl, RegIOCmask);       // Modify the IOControl register
+  if (Error != ERR_OK) return Error;                                                                           // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
+
+  //--- Configuration of the data communication format ---
+  SC16IS7XX_LCR_Register RegLCR;
+  RegLCR.LCR = SC16IS7XX_LCR_NO_BREAK_CONDITION | SC16IS7XX_LCR_DIVISOR_LATCH_DISABLE
+             | SC16IS7XX_LCR_DATA_LENGTH_SET(pUARTConf->UARTwordLen)                                                                 // UART word length
+             | (pUARTConf->UARTstopBit != SC16IS7XX_STOP_BIT_1bit ? SC16IS7XX_LCR_EXTENDED_STOP_BIT : SC16IS7XX_LCR_ONLY_1_STOP_BIT) // UART stop bit
+             | SC16IS7XX_LCR_PARITY_SET(pUARTConf->UARTparity);                                                                      // UART parity
+  return SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_LCR, RegLCR.LCR);                                               // Write the LCR register
+}
+
+
+
+//=============================================================================
+// Set UART baudrate of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_SetUARTBaudRate(SC16IS7XX_UART *pUART, const SC16IS7XX_UARTconfig *pUARTConf)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pUART == NULL) || (pUARTConf == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  eERRORRESULT Error;
+
+  //--- Check that the device is not in sleep mode ---
+  bool DeviceInSleepMode;
+  Error = SC16IS7XX_IsDeviceInSleepMode(pComp, &DeviceInSleepMode); // Ask if device is in sleep mode
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling SC16IS7XX_IsDeviceInSleepMode() then return the error
+  if (DeviceInSleepMode) return ERR__NOT_IN_SLEEP_MODE;             // To perform the set baudrate operation, the device should not be in sleep mode
+
+  //--- Limits tests ---
+  if ((pComp->XtalFreq != 0) && (pComp->XtalFreq < SC16IS7XX_FREQ_MIN     )) return ERR__FREQUENCY_ERROR; // The device crystal should not be < 1.6kHz (100 bauds min)
+  if ((pComp->XtalFreq != 0) && (pComp->XtalFreq > SC16IS7XX_XTAL_FREQ_MAX)) return ERR__FREQUENCY_ERROR; // The device crystal should not be > 24MHz
+  if ((pComp->OscFreq  != 0) && (pComp->OscFreq  < SC16IS7XX_FREQ_MIN     )) return ERR__FREQUENCY_ERROR; // The device oscillator should not be < 1.6kMHz (100 bauds min)
+  if ((pComp->OscFreq  != 0) && (pComp->OscFreq  > SC16IS7XX_OSC_FREQ_MAX )) return ERR__FREQUENCY_ERROR; // The device oscillator should not be > 80MHz
+  uint32_t CompFreq = 0;
+  if (pComp->XtalFreq != 0) CompFreq = pComp->XtalFreq; else CompFreq = pComp->OscFreq;                   // Select the device frequency
+  if (CompFreq == 0) return ERR__FREQUENCY_ERROR;                                                         // Both XtalFreq and OscFreq are configured to 0
+  if (pUARTConf->UARTbaudrate < SC16IS7XX_BAUDRATE_MIN) return ERR__BAUDRATE_ERROR;                       // The UART baudrate should not be < 100 bauds
+  if (pUARTConf->UARTbaudrate > SC16IS7XX_BAUDRATE_MAX) return ERR__BAUDRATE_ERROR;                       // In All modes the baudrate max is 5Mbauds
+  if (pUARTConf->UARTtype == SC16IS7XX_UART_IrDA)                                                         // If the device is in IrDA mode
+  {
+    if (pUARTConf->IrDA.IrDAmode == SC16IS7XX_IrDA_SIR_1_4_RATIO)
+    {
+      if (SC16IS7XX_LIMITS[pComp->DevicePN].IrDA_1_4_RATIO)
+      {
+        if (pUARTConf->UARTbaudrate > SC16IS76X_IrDA_SPEED_MAX) return ERR__BAUDRATE_ERROR;  // The UART baudrate should not be > max IrDA baudrate (SC16IS76X only)
+      }
+      else return ERR__NOT_SUPPORTED;                                                        // IrDA SIR 1/4 ratio not supported on SC16IS7XX who are not SC16IS76X
+    }
+    else if (pUARTConf->UARTbaudrate > SC16IS7XX_IrDA_SPEED_MAX) return ERR__BAUDRATE_ERROR; // The UART baudrate should not be > max IrDA baudrate
+  }
+
+  //--- Calculate Divisor with Prescaler = 1 and its error ---
+  uint32_t DivisorPrescaler1 = (uint32_t)(((float)CompFreq / ((float)pUARTConf->UARTbaudrate * 16.0f * 1.0f)) + 0.5f);          // (ComponentXtalFreq/1)/(DesiredBaudRate*16)+0.5 for rounding
+  if (DivisorPrescaler1 < 0x0001) DivisorPrescaler1 =     1;                                                                    // Cannot be < 1
+  if (DivisorPrescaler1 > 0xFFFF) DivisorPrescaler1 = 65535;                                                                    // Cannot be > 65535
+  float BaudRatePrescaler1 = (float)CompFreq / ((float)DivisorPrescaler1 * 16.0f * 1.0f);                                       // Get actual baudrate with prescaler set to 1
+  float ErrorPrescaler1    = ((BaudRatePrescaler1 - (float)pUARTConf->UARTbaudrate) * 100000) / (float)pUARTConf->UARTbaudrate; // Calculate error with prescaler set to 1
+  //--- Calculate Divisor with Prescaler = 4 and its error ---
+  uint32_t DivisorPrescaler4 = (uint32_t)(((float)CompFreq / ((float)pUARTConf->UARTbaudrate * 16.0f * 4.0f)) + 0.5f);          // (ComponentXtalFreq/4)/(DesiredBaudRate*16)+0.5 for rounding
+  if (DivisorPrescaler4 < 0x0001) DivisorPrescaler4 =     1;                                                                    // Cannot be < 1
+  if (DivisorPrescaler4 > 0xFFFF) DivisorPrescaler4 = 65535;                                                                    // Cannot be > 65535
+  float BaudRatePrescaler4 = (float)CompFreq / ((float)DivisorPrescaler4 * 16.0f * 4.0f);                                       // Get actual baudrate with prescaler set to 4
+  float ErrorPrescaler4    = ((BaudRatePrescaler4 - (float)pUARTConf->UARTbaudrate) * 100000) / (float)pUARTConf->UARTbaudrate; // Calculate error with prescaler set to 4
+
+  //--- Configure clock divisor ---
+  uint32_t DivPresToSet;
+  uint8_t RegValue = 0;
+  if (SC16IS7XX_ABSOLUTE(ErrorPrescaler1) < SC16IS7XX_ABSOLUTE(ErrorPrescaler4))
+  {                                                                                 // Set prescaler to 1 and set divisor for prescaler 1
+    *(pUARTConf->UARTbaudrateError) = (int32_t)ErrorPrescaler1;                     // Divide UARTbaudrateError by 1000 to get the real error
+    RegValue = SC16IS7XX_MCR_CLOCK_INPUT_DIVIDE_BY_1;                               // Set divide-by-1 clock input
+    DivPresToSet = DivisorPrescaler1;
+  }
+  else                                                                              // Set prescaler to 4 and set divisor for prescaler 4
+  {
+    *(pUARTConf->UARTbaudrateError) = (int32_t)ErrorPrescaler4;                     // Divide UARTbaudrateError by 1000 to get the real error
+    RegValue = SC16IS7XX_MCR_CLOCK_INPUT_DIVIDE_BY_4;                               // Set divide-by-4 clock input
+    DivPresToSet = DivisorPrescaler4;
+  }
+  Error = SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegValue, SC16IS7XX_MCR_CLOCK_INPUT_DIVIDE_Mask);
+  if (Error != ERR_OK) return Error;                                                // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+
+  //--- Set baudrate divisors ---
+  SC16IS7XX_LCR_Register OriginalLCR;
+  Error = SC16IS7XX_SetRegisterAccess(pComp, pUART->Channel, SC16IS7XX_LCR_VALUE_SET_SPECIAL_REGISTER, &OriginalLCR.LCR);
+  if (Error != ERR_OK) return Error;                                                // If there is an error while calling SC16IS7XX_SetRegisterAccess() then return the error
+
+  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_DLL, (uint8_t)(DivPresToSet & 0xFF)); // Write the DLL register
+  if (Error != ERR_OK) return Error;                                                                        // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_DLH, (uint8_t)(DivPresToSet >> 8));   // Write the DLH register
+  if (Error != ERR_OK) return Error;                                                                        // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+
+  //--- Return access to general registers ---
+  Error = SC16IS7XX_ReturnAccessToGeneralRegister(pComp, pUART->Channel, OriginalLCR.LCR); // Return access to general registers
+  if (Error != ERR_OK) return Error;                                                       // If there is an error while calling SC16IS7XX_ReturnAccessToGeneralRegister() then return the error
+
+  //--- Calculate the char duration ---
+  const uint32_t CharBits = 1u + (5u + (uint32_t)pUARTConf->UARTwordLen)                   // Start bit + data bits
+                          + (pUARTConf->UARTparity != SC16IS7XX_NO_PARITY ? 1u : 0u)       // + parity bit
+                          + (pUARTConf->UARTstopBit == SC16IS7XX_STOP_BIT_1bit ? 1u : 2u); // + stop bits (1.5 stop bit is rounded up)
+  pUART->CharTimeus = ((CharBits * 1000000u) + pUARTConf->UARTbaudrate - 1u) / pUARTConf->UARTbaudrate; // Rounded up to never poll too early
+  return ERR_OK;
+}
+
+
+
+//=============================================================================
+// [STATIC] Configure an UART Control Flow of the SC16IS7XX UART
+//=============================================================================
+// DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! Control Flow needs to be configured with a safe UART configuration to avoid spurious effects, which is done in the SC16IS7XX_InitUART() function
+eERRORRESULT __SC16IS7XX_SetControlFlowConfiguration(SC16IS7XX_UART *pUART, SC16IS7XX_HardControlFlow *pHardFlow, SC16IS7XX_SoftControlFlow *pSoftFlow, const uint8_t* pSpecialChar, bool useAddressChar)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  if ((pHardFlow != NULL) && (pSoftFlow != NULL)) return ERR__CONFIGURATION; // The user should not configure Hardware+Software control flow at the same time
+  eERRORRESULT Error, ErrorReturn = ERR_OK;
+  SC16IS7XX_EFR_Register RegEFR;
+  RegEFR.EFR = SC16IS7XX_EFR_SOFT_FLOW_CONTROL_SET(SC16IS7XX_NoTxCtrlFlow_NoRxCtrlFlow)   // Disable All Control Flows but keep Enhanced Functions Enabled
+             | SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE | SC16IS7XX_EFR_RTS_FLOW_CONTROL_DISABLE | SC16IS7XX_EFR_CTS_FLOW_CONTROL_DISABLE
+             | (useAddressChar ? SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_ENABLE : SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_DISABLE);
+
+  //--- Set Trigger Control Level ---
+  if ((pHardFlow != NULL) || (pSoftFlow != NULL))
+  {
+    eSC16IS7XX_TriggerCtrlLevel HoldAt, ResumeAt;
+    if (pHardFlow != NULL)
+         { HoldAt = pHardFlow->HoldAt; ResumeAt = pHardFlow->ResumeAt; }                  // Select the hardware control flow TCL
+    else { HoldAt = pSoftFlow->HoldAt; ResumeAt = pSoftFlow->ResumeAt; }                  // Select the software control flow TCL
+    if ((uint8_t)HoldAt <= (uint8_t)ResumeAt) return ERR__CONFIGURATION;                  // The TCR such that TCR[3:0] > TCR[7:4]. There is no built-in hardware check to make sure this condition is met
+    SC16IS7XX_TCR_Register RegTCR;
+    RegTCR.TCR = SC16IS7XX_TCR_HALT_TRIGGER_LEVEL_SET(HoldAt) | SC16IS7XX_TCR_RESUME_TRIGGER_LEVEL_SET(ResumeAt);
+    Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_TCR, RegTCR.TCR); // Write the TCR register
+    if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+  }
+
+  //--- Enable access to enhanced registers ---
+  SC16IS7XX_LCR_Register OriginalLCR;
+  Error = SC16IS7XX_SetRegisterAccess(pComp, pUART->Channel, SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER, &OriginalLCR.LCR);
+  if (Error != ERR_OK) ErrorReturn = Error;                                               // If there is an error while calling SC16IS7XX_SetRegisterAccess() then return the error
+
+  //--- Configure Control Flow ---
+  if (ErrorReturn == ERR_OK)
+  {
+    if ((pHardFlow != NULL) && (pSoftFlow == NULL))                                                  //*** Hardware Control Flow
+    {
+      RegEFR.EFR = SC16IS7XX_EFR_SOFT_FLOW_CONTROL_SET(SC16IS7XX_NoTxCtrlFlow_NoRxCtrlFlow)          // Disable Software Control Flow and keep Enhanced Functions Enabled
+                  | SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE | SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_DISABLE;
+      if (pHardFlow->RTSpinControl == SC16IS7XX_AUTOMATIC_PIN_CONTROL) RegEFR.EFR |= SC16IS7XX_EFR_RTS_FLOW_CONTROL_ENABLE;
+      if (pHardFlow->CTSpinControl == SC16IS7XX_AUTOMATIC_PIN_CONTROL) RegEFR.EFR |= SC16IS7XX_EFR_CTS_FLOW_CONTROL_ENABLE;
+      if ((pSpecialChar != NULL) && useAddressChar) ErrorReturn = ERR__CONFIGURATION;                // Impossible to have a special character detect AND address char used at the same time
+      if (useAddressChar) RegEFR.EFR |= SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_ENABLE;                    // Address char use the special character detect
+    }
+
+    if ((pHardFlow == NULL) && (pSoftFlow != NULL))                                                  //*** Software Control Flow
+    {
+      if ((pSpecialChar != NULL) && SC16IS7XX_IS_SOFT_CONTROL_FLOW_USES_XOFF2(pSoftFlow->Config)) ErrorReturn = ERR__CONFIGURATION; // Impossible to have a special char AND Xoff2 used in the control flow
+      RegEFR.EFR = SC16IS7XX_EFR_SOFT_FLOW_CONTROL_SET(pSoftFlow->Config)                            // Set Software Control Flow, keep Enhanced Functions Enabled, and disable Hardware Control Flow
+                  | SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE | SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_DISABLE
+                  | SC16IS7XX_EFR_RTS_FLOW_CONTROL_DISABLE | SC16IS7XX_EFR_CTS_FLOW_CONTROL_DISABLE;
+      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XON1, pSoftFlow->Xon1);    // Write the Xon1 register
+      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XON2, pSoftFlow->Xon2);    // Write the Xon2 register
+      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XOFF1, pSoftFlow->Xoff1);  // Write the Xoff1 register
+      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+      if (pSpecialChar == NULL) Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XOFF2, pSoftFlow->Xoff2); // Write the Xoff2 register
+      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+    }
+    if (pSpecialChar != NULL)
+    {
+      RegEFR.EFR |= SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_ENABLE;
+      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XOFF2, *pSpecialChar);     // Write the special char in the Xoff2 register
+      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+    }
+    Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_EFR, RegEFR.EFR);  // Write the EFR register
+    if (Error != ERR_OK) ErrorReturn = Error;                                              // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+  }
+
+  //--- Return access to general registers ---
+  Error = SC16IS7XX_ReturnAccessToGeneralRegister(pComp, pUART->Channel, OriginalLCR.LCR); // Return access to general registers
+  if (ErrorReturn != ERR_OK) return ErrorReturn;                                           // If there is an error while Enhanced Features are enabled then return the error
+  if (Error != ERR_OK) return Error;                                                       // If there is an error while calling SC16IS7XX_ReturnAccessToGeneralRegister() then return the error
+
+  //--- Set Xon Any if set ---
+  uint8_t RegValue = 0;
+  if ((pSoftFlow != NULL) && pSoftFlow->XonAnyChar) RegValue = SC16IS7XX_MCR_XON_ANY_FUNCTION_ENABLE; // Enable Xon Any function
+  return SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegValue, SC16IS7XX_MCR_XON_ANY_FUNCTION_Mask);
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// [STATIC] Configure interrupt of the SC16IS7XX device UART
+//=============================================================================
+// DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! UART configuration needs to be configured with a safe UART configuration to avoid spurious effects, which is done in the SC16IS7XX_InitUART() function
+eERRORRESULT __SC16IS7XX_ConfigureFIFOs(SC16IS7XX_UART *pUART, bool useFIFOs, eSC16IS7XX_IntTxTriggerLevel txTrigLvl, eSC16IS7XX_IntRxTriggerLevel rxTrigLvl)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  eERRORRESULT Error;
+
+  //--- FIFO enable ---
+  SC16IS7XX_FCR_Register RegFCR;
+  RegFCR.FCR = (useFIFOs ? SC16IS7XX_FCR_RX_TX_FIFO_ENABLE : SC16IS7XX_FCR_RX_TX_FIFO_DISABLE); // In this driver we use the TLR register to configure the Tx and Rx Trigger Level, so we let the Trigger Level at default value which is 0x00
+  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_FCR, RegFCR.FCR);         // Write the FCR register
+  if (Error != ERR_OK) return Error;                                                            // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+
+  //--- Set Trigger Level ---
+  SC16IS7XX_TLR_Register RegTLR;
+  RegTLR.TLR = SC16IS7XX_TLR_TX_FIFO_TRIGGER_LEVEL_SET(txTrigLvl) | SC16IS7XX_TLR_RX_FIFO_TRIGGER_LEVEL_SET(rxTrigLvl);
+  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_TLR, RegTLR.TLR);         // Write the TLR register
+#if defined(SC16IS7XX_USE_BUFFERS) && defined(SC16IS7XX_USE_ADAPTIVE_TRIGGER)
+  if ((Error == ERR_OK) && (pUART->pTriggerControl != NULL))
+  {
+    pUART->pTriggerControl->TxTrigger = (uint8_t)(txTrigLvl * SC16IS7XX_TRIGGER_LEVEL_STEP);      // Start the adaptive trigger levels at the configured values
+    pUART->pTriggerControl->RxTrigger = (uint8_t)(rxTrigLvl * SC16IS7XX_TRIGGER_LEVEL_STEP);
+  }
+#endif
+  return Error;
+}
+
+
+
+//=============================================================================
+// Reset Rx and/or Tx FIFO of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_ResetFIFO(SC16IS7XX_UART *pUART, bool resetTxFIFO, bool resetRxFIFO)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  eERRORRESULT Error;
+  SC16IS7XX_FCR_Register RegFCR;                                                                             // We need to fill the FCR register with the previous configuration because the FCR is a write only register
+
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+  //--- Get the FIFO enable configuration from the shadow FCR register if known ---
+  SC16IS7XX_ShadowRegisters* pShadow = &pComp->Shadow[pUART->Channel];
+  if ((pShadow->Valid[SC16IS7XX_BANK_GENERAL] & SC16IS7XX_SHADOW_REG_MASK(RegSC16IS7XX_FCR)) > 0)
+    RegFCR.FCR = (pShadow->Value[SC16IS7XX_BANK_GENERAL][RegSC16IS7XX_FCR] & SC16IS7XX_FCR_RX_TX_FIFO_ENABLE); // The shadow FCR register holds the last value written
+  else
+#endif
+  {
+    //--- Read the IIR register to get the FIFO enable configuration ---
+    SC16IS7XX_IIR_Register RegIIR;
+    Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_IIR, &RegIIR.IIR); // Read the IIR register
+    if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+    RegFCR.FCR = ((RegIIR.IIR & SC16IS7XX_IIR_FIFOs_ARE_ENABLE) > 0 ? SC16IS7XX_FCR_RX_TX_FIFO_ENABLE : 0x00); // We get the FIFO enable flag in the IIR register because it mirrors the contents of FCR[0]. In this driver we use the TLR register to configure the Tx and Rx Trigger Level, so we let the Trigger Level at default value which is 0x00
+  }
+
+  //--- Set the reset of FIFOs ---
+  if (resetRxFIFO) RegFCR.FCR |= SC16IS7XX_FCR_RESET_RX_FIFO;                                                // Clears the contents of the receive FIFO and resets the FIFO level logic (the Receive Shift Register is not cleared or altered). This bit will return to a logic 0 after clearing the FIFO
+  if (resetTxFIFO) RegFCR.FCR |= SC16IS7XX_FCR_RESET_TX_FIFO;                                                // Clears the contents of the transmit FIFO and resets the FIFO level logic (the Transmit Shift Register is not cleared or altered). This bit will return to a logic 0 after clearing the FIFO
+  return SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_FCR, RegFCR.FCR);                       // Write the FCR register
+}
+
+
+
+//=============================================================================
+// Set the Tx and Rx FIFO trigger levels of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_SetTriggerLevels(SC16IS7XX_UART *pUART, eSC16IS7XX_IntTxTriggerLevel txTrigLvl, eSC16IS7XX_IntRxTriggerLevel rxTrigLvl)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  eERRORRESULT Error;
+  const bool KeepTLRaccess = SC16IS7XX_KEEP_TLR_ACCESS(pUART);                                  // TCR and TLR access already enabled by the UART initialization
+
+  //--- Enable TCR and TLR access ---
+  if (KeepTLRaccess == false)
+  {
+    Error = SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask);
+    if (Error != ERR_OK) return Error;                                                          // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
+  }
+
+  //--- Set Trigger Level ---
+  SC16IS7XX_TLR_Register RegTLR;
+  RegTLR.TLR = SC16IS7XX_TLR_TX_FIFO_TRIGGER_LEVEL_SET(txTrigLvl) | SC16IS7XX_TLR_RX_FIFO_TRIGGER_LEVEL_SET(rxTrigLvl);
+  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_TLR, RegTLR.TLR);         // Write the TLR register
+  if (Error != ERR_OK) return Error;                                                            // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+#if defined(SC16IS7XX_USE_BUFFERS) && defined(SC16IS7XX_USE_ADAPTIVE_TRIGGER)
+  if (pUART->pTriggerControl != NULL)
+  {
+    pUART->pTriggerControl->TxTrigger = (uint8_t)(txTrigLvl * SC16IS7XX_TRIGGER_LEVEL_STEP);
+    pUART->pTriggerControl->RxTrigger = (uint8_t)(rxTrigLvl * SC16IS7XX_TRIGGER_LEVEL_STEP);
+  }
+#endif
+
+  //--- Disable TCR and TLR access ---
+  if (KeepTLRaccess) return ERR_OK;                                                             // Only TLR is written by the adaptive trigger levels
+  return SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_DISABLE, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask); // The MSR and SPR registers are not accessible while TCR and TLR access is enabled
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Enable/disable Transmitter and/or receiver of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_TxRxDisable(SC16IS7XX_UART *pUART, bool disableTx, bool disableRx)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+
+  SC16IS7XX_EFCR_Register RegEFCR;
+  RegEFCR.EFCR = SC16IS7XX_EFCR_TX_ENABLE | SC16IS7XX_EFCR_RX_ENABLE; // Initial value
+  if (disableTx) RegEFCR.EFCR |= SC16IS7XX_EFCR_TX_DISABLE;           // Disable Transmitter
+  if (disableRx) RegEFCR.EFCR |= SC16IS7XX_EFCR_RX_DISABLE;           // Disable Receiver
+  return SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_EFCR, RegEFCR.EFCR, SC16IS7XX_EFCR_TX_RX_DISABLE_Mask); // Modify the EFCR register
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Configure interrupt of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_ConfigureInterrupt(SC16IS7XX_UART *pUART, setSC16IS7XX_Interrupts interruptsFlags)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  return SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, (uint8_t)interruptsFlags & SC16IS7XX_INTERRUPTS_FLAGS_MASK); // Write the IER register
+}
+
+
+
+//=============================================================================
+// Get interrupt event of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_GetInterruptEvents(SC16IS7XX_UART *pUART, eSC16IS7XX_InterruptSource *interruptFlag)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  eERRORRESULT Error;
+  SC16IS7XX_IIR_Register RegIIR;
+
+  Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_IIR, &RegIIR.IIR);       // Read the IIR register
+  if (Error != ERR_OK) return Error;                                                          // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+  *interruptFlag = (eSC16IS7XX_InterruptSource)SC16IS7XX_IIR_INTERRUT_SOURCE_GET(RegIIR.IIR); // Extract interrupt
+  return ERR_OK;
+}
+
+
+
+//=============================================================================
+// Get status of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_GetUARTstatus(SC16IS7XX_UART *pUART, setSC16IS7XX_Status *statusFlag)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+  eERRORRESULT Error;
+
+  SC16IS7XX_LSR_Register RegLSR;
+  Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_LSR, &RegLSR.LSR); // Read the LSR register
+  *statusFlag = (setSC16IS7XX_Status)(RegLSR.LSR & SC16IS7XX_STATUS_Mask);
+  return Error;
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Get available space in the transmit FIFO of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_GetAvailableSpaceTxFIFO(SC16IS7XX_UART *pUART, uint8_t *availableSpace)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  return SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_TXLVL, availableSpace); // Read the TXLVL register
+}
+
+
+
+//=============================================================================
+// Get number of characters stored in receive FIFO of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_GetDataCountRxFIFO(SC16IS7XX_UART *pUART, uint8_t *dataCount)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  return SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_RXLVL, dataCount); // Read the RXLVL register
+}
+
+
+
+//=============================================================================
+// [STATIC] Read a chain of registers of the SC16IS7XX
+//=============================================================================
+eERRORRESULT __SC16IS7XX_ReadRegisterChain(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t *registerAddrs, uint8_t *registerValues, size_t count)
+{
+  eERRORRESULT Error = ERR_OK;
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  Error = __SC16IS7XX_WritePendingLCR(pComp, channel);                     // Write back a deferred LCR before accessing the registers
+  if (Error != ERR_OK) return Error;                                       // If there is an error while calling __SC16IS7XX_WritePendingLCR() then return the error
+#endif
+
+#ifdef SC16IS7XX_I2C_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
+  {
+    I2C_Interface* pI2C = GET_I2C_INTERFACE;
+# if defined(CHECK_NULL_PARAM)
+#   if defined(USE_DYNAMIC_INTERFACE)
+    if (pI2C == NULL) return ERR__PARAMETER_ERROR;
+#   endif
+    if (pI2C->fnI2C_Transfer == NULL) return ERR__PARAMETER_ERROR;
+# endif
+    uint8_t ChipAddrW = (pComp->I2Caddress & I2C_WRITE_ANDMASK);
+    uint8_t ChipAddrR = (ChipAddrW | I2C_READ_ORMASK);
+    for (size_t zReg = 0; zReg < count; ++zReg)
+    {
+      uint8_t Address = SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(registerAddrs[zReg]);
+      I2CInterface_Packet AddrPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, true, &Address, sizeof(uint8_t), false, I2C_WRITE_THEN_READ_FIRST_PART);
+      Error = pI2C->fnI2C_Transfer(pI2C, &AddrPacketDesc); // Transfer the address
+      if (Error == ERR__I2C_NACK) return ERR__NOT_READY;   // If the device receive a NAK, then the device is not ready
+      if (Error != ERR_OK) return Error;                   // If there is an error while calling fnI2C_Transfer() then return the Error
+      I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_RX_DATA_DESC(ChipAddrR, true, &registerValues[zReg], sizeof(uint8_t), true, I2C_WRITE_THEN_READ_SECOND_PART);
+      Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc); // Restart at first data read transfer, get the data and stop transfer at last byte
+      if (Error != ERR_OK)
+      {
+        __SC16IS7XX_EndFailedTransfer(pComp);              // The stop may not have been sent, free the bus
+        return Error;                                      // If there is an error while calling fnI2C_Transfer() then return the Error
+      }
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+      __SC16IS7XX_CountTransaction(pComp, channel, registerAddrs[zReg], sizeof(uint8_t), true); // Account the transaction
+#endif
+#ifdef SC16IS7XX_USE_TRACE
+      if (pComp->pTrace != NULL) __SC16IS7XX_TraceAccess(pComp, channel, registerAddrs[zReg], &registerValues[zReg], sizeof(uint8_t), SC16IS7XX_TRACE_READ); // Record the access
+#endif
+#ifdef SC16IS7XX_USE_TX_CREDIT
+      __SC16IS7XX_TrackTxCredit(pComp, channel, registerAddrs[zReg], &registerValues[zReg], sizeof(uint8_t), true); // Keep the Tx FIFO credit up to date
+#endif
+    }
+  }
+#endif
+#ifdef SC16IS7XX_SPI_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_SPI)
+  {
+    SPI_Interface* pSPI = GET_SPI_INTERFACE;
+# if defined(CHECK_NULL_PARAM)
+#   if defined(USE_DYNAMIC_INTERFACE)
+    if (pSPI == NULL) return ERR__PARAMETER_ERROR;
+#   endif
+    if (pSPI->fnSPI_Transfer == NULL) return ERR__PARAMETER_ERROR;
+# endif
+    uint8_t Buffer[2];
+    for (size_t zReg = 0; zReg < count; ++zReg)
+    {
+      Buffer[0] = SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(registerAddrs[zReg]) | SC16IS7XX_SPI_READ;
+      Buffer[1] = 0x00;                                                                    // Dummy byte to send while receiving the data
+      SPIInterface_Packet PacketDesc = SPI_INTERFACE_RX_DATA_DESC(&Buffer[0], sizeof(Buffer), true); // Prepare SPI packet description to use
+      Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);                                     // Transfer the address, get the data and stop transfer at last byte
+      if (Error != ERR_OK) return Error;                                                   // If there is an error while calling fnSPI_Transfer() then return the Error
+      registerValues[zReg] = Buffer[1];
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+      __SC16IS7XX_CountTransaction(pComp, channel, registerAddrs[zReg], sizeof(uint8_t), true); // Account the transaction
+#endif
+#ifdef SC16IS7XX_USE_TRACE
+      if (pComp->pTrace != NULL) __SC16IS7XX_TraceAccess(pComp, channel, registerAddrs[zReg], &registerValues[zReg], sizeof(uint8_t), SC16IS7XX_TRACE_READ); // Record the access
+#endif
+#ifdef SC16IS7XX_USE_TX_CREDIT
+      __SC16IS7XX_TrackTxCredit(pComp, channel, registerAddrs[zReg], &registerValues[zReg], sizeof(uint8_t), true); // Keep the Tx FIFO credit up to date
+#endif
+    }
+  }
+#endif
+  return Error;
+}
+
+
+
+//=============================================================================
+// Get a status snapshot of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_GetChannelSnapshot(SC16IS7XX_UART *pUART, SC16IS7XX_ChannelSnapshot *pSnapshot)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pUART == NULL) || (pSnapshot == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  static const uint8_t SnapshotRegisters[] = { RegSC16IS7XX_IIR, RegSC16IS7XX_LSR, RegSC16IS7XX_RXLVL, RegSC16IS7XX_TXLVL, RegSC16IS7XX_MSR, };
+  uint8_t Values[sizeof(SnapshotRegisters)];
+  eERRORRESULT Error;
+
+  Error = __SC16IS7XX_ReadRegisterChain(pComp, pUART->Channel, &SnapshotRegisters[0], &Values[0], sizeof(SnapshotRegisters)); // Read all registers of the snapshot
+  if (Error != ERR_OK) return Error;                                                                                          // If there is an error while calling __SC16IS7XX_ReadRegisterChain() then return the error
+  pSnapshot->InterruptSource   = (eSC16IS7XX_InterruptSource)SC16IS7XX_IIR_INTERRUT_SOURCE_GET(Values[0]);
+  pSnapshot->Status            = (setSC16IS7XX_Status)(Values[1] & SC16IS7XX_STATUS_Mask);
+  pSnapshot->LineStatus        = Values[1];
+  pSnapshot->RxFIFOcount       = Values[2];
+  pSnapshot->TxFIFOspace       = Values[3];
+  pSnapshot->ControlPinsStatus = Values[4];
+  if (SC16IS7XX_KEEP_TLR_ACCESS(pUART))                                                                                       // The chain read TCR instead of MSR
+    return SC16IS7XX_GetControlPinStatus(pUART, &pSnapshot->ControlPinsStatus);
+  return ERR_OK;
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+//=============================================================================
+// Try to transmit data to UART FIFO of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_TransmitData(SC16IS7XX_UART *pUART, uint8_t *data, size_t size, size_t *actuallySent)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pUART == NULL) || (data == NULL) || (actuallySent == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  const bool IsSafeTX = ((pUART->DriverConfig & SC16IS7XX_DRIVER_SAFE_TX) > 0);
+  eERRORRESULT Error;
+  *actuallySent = 0;
+
+#ifdef SC16IS7XX_USE_BUFFERS
+  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
+  const bool IsIRQservice = ((pUART->DriverConfig & SC16IS7XX_DRIVER_IRQ_SERVICE) > 0);
+  const bool UseTxBuffer = (pBuf->pData != NULL) && ((IsSafeTX == false) || IsIRQservice);
+  if (UseTxBuffer) *actuallySent = __SC16IS7XX_DataBuffToTxBuffer(pBuf, data, size);  // Move data to Tx buffer
+  if (IsIRQservice)
+  {
+    if (UseTxBuffer == false) return ERR__NULL_BUFFER;                                 // The Tx FIFO can only be written by SC16IS7XX_ServiceInterrupt()
+    return __SC16IS7XX_UnmaskTxInterrupt(pUART);                                       // The Tx buffer is sent by SC16IS7XX_ServiceInterrupt()
+  }
+#endif
+
+  //--- Get free space on Tx FIFO ---
+  uint8_t AvailableSpace;
+#ifdef SC16IS7XX_USE_TX_CREDIT
+  size_t DataToSendCount = size;
+# ifdef SC16IS7XX_USE_BUFFERS
+  if (UseTxBuffer) DataToSendCount = __SC16IS7XX_GetBufferDataCount(pBuf);             // Data are sent from the Tx buffer
+# endif
+  if (DataToSendCount > SC16IS7XX_FIFO_SIZE) DataToSendCount = SC16IS7XX_FIFO_SIZE;    // The Tx FIFO cannot take more at once
+  AvailableSpace = pComp->TxFIFOcredit[pUART->Channel];                                // The Tx FIFO has at least this space available
+  if ((size_t)AvailableSpace < DataToSendCount)                                        // Only read TXLVL when the credit is not enough to send all the data
+#endif
+  {
+    Error = SC16IS7XX_GetAvailableSpaceTxFIFO(pUART, &AvailableSpace);                 // Get how many space there is in the transmit FIFO
+    if (Error != ERR_OK) return Error;                                                 // If there is an error while calling SC16IS7XX_GetAvailableSpaceTxFIFO() then return the error
+  }
+
+  //--- Send data if possible ---
+  if (IsSafeTX)                                                                        //*** Safe transmit
+  {
+    size_t CountToSend = (size > (size_t)AvailableSpace ? (size_t)AvailableSpace : size);
+    while (CountToSend > 0)
+    {
+      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_THR, *data);
+      if (Error != ERR_OK) return Error;                                               // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+      ++(*actuallySent);
+      ++data;
+      --CountToSend;
+    }
+  }
+  else                                                                                 //*** Burst transmit
+  {
+#ifdef SC16IS7XX_USE_BUFFERS
+    if (UseTxBuffer)
+    {
+      Error = __SC16IS7XX_TxBufferToTxFIFO(pUART, AvailableSpace);                     // Send all possible data, with one burst per contiguous part of the Tx buffer
+      if (Error != ERR_OK) return Error;                                               // If there is an error while calling __SC16IS7XX_TxBufferToTxFIFO() then return the error
+      *actuallySent += __SC16IS7XX_DataBuffToTxBuffer(pBuf, &data[*actuallySent], (size - *actuallySent)); // Move remaining data to the space freed in the Tx buffer
+      return ERR_OK;
+    }
+#endif
+    *actuallySent = (size > (size_t)AvailableSpace ? (size_t)AvailableSpace : size);   // Set how many data will actually be sent
+    return __SC16IS7XX_WriteData(pComp, pUART->Channel, RegSC16IS7XX_THR, data, *actuallySent); // Send all possible data at once
+  }
+  return ERR_OK;
+}
+
+#ifdef USE_GENERICS_DEFINED
+eERRORRESULT SC16IS7XX_TransmitData_Gen(UART_Interface *pIntDev, uint8_t *data, size_t size, size_t *actuallySent)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX_UART* pUART = (SC16IS7XX_UART*)(pIntDev->InterfaceDevice); // Get the SC16IS7XX_UART device of this UART port
+  return SC16IS7XX_TransmitData(pUART, data, size, actuallySent);
+}
+#endif
+
+
+
+//=============================================================================
+// Try to transmit data of several segments to UART FIFO of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_TransmitDataV(SC16IS7XX_UART *pUART, const SC16IS7XX_TxSegment *segments, size_t segmentCount, size_t *segmentIndex, size_t *segmentOffset)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pUART == NULL) || (segments == NULL) || (segmentIndex == NULL) || (segmentOffset == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  const bool IsSafeTX = ((pUART->DriverConfig & SC16IS7XX_DRIVER_SAFE_TX) > 0);
+  eERRORRESULT Error;
+  if (*segmentIndex > segmentCount) return ERR__OUT_OF_RANGE;
+  if ((*segmentIndex == segmentCount) && (*segmentOffset != 0)) return ERR__OUT_OF_RANGE;    // There is no segment to have an offset in
+  if ((*segmentIndex < segmentCount) && (*segmentOffset > segments[*segmentIndex].Size)) return ERR__OUT_OF_RANGE;
+  __SC16IS7XX_AdvanceSegments(segments, segmentCount, segmentIndex, segmentOffset, 0); // Skip the empty segments and the segment completely sent
+
+  //--- Count data to send ---
+  size_t DataToSendCount = 0;
+  for (size_t zSeg = *segmentIndex; zSeg < segmentCount; ++zSeg) DataToSendCount += segments[zSeg].Size;
+  DataToSendCount -= *segmentOffset;
+#ifdef SC16IS7XX_USE_BUFFERS
+  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
+  const bool IsIRQservice = ((pUART->DriverConfig & SC16IS7XX_DRIVER_IRQ_SERVICE) > 0);
+  const bool UseTxBuffer = (pBuf->pData != NULL) && ((IsSafeTX == false) || IsIRQservice);
+  if (UseTxBuffer)
+  {
+    __SC16IS7XX_SegmentsToTxBuffer(pBuf, segments, segmentCount, segmentIndex, segmentOffset); // Move data to Tx buffer
+    DataToSendCount = __SC16IS7XX_GetBufferDataCount(pBuf);                                    // Data are sent from the Tx buffer
+  }
+  if (IsIRQservice)
+  {
+    if (UseTxBuffer == false) return ERR__NULL_BUFFER;                                         // The Tx FIFO can only be written by SC16IS7XX_ServiceInterrupt()
+    return __SC16IS7XX_UnmaskTxInterrupt(pUART);                                               // The Tx buffer is sent by SC16IS7XX_ServiceInterrupt()
+  }
+#endif
+  if (DataToSendCount == 0) return ERR_OK;
+
+  //--- Get free space on Tx FIFO ---
+  uint8_t AvailableSpace;
+#ifdef SC16IS7XX_USE_TX_CREDIT
+  AvailableSpace = pComp->TxFIFOcredit[pUART->Channel];                                // The Tx FIFO has at least this space available
+  if ((size_t)AvailableSpace < (DataToSendCount > SC16IS7XX_FIFO_SIZE ? SC16IS7XX_FIFO_SIZE : DataToSendCount)) // Only read TXLVL when the credit is not enough to send all the data
+#endif
+  {
+    Error = SC16IS7XX_GetAvailableSpaceTxFIFO(pUART, &AvailableSpace);                 // Get how many space there is in the transmit FIFO
+    if (Error != ERR_OK) return Error;                                                 // If there is an error while calling SC16IS7XX_GetAvailableSpaceTxFIFO() then return the error
+  }
+  size_t CountToSend = (DataToSendCount > (size_t)AvailableSpace ? (size_t)AvailableSpace : DataToSendCount);
+
+  //--- Send data if possible ---
+  if (IsSafeTX)                                                                        //*** Safe transmit
+  {
+    while (CountToSend > 0)
+    {
+      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_THR, segments[*segmentIndex].pData[*segmentOffset]);
+      if (Error != ERR_OK) return Error;                                               // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+      __SC16IS7XX_AdvanceSegments(segments, segmentCount, segmentIndex, segmentOffset, 1);
+      --CountToSend;
+    }
+  }
+  else                                                                                 //*** Burst transmit
+  {
+#ifdef SC16IS7XX_USE_BUFFERS
+    if (UseTxBuffer)
+    {
+      Error = __SC16IS7XX_TxBufferToTxFIFO(pUART, AvailableSpace);                     // Send all possible data, with one burst per contiguous part of the Tx buffer
+      if (Error != ERR_OK) return Error;                                               // If there is an error while calling __SC16IS7XX_TxBufferToTxFIFO() then return the error
+      __SC16IS7XX_SegmentsToTxBuffer(pBuf, segments, segmentCount, segmentIndex, segmentOffset); // Move remaining data to the space freed in the Tx buffer
+      return ERR_OK;
+    }
+#endif
+    Error = __SC16IS7XX_WriteDataV(pComp, pUART->Channel, RegSC16IS7XX_THR, segments, *segmentIndex, *segmentOffset, (uint8_t)CountToSend); // Send all possible data at once, across the segments
+    if (Error != ERR_OK) return Error;                                                 // If there is an error while calling __SC16IS7XX_WriteDataV() then return the error
+    __SC16IS7XX_AdvanceSegments(segments, segmentCount, segmentIndex, segmentOffset, CountToSend);
+  }
+  return ERR_OK;
+}
+
+
+
+//=============================================================================
+// [STATIC] Move a position in segments by count data
+//=============================================================================
+void __SC16IS7XX_AdvanceSegments(const SC16IS7XX_TxSegment *segments, size_t segmentCount, size_t *segmentIndex, size_t *segmentOffset, size_t count)
+{
+  *segmentOffset += count;
+  while ((*segmentIndex < segmentCount) && (*segmentOffset >= segments[*segmentIndex].Size))
+  {
+    *segmentOffset -= segments[*segmentIndex].Size;                            // Go to the next segment
+    ++(*segmentIndex);
+  }
+}
+
+
+
+//=============================================================================
+// Transmit a char to UART FIFO of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_TransmitChar(SC16IS7XX_UART *pUART, const char data)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  eERRORRESULT Error;
+  uint8_t DataToSend = (uint8_t)data;
+  size_t ActuallySent = 0;
+  const uint32_t StartTime = (pComp->fnGetCurrentms != NULL ? pComp->fnGetCurrentms() : 0u); // Start time of the timeout
+  while (true)
+  {
+    Error = SC16IS7XX_TransmitData(pUART, &DataToSend, 1, &ActuallySent);
+    if (Error != ERR_OK) return Error;                       // If there is an error while calling SC16IS7XX_TransmitData() then return the error
+    if (ActuallySent > 0) break;
+    Error = __SC16IS7XX_WaitBeforePoll(pUART, StartTime, 1); // The Tx FIFO is full, one char shall be sent before a new try
+    if (Error != ERR_OK) return Error;                       // If there is an error while calling __SC16IS7XX_WaitBeforePoll() then return the error
+  }
+  return ERR_OK;
+}
+
+
+
+#ifdef SC16IS7XX_USE_BUFFERS
+//=============================================================================
+// Flush data from UART Tx Buffer to the FIFO of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_FlushTxBufferToFIFO(SC16IS7XX_UART *pUART)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  if ((pUART->DriverConfig & SC16IS7XX_DRIVER_IRQ_SERVICE) > 0) return ERR__NOT_AVAILABLE; // The Tx FIFO can only be written by SC16IS7XX_ServiceInterrupt()
+  size_t ActuallySent;   // Dummy
+  uint8_t DummyByte = 0; // Dummy
+  return SC16IS7XX_TransmitData(pUART, &DummyByte, 0, &ActuallySent); // This will put 0 bytes into Tx FIFO and will trigger a send to UART Tx FIFO
+}
+
+
+
+//=============================================================================
+// Reserve space in the Tx Buffer of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_TxReserve(SC16IS7XX_UART *pUART, size_t maxLen, uint8_t **ptr, size_t *contiguousLen)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pUART == NULL) || (ptr == NULL) || (contiguousLen == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
+  *contiguousLen = 0;
+  if (pBuf->pData == NULL) return ERR__NULL_BUFFER;
+  const size_t AvailableBufSize = __SC16IS7XX_GetBufferContiguousSpace(pBuf);
+  if (AvailableBufSize == 0) return ERR__BUFFER_FULL;
+  *ptr = &pBuf->pData[SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosIn)];            // Reserved space starts at In position
+  *contiguousLen = (maxLen > AvailableBufSize ? AvailableBufSize : maxLen);
+  return ERR_OK;
+}
+
+
+
+//=============================================================================
+// Commit data written in the reserved space of the Tx Buffer of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_TxCommit(SC16IS7XX_UART *pUART, size_t len)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
+  if (pBuf->pData == NULL) return ERR__NULL_BUFFER;
+  if (len == 0) return ERR_OK;
+  if (len > __SC16IS7XX_GetBufferContiguousSpace(pBuf)) return ERR__OUT_OF_RANGE; // More than the space that can be reserved
+  __SC16IS7XX_AdvanceBufferIn(pBuf, len);                                    // Publish the data written
+  return __SC16IS7XX_UnmaskTxInterrupt(pUART);                               // Start the interrupt service of the Tx buffer if it was idle
+}
+
+
+
+//=============================================================================
+// Send formatted data to the Tx Buffer of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_Printf(SC16IS7XX_UART *pUART, const char *format, ...)
+{
+  va_list Args;
+  va_start(Args, format);
+  const eERRORRESULT Error = SC16IS7XX_VPrintf(pUART, format, Args);
+  va_end(Args);
+  return Error;
+}
+
+
+
+//=============================================================================
+// Send formatted data with a va_list to the Tx Buffer of the SC16IS7XX UART
+//=============================================================================
+#define SC16IS7XX_PRINTF_DIGITS_SIZE  ( 22 ) // An unsigned long long in octal needs 22 digits
+
+eERRORRESULT SC16IS7XX_VPrintf(SC16IS7XX_UART *pUART, const char *format, va_list args)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pUART == NULL) || (format == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
+  if ((pBuf->pData == NULL) || ((pUART->DriverConfig & SC16IS7XX_DRIVER_SAFE_TX) > 0)) return ERR__NULL_BUFFER; // The chars are written in the Tx buffer, which is not used with SC16IS7XX_DRIVER_SAFE_TX
+  SC16IS7XX_PrintfWriter Writer;
+  Writer.pUART     = pUART;
+  Writer.PosIn     = pBuf->PosIn;
+  Writer.Pending   = 0;
+  Writer.Space     = SC16IS7XX_BUFFER_CAPACITY(pBuf) - __SC16IS7XX_GetBufferDataCount(pBuf);
+  Writer.StartTime = (pComp->fnGetCurrentms != NULL ? pComp->fnGetCurrentms() : 0u); // Start time of the timeout
+  Writer.Error     = ERR_OK;
+  eERRORRESULT FormatError = ERR_OK;
+  char Digits[SC16IS7XX_PRINTF_DIGITS_SIZE];
+  char* const pDigitsEnd = &Digits[SC16IS7XX_PRINTF_DIGITS_SIZE];
+
+  while ((*format != '\0') && (Writer.Error == ERR_OK))
+  {
+    if (*format != '%') { __SC16IS7XX_PrintfChar(&Writer, *format); ++format; continue; }
+    ++format;
+
+    //--- Get flags ---
+    bool LeftAlign = false, ZeroPad = false, AltForm = false;
+    char SignChar = '\0';
+    for (;; ++format)
+    {
+      if (*format == '-') LeftAlign = true;
+      else if (*format == '0') ZeroPad = true;
+      else if (*format == '#') AltForm = true;
+      else if (*format == '+') SignChar = '+';
+      else if ((*format == ' ') && (SignChar == '\0')) SignChar = ' ';
+      else break;
+    }
+    //--- Get width ---
+    int Width = 0;
+    if (*format == '*')
+    {
+      Width = va_arg(args, int);
+      if (Width < 0) { LeftAlign = true; Width = -Width; }                   // A negative width is a left alignment
+      ++format;
+    }
+    else while ((*format >= '0') && (*format <= '9')) { Width = (Width * 10) + (*format - '0'); ++format; }
+    //--- Get precision ---
+    int Precision = -1;
+    if (*format == '.')
+    {
+      ++format;
+      Precision = 0;
+      if (*format == '*') { Precision = va_arg(args, int); ++format; }       // A negative precision is like no precision
+      else while ((*format >= '0') && (*format <= '9')) { Precision = (Precision * 10) + (*format - '0'); ++format; }
+    }
+    //--- Get length ---
+    int LongCount = 0, HalfCount = 0;
+    while ((*format == 'l') || (*format == 'h'))
+    {
+      if (*format == 'l') ++LongCount; else ++HalfCount;
+      ++format;
+    }
+    if ((*format == 'j') || (*format == 'z') || (*format == 't') || (*format == 'L')) { FormatError = ERR__PARAMETER_ERROR; break; } // Not supported length modifier, the value cannot be taken from args
+
+    //--- Convert ---
+    const char Conversion = *format;
+    if (Conversion == '\0') break;
+    ++format;
+    switch (Conversion)
+    {
+      case 'c':
+        {
+          const char Char = (char)va_arg(args, int);
+          __SC16IS7XX_PrintfField(&Writer, NULL, 0, 0, &Char, 1, (size_t)Width, LeftAlign);
+        }
+        break;
+      case 's':
+        {
+          const char* pStr = va_arg(args, const char*);
+          if (pStr == NULL) pStr = "(null)";
+          size_t Length = 0;
+          while (((Precision < 0) || (Length < (size_t)Precision)) && (pStr[Length] != '\0')) ++Length; // The precision is the max chars of the string
+          __SC16IS7XX_PrintfField(&Writer, NULL, 0, 0, pStr, Length, (size_t)Width, LeftAlign);
+        }
+        break;
+      case 'd':
+      case 'i':
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+      case 'p':
+        {
+          unsigned long long Value;
+          unsigned int Base = 10;
+          char Prefix[3];
+          size_t PrefixLen = 0;
+          if ((Conversion == 'd') || (Conversion == 'i'))
+          {
+            long long SignedValue = (LongCount >= 2 ? va_arg(args, long long) : (LongCount == 1 ? (long long)va_arg(args, long) : (long long)va_arg(args, int)));
+            if (HalfCount == 1) SignedValue = (short)SignedValue;                // 'h' and 'hh' values are promoted to int, convert them back
+            if (HalfCount >= 2) SignedValue = (signed char)SignedValue;
+            Value = (SignedValue < 0 ? (0ull - (unsigned long long)SignedValue) : (unsigned long long)SignedValue);
+            if (SignedValue < 0) Prefix[PrefixLen++] = '-';
+            else if (SignChar != '\0') Prefix[PrefixLen++] = SignChar;
+          }
+          else if (Conversion == 'p')
+          {
+            Value = (unsigned long long)(uintptr_t)va_arg(args, void*);
+            Base = 16;
+            AltForm = true;
+          }
+          else
+          {
+            Value = (LongCount >= 2 ? va_arg(args, unsigned long long) : (LongCount == 1 ? (unsigned long long)va_arg(args, unsigned long) : (unsigned long long)va_arg(args, unsigned int)));
+            if (HalfCount == 1) Value = (unsigned short)Value;                   // 'h' and 'hh' values are promoted to int, convert them back
+            if (HalfCount >= 2) Value = (unsigned char)Value;
+            if (Conversion == 'o') Base = 8;
+            if ((Conversion == 'x') || (Conversion == 'X')) Base = 16;
+          }
+          if (AltForm && (Value != 0) && (Base == 16))
+          {
+            Prefix[PrefixLen++] = '0';
+            Prefix[PrefixLen++] = (Conversion == 'X' ? 'X' : 'x');
+          }
+          const char* pDigits = pDigitsEnd;
+          if ((Value != 0) || (Precision != 0)) pDigits = __SC16IS7XX_PrintfUintToStr(pDigitsEnd, Value, Base, (Conversion == 'X')); // A 0 value with a 0 precision has no digits
+          const size_t DigitCount = (size_t)(pDigitsEnd - pDigits);
+          size_t ZeroCount = 0;
+          if ((Precision >= 0) && ((size_t)Precision > DigitCount)) ZeroCount = (size_t)Precision - DigitCount; // The precision is the min digits of the value
+          if (AltForm && (Base == 8) && (ZeroCount == 0) && ((DigitCount == 0) || (*pDigits != '0')))
+            Prefix[PrefixLen++] = '0';                                           // The alternate octal form starts with a 0 digit
+          if (ZeroPad && (LeftAlign == false) && (Precision < 0) && ((size_t)Width > (PrefixLen + DigitCount)))
+            ZeroCount = (size_t)Width - (PrefixLen + DigitCount);                // Fill the width with zeros after the prefix
+          __SC16IS7XX_PrintfField(&Writer, &Prefix[0], PrefixLen, ZeroCount, pDigits, DigitCount, (size_t)Width, LeftAlign);
+        }
+        break;
+      case '%':
+        __SC16IS7XX_PrintfChar(&Writer, '%');
+        break;
+      default:                                                               // Not supported conversion (like floating point or 'n'), its argument cannot be skipped
+        FormatError = ERR__PARAMETER_ERROR;
+        break;
+    }
+    if (FormatError != ERR_OK) break;                                        // The next args would be taken from the wrong slots
+  }
+
+  //--- Send the formatted data ---
+  __SC16IS7XX_PrintfFlush(&Writer, false);                                   // Publish the last chars and flush the Tx buffer to the Tx FIFO once
+  return (Writer.Error != ERR_OK ? Writer.Error : FormatError);
+}
+#endif
+
+
+
+//=============================================================================
+// Flush all data in TxBuffer, UART FIFO and TSR empty of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_WaitEndTx(SC16IS7XX_UART *pUART)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+  eERRORRESULT Error;
+  const uint32_t StartTime = (pComp->fnGetCurrentms != NULL ? pComp->fnGetCurrentms() : 0u); // Start time of the timeout
+
+#ifdef SC16IS7XX_USE_BUFFERS
+  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
+  //--- Flush Tx buffer ---
+  if (pBuf->pData != NULL)
+    while (pBuf->PosIn != pBuf->PosOut)
+    {
+      Error = SC16IS7XX_FlushTxBufferToFIFO(pUART);
+      if ((Error != ERR_OK) && (Error != ERR__BUSY) && (Error != ERR__SPI_BUSY) && (Error != ERR__I2C_BUSY)) return Error; // If there is an error while calling SC16IS7XX_FlushTxBufferToFIFO() then return the error
+      const size_t DataCount = __SC16IS7XX_GetBufferDataCount(pBuf);
+      if (DataCount == 0) break;
+      Error = __SC16IS7XX_WaitBeforePoll(pUART, StartTime, (uint32_t)(DataCount > SC16IS7XX_FIFO_SIZE ? SC16IS7XX_FIFO_SIZE : DataCount)); // The Tx FIFO is full, wait the room for the remaining data
+      if (Error != ERR_OK) return Error;                                                                                                     // If there is an error while calling __SC16IS7XX_WaitBeforePoll() then return the error
+    }
+#endif
+
+  //--- Wait end FIFO empty and TSR empty ---
+  SC16IS7XX_LSR_Register RegLSR;
+  while (true)
+  {
+    Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_LSR, &RegLSR.LSR); // Read the LSR register
+    if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+    if (SC16IS7XX_IS_THR_AND_TSR_EMPTY(RegLSR.LSR)) break;
+    uint8_t TxFIFOspace = SC16IS7XX_FIFO_SIZE;                                            // Without fnSleep, there is no need to know the Tx FIFO fill
+    if (pComp->fnSleep != NULL)
+    {
+      Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_TXLVL, &TxFIFOspace); // Read the TXLVL register
+      if (Error != ERR_OK) return Error;                                                       // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+      if (TxFIFOspace > SC16IS7XX_FIFO_SIZE) TxFIFOspace = SC16IS7XX_FIFO_SIZE;
+    }
+    Error = __SC16IS7XX_WaitBeforePoll(pUART, StartTime, (SC16IS7XX_FIFO_SIZE - TxFIFOspace) + 1u); // Wait the data in the Tx FIFO and the char in the TSR
+    if (Error != ERR_OK) return Error;                                                          // If there is an error while calling __SC16IS7XX_WaitBeforePoll() then return the error
+  }
+  return ERR_OK;
+}
+
+
+
+//=============================================================================
+// [STATIC] Check the timeout and sleep before polling again the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT __SC16IS7XX_WaitBeforePoll(SC16IS7XX_UART *pUART, uint32_t startTime, uint32_t charCount)
+{
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+  if ((pComp->BlockingTimeoutms > 0) && (pComp->fnGetCurrentms != NULL))
+  {
+    const uint32_t Currentms = pComp->fnGetCurrentms();                                                   // Read once, SC16IS7XX_TIME_DIFF() uses its arguments more than once
+    if (SC16IS7XX_TIME_DIFF(startTime, Currentms) >= pComp->BlockingTimeoutms) return ERR__TIMEOUT;       // The blocking function waits for too long
+  }
+  if (pComp->fnSleep != NULL) pComp->fnSleep(pComp, charCount * pUART->CharTimeus);                             // Sleep the time needed to transfer charCount chars on the UART line
+  return ERR_OK;
+}
+
+
+
+
+
+//**********************************************************************************************************************************************************
+#ifdef SC16IS7XX_USE_BUFFERS
+//=============================================================================
+// [STATIC] Get the count of data stored in a buffer of the UART
+//=============================================================================
+size_t __SC16IS7XX_GetBufferDataCount(SC16IS7XX_Buffer* const pBuf)
+{
+  const size_t PosIn  = pBuf->PosIn;                                           // Take a snapshot of the positions
+  const size_t PosOut = pBuf->PosOut;
+  SC16IS7XX_MEMORY_BARRIER();                                                  // Data accesses shall not be done before the positions read
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+  return PosIn - PosOut;                                                       // Free-running positions, works across the size_t overflow
+#else
+  if (PosIn >= PosOut) return PosIn - PosOut;
+  return pBuf->BufferSize - PosOut + PosIn;                                    // The data wrap at the end of the buffer
+#endif
+}
+
+
+
+//=============================================================================
+// [STATIC] Get the count of free space in a buffer of the UART up to the end of the buffer or the out position
+//=============================================================================
+size_t __SC16IS7XX_GetBufferContiguousSpace(SC16IS7XX_Buffer* const pBuf)
+{
+  const size_t PosIn  = pBuf->PosIn;
+  const size_t PosOut = pBuf->PosOut;                                        // Take a snapshot of the consumer position
+  SC16IS7XX_MEMORY_BARRIER();                                                // Data writes shall not be done before the consumer position read
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+  const size_t FreeSize  = pBuf->BufferSize - (PosIn - PosOut);              // Calculate space available
+  const size_t EndSize   = pBuf->BufferSize - SC16IS7XX_BUFFER_INDEX(pBuf, PosIn); // Calculate space to the end of buffer
+  return (FreeSize > EndSize ? EndSize : FreeSize);
+#else
+  if (PosIn >= PosOut) return pBuf->BufferSize - PosIn - (PosOut == 0 ? 1 : 0); // Calculate space available to the end of buffer, keep one free byte if Out position is at the start
+  return PosOut - PosIn - 1;                                                 // Calculate space available to Out position, keep one free byte
+#endif
+}
+
+
+
+//=============================================================================
+// [STATIC] Get the count of data in a buffer of the UART up to the end of the buffer or the in position
+//=============================================================================
+size_t __SC16IS7XX_GetBufferContiguousData(SC16IS7XX_Buffer* const pBuf)
+{
+  const size_t PosIn  = pBuf->PosIn;                                         // Take a snapshot of the producer position
+  const size_t PosOut = pBuf->PosOut;
+  SC16IS7XX_MEMORY_BARRIER();                                                // Data reads shall not be done before the producer position read
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+  const size_t DataCount = PosIn - PosOut;                                   // Calculate data available
+  const size_t EndSize   = pBuf->BufferSize - SC16IS7XX_BUFFER_INDEX(pBuf, PosOut); // Calculate data to the end of buffer
+  return (DataCount > EndSize ? EndSize : DataCount);
+#else
+  if (PosIn >= PosOut) return PosIn - PosOut;                                // Calculate data available to In position
+  return pBuf->BufferSize - PosOut;                                          // Calculate data available to the end of buffer
+#endif
+}
+
+
+
+//=============================================================================
+// [STATIC] Publish data added to a buffer of the UART by moving its in position
+//=============================================================================
+void __SC16IS7XX_AdvanceBufferIn(SC16IS7XX_Buffer* const pBuf, size_t count)
+{
+  size_t PosIn = pBuf->PosIn + count;                                        // Increment In position
+#ifndef SC16IS7XX_USE_POW2_BUFFERS
+  if (PosIn >= pBuf->BufferSize) PosIn -= pBuf->BufferSize;                  // Correct In position
+#endif
+  SC16IS7XX_MEMORY_BARRIER();                                                // Data writes shall be done before the consumer sees the new position
+  pBuf->PosIn = PosIn;
+}
+
+
+
+//=============================================================================
+// [STATIC] Release data removed from a buffer of the UART by moving its out position
+//=============================================================================
+void __SC16IS7XX_AdvanceBufferOut(SC16IS7XX_Buffer* const pBuf, size_t count)
+{
+  size_t PosOut = pBuf->PosOut + count;                                      // Increment Out position
+#ifndef SC16IS7XX_USE_POW2_BUFFERS
+  if (PosOut >= pBuf->BufferSize) PosOut -= pBuf->BufferSize;                // Correct Out position
+#endif
+  SC16IS7XX_MEMORY_BARRIER();                                                // Data reads shall be done before the producer sees the new position
+  pBuf->PosOut = PosOut;
+}
+
+
+
+//=============================================================================
+// [STATIC] Transfer data to the Tx buffer of the UART
+//=============================================================================
+size_t __SC16IS7XX_DataBuffToTxBuffer(SC16IS7XX_Buffer* const pBuf, const uint8_t *data, size_t size)
+{
+  const size_t FreeSize = SC16IS7XX_BUFFER_CAPACITY(pBuf) - __SC16IS7XX_GetBufferDataCount(pBuf);
+  const size_t CountToCopy = (size > FreeSize ? FreeSize : size);              // Set how many data will be store into the Tx buffer
+  if (CountToCopy == 0) return 0;
+  const size_t FirstPartSize = pBuf->BufferSize - SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosIn); // Calculate space available to the end of buffer
+  if (CountToCopy <= FirstPartSize)
+  {
+    memcpy(&pBuf->pData[SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosIn)], data, CountToCopy); // Copy data to Tx buffer
+  }
+  else
+  {
+    memcpy(&pBuf->pData[SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosIn)], data, FirstPartSize); // Copy first part of data to the end of Tx buffer
+    memcpy(&pBuf->pData[0], &data[FirstPartSize], (CountToCopy - FirstPartSize)); // Copy second part of data to the start of Tx buffer
+  }
+  __SC16IS7XX_AdvanceBufferIn(pBuf, CountToCopy);                              // Publish the data copied
+  return CountToCopy;
+}
+
+
+
+//=============================================================================
+// [STATIC] Transfer available data from Rx buffer of the UART
+//=============================================================================
+size_t __SC16IS7XX_RxBufferToDataBuff(SC16IS7XX_Buffer* const pBuf, uint8_t *data, size_t size)
+{
+  const size_t DataCount = __SC16IS7XX_GetBufferDataCount(pBuf);
+  const size_t CountToCopy = (size > DataCount ? DataCount : size);            // Set how many data will be get from the Rx buffer
+  if (CountToCopy == 0) return 0;
+  const size_t FirstPartSize = pBuf->BufferSize - SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosOut); // Calculate data available to the end of buffer
+  if (CountToCopy <= FirstPartSize)
+  {
+    memcpy(data, &pBuf->pData[SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosOut)], CountToCopy); // Copy data from Rx buffer
+  }
+  else
+  {
+    memcpy(data, &pBuf->pData[SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosOut)], FirstPartSize); // Copy first part of data from the end of Rx buffer
+    memcpy(&data[FirstPartSize], &pBuf->pData[0], (CountToCopy - FirstPartSize)); // Copy second part of data from the start of Rx buffer
+  }
+  __SC16IS7XX_AdvanceBufferOut(pBuf, CountToCopy);                             // Release the space of the data copied
+  return CountToCopy;
+}
+#endif
+
+
+
+//=============================================================================
+// Receive available data from UART FIFO of the SC16IS7XX
+//=============================================================================
+eERRORRESULT SC16IS7XX_ReceiveData(SC16IS7XX_UART *pUART, uint8_t *data, size_t size, size_t *actuallyReceived, setSC16IS7XX_ReceiveError *lastDataError)
 {
 #ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+  if ((pUART == NULL) || (data == NULL) || (actuallyReceived == NULL) || (lastDataError == NULL)) return ERR__PARAMETER_ERROR;
 #endif
   SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
 #ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__UNKNOWN_DEVICE;
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
 #endif
-  if ((pHardFlow != NULL) && (pSoftFlow != NULL)) return ERR__CONFIGURATION; // The user should not configure Hardware+Software control flow at the same time
-  eERRORRESULT Error, ErrorReturn = ERR_OK;
-  SC16IS7XX_EFR_Register RegEFR;
-  RegEFR.EFR = SC16IS7XX_EFR_SOFT_FLOW_CONTROL_SET(SC16IS7XX_NoTxCtrlFlow_NoRxCtrlFlow)   // Disable All Control Flows but keep Enhanced Functions Enabled
-             | SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE | SC16IS7XX_EFR_RTS_FLOW_CONTROL_DISABLE | SC16IS7XX_EFR_CTS_FLOW_CONTROL_DISABLE
-             | (useAddressChar ? SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_ENABLE : SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_DISABLE);
+  const bool IsSafeRX   = ((pUART->DriverConfig & SC16IS7XX_DRIVER_SAFE_RX) > 0);
+  const bool IsHybridRX = ((pUART->DriverConfig & SC16IS7XX_DRIVER_HYBRID_RX) > 0) && (IsSafeRX == false);
+  eERRORRESULT Error;
+  SC16IS7XX_LSR_Register RegLSR;
 
-  //--- Set Trigger Control Level ---
-  if ((pHardFlow != NULL) || (pSoftFlow != NULL))
+  *actuallyReceived = 0;
+
+#ifdef SC16IS7XX_USE_BUFFERS
+  SC16IS7XX_Buffer* const pBuf = &pUART->RxBuffer;
+  const bool IsIRQservice = ((pUART->DriverConfig & SC16IS7XX_DRIVER_IRQ_SERVICE) > 0);
+  const bool UseRxBuffer = (pBuf->pData != NULL) && (((IsSafeRX == false) && (IsHybridRX == false)) || IsIRQservice);
+  if (IsIRQservice && (UseRxBuffer == false)) return ERR__NULL_BUFFER;                             // The Rx FIFO can only be read by SC16IS7XX_ServiceInterrupt()
+  if (UseRxBuffer)
   {
-    eSC16IS7XX_TriggerCtrlLevel HoldAt, ResumeAt;
-    if (pHardFlow != NULL)
-         { HoldAt = pHardFlow->HoldAt; ResumeAt = pHardFlow->ResumeAt; }                  // Select the hardware control flow TCL
-    else { HoldAt = pSoftFlow->HoldAt; ResumeAt = pSoftFlow->ResumeAt; }                  // Select the software control flow TCL
-    if ((uint8_t)HoldAt <= (uint8_t)ResumeAt) return ERR__CONFIGURATION;                  // The TCR such that TCR[3:0] > TCR[7:4]. There is no built-in hardware check to make sure this condition is met
-    SC16IS7XX_TCR_Register RegTCR;
-    RegTCR.TCR = SC16IS7XX_TCR_HALT_TRIGGER_LEVEL_SET(HoldAt) | SC16IS7XX_TCR_RESUME_TRIGGER_LEVEL_SET(ResumeAt);
-    Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_TCR, RegTCR.TCR); // Write the TCR register
-    if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+    *actuallyReceived = __SC16IS7XX_RxBufferToDataBuff(pBuf, data, size);                          // Move data from Rx buffer
+    if (*actuallyReceived > 0) pUART->RxScanned = 0;                                               // The data scanned by SC16IS7XX_ReceiveUntil() are not at the same offset anymore
+# ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+    __SC16IS7XX_ReleaseRxTimestamps(pUART, *actuallyReceived);                                     // Release the timestamps of the data moved
+# endif
+    Error = __SC16IS7XX_UnmaskRxInterrupts(pUART);                                                 // Space has been freed, enable again the Rx interrupts if they were masked
+    if (Error != ERR_OK) return Error;                                                             // If there is an error while calling __SC16IS7XX_UnmaskRxInterrupts() then return the error
+    if (IsIRQservice) return ERR_OK;                                                               // The Rx FIFO is drained by SC16IS7XX_ServiceInterrupt()
+    if (__SC16IS7XX_GetBufferContiguousSpace(pBuf) == 0) return ERR_OK;                            // No space to get data from the Rx FIFO
   }
+#endif
 
-  //--- Enable access to enhanced registers ---
-  SC16IS7XX_LCR_Register OriginalLCR;
-  Error = SC16IS7XX_SetRegisterAccess(pComp, pUART->Channel, SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER, &OriginalLCR.LCR);
-  if (Error != ERR_OK) ErrorReturn = Error;                                               // If there is an error while calling SC16IS7XX_SetRegisterAccess() then return the error
+  //--- Get available data count in Rx FIFO ---
+  uint8_t AvailableData;
+  Error = SC16IS7XX_GetDataCountRxFIFO(pUART, &AvailableData);                                     // Get how many characters there is in the receive FIFO
+  if (Error != ERR_OK) return Error;                                                               // If there is an error while calling SC16IS7XX_GetDataCountRxFIFO() then return the error
 
-  //--- Configure Control Flow ---
-  if (ErrorReturn == ERR_OK)
+  //--- Send data if possible ---
+  if (IsSafeRX)                                                                                    //*** Safe receive
   {
-    if ((pHardFlow != NULL) && (pSoftFlow == NULL))                                                  //*** Hardware Control Flow
+    size_t CountToGet = (size > (size_t)AvailableData ? (size_t)AvailableData : size);
+    while (CountToGet > 0)
     {
-      RegEFR.EFR = SC16IS7XX_EFR_SOFT_FLOW_CONTROL_SET(SC16IS7XX_NoTxCtrlFlow_NoRxCtrlFlow)          // Disable Software Control Flow and keep Enhanced Functions Enabled
-                  | SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE | SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_DISABLE;
-      if (pHardFlow->RTSpinControl == SC16IS7XX_AUTOMATIC_PIN_CONTROL) RegEFR.EFR |= SC16IS7XX_EFR_RTS_FLOW_CONTROL_ENABLE;
-      if (pHardFlow->CTSpinControl == SC16IS7XX_AUTOMATIC_PIN_CONTROL) RegEFR.EFR |= SC16IS7XX_EFR_CTS_FLOW_CONTROL_ENABLE;
-      if ((pSpecialChar != NULL) && useAddressChar) ErrorReturn = ERR__CONFIGURATION;                // Impossible to have a special character detect AND address char used at the same time
-      if (useAddressChar) RegEFR.EFR |= SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_ENABLE;                    // Address char use the special character detect
+      //--- Verify current char ---
+      Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_LSR, &RegLSR.LSR);        // Read the LSR register
+      if (Error != ERR_OK) return Error;                                                           // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+      *lastDataError = (setSC16IS7XX_ReceiveError)(RegLSR.LSR & (uint8_t)SC16IS7XX_RX_ERROR_Mask); // Get last received char error
+      Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_RHR, data);               // Receive the next char in FIFO
+      if (Error != ERR_OK) return Error;                                                           // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+      (*actuallyReceived)++;
+      if (*lastDataError != SC16IS7XX_NO_RX_ERROR) return ERR__RECEIVE_ERROR;
+      data++;
+      CountToGet--;
     }
-
-    if ((pHardFlow == NULL) && (pSoftFlow != NULL))                                                  //*** Software Control Flow
+  }
+  else if (IsHybridRX)                                                                             //*** Hybrid receive
+  {
+    size_t CountToGet = (size > (size_t)AvailableData ? (size_t)AvailableData : size);
+    *lastDataError = SC16IS7XX_NO_RX_ERROR;
+    while (CountToGet > 0)
     {
-      if ((pSpecialChar != NULL) && SC16IS7XX_IS_SOFT_CONTROL_FLOW_USES_XOFF2(pSoftFlow->Config)) ErrorReturn = ERR__CONFIGURATION; // Impossible to have a special char AND Xoff2 used in the control flow
-      RegEFR.EFR = SC16IS7XX_EFR_SOFT_FLOW_CONTROL_SET(pSoftFlow->Config)                            // Set Software Control Flow, keep Enhanced Functions Enabled, and disable Hardware Control Flow
-                  | SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE | SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_DISABLE
-                  | SC16IS7XX_EFR_RTS_FLOW_CONTROL_DISABLE | SC16IS7XX_EFR_CTS_FLOW_CONTROL_DISABLE;
-      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XON1, pSoftFlow->Xon1);    // Write the Xon1 register
-      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XON2, pSoftFlow->Xon2);    // Write the Xon2 register
-      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XOFF1, pSoftFlow->Xoff1);  // Write the Xoff1 register
-      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-      if (pSpecialChar == NULL) Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XOFF2, pSoftFlow->Xoff2); // Write the Xoff2 register
-      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+      Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_LSR, &RegLSR.LSR);        // Read the LSR register
+      if (Error != ERR_OK) return Error;                                                           // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+      const setSC16IS7XX_ReceiveError CharError = (setSC16IS7XX_ReceiveError)(RegLSR.LSR & (uint8_t)SC16IS7XX_RX_ERROR_Mask); // Get current char error
+      if ((RegLSR.LSR & SC16IS7XX_LSR_FIFO_DATA_ERROR) == 0)                                       // No parity, framing or break error in the FIFO
+      {
+        if (CharError != SC16IS7XX_NO_RX_ERROR) *lastDataError = CharError;                        // Only an overrun error can be reported here
+        Error = __SC16IS7XX_ReadData(pComp, pUART->Channel, RegSC16IS7XX_RHR, data, (uint8_t)CountToGet); // Receive all remaining data at once
+        if (Error != ERR_OK) return Error;                                                         // If there is an error while calling __SC16IS7XX_ReadData() then return the error
+        *actuallyReceived += CountToGet;
+        break;
+      }
+      Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_RHR, data);               // Receive the next char in FIFO
+      if (Error != ERR_OK) return Error;                                                           // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+      (*actuallyReceived)++;
+      if (CharError != SC16IS7XX_NO_RX_ERROR)
+      {
+        *lastDataError = CharError;
+        if (pUART->fnRxError == NULL) return ERR__RECEIVE_ERROR;                                   // No handler, stop at the erroneous char
+        pUART->fnRxError(pUART, (*actuallyReceived - 1), CharError);                               // Report the position of the erroneous char
+      }
+      data++;
+      CountToGet--;
     }
-    if (pSpecialChar != NULL)
+  }
+  else                                                                                           //*** Burst receive
+  {
+#ifdef SC16IS7XX_USE_BUFFERS
+    if (UseRxBuffer)
     {
-      RegEFR.EFR |= SC16IS7XX_EFR_SPECIAL_CHAR_DETECT_ENABLE;
-      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_XOFF2, *pSpecialChar);     // Write the special char in the Xoff2 register
-      if (Error != ERR_OK) ErrorReturn = Error;                                                      // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+      Error = __SC16IS7XX_RxFIFOtoRxBuffer(pUART, AvailableData);                                // Receive all possible data, with one burst per contiguous part of the Rx buffer
+      if (Error != ERR_OK) return Error;                                                         // If there is an error while calling __SC16IS7XX_RxFIFOtoRxBuffer() then return the error
+      const size_t Received = __SC16IS7XX_RxBufferToDataBuff(pBuf, &data[*actuallyReceived], (size - *actuallyReceived)); // Copy the new data received to data buffer
+      if (Received > 0) pUART->RxScanned = 0;                                                    // The data scanned by SC16IS7XX_ReceiveUntil() are not at the same offset anymore
+# ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+      __SC16IS7XX_ReleaseRxTimestamps(pUART, Received);                                          // Release the timestamps of the data copied
+# endif
+      *actuallyReceived += Received;
+      return ERR_OK;
     }
-    Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_EFR, RegEFR.EFR);  // Write the EFR register
-    if (Error != ERR_OK) ErrorReturn = Error;                                              // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+#endif
+    *actuallyReceived = (size > (size_t)AvailableData ? (size_t)AvailableData : size);           // Set how many data will actually be received
+    return __SC16IS7XX_ReadData(pComp, pUART->Channel, RegSC16IS7XX_RHR, data, *actuallyReceived); // Receive all possible data at once
   }
+  return ERR_OK;
+}
 
-  //--- Return access to general registers ---
-  Error = SC16IS7XX_ReturnAccessToGeneralRegister(pComp, pUART->Channel, OriginalLCR.LCR); // Return access to general registers
-  if (ErrorReturn != ERR_OK) return ErrorReturn;                                           // If there is an error while Enhanced Features are enabled then return the error
-  if (Error != ERR_OK) return Error;                                                       // If there is an error while calling SC16IS7XX_ReturnAccessToGeneralRegister() then return the error
+#ifdef USE_GENERICS_DEFINED
+eERRORRESULT SC16IS7XX_ReceiveData_Gen(UART_Interface *pIntDev, uint8_t *data, size_t size, size_t *actuallyReceived, uint8_t *lastDataError)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pIntDev == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX_UART* pUART = (SC16IS7XX_UART*)(pIntDev->InterfaceDevice); // Get the SC16IS7XX_UART device of this UART port
+  return SC16IS7XX_ReceiveData(pUART, data, size, actuallyReceived, lastDataError);
+}
+#endif
 
-  //--- Set Xon Any if set ---
-  uint8_t RegValue = 0;
-  if ((pSoftFlow != NULL) && pSoftFlow->XonAnyChar) RegValue = SC16IS7XX_MCR_XON_ANY_FUNCTION_ENABLE; // Enable Xon Any function
-  return SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, RegValue, SC16IS7XX_MCR_XON_ANY_FUNCTION_Mask);
+
+
+//=============================================================================
+// Receive a char from UART FIFO of the SC16IS7XX
+//=============================================================================
+eERRORRESULT SC16IS7XX_ReceiveChar(SC16IS7XX_UART *pUART, char *data, setSC16IS7XX_ReceiveError *charError)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+#endif
+  eERRORRESULT Error;
+  size_t ActuallyReceived = 0;
+  const uint32_t StartTime = (pComp->fnGetCurrentms != NULL ? pComp->fnGetCurrentms() : 0u); // Start time of the timeout
+  while (true)
+  {
+    Error = SC16IS7XX_ReceiveData(pUART, (uint8_t*)data, 1, &ActuallyReceived, charError);
+    if (Error != ERR_OK) return Error;                       // If there is an error while calling SC16IS7XX_ReceiveData() then return the error
+    if (ActuallyReceived > 0) break;
+    Error = __SC16IS7XX_WaitBeforePoll(pUART, StartTime, 1); // No char received, one char shall be received before a new try
+    if (Error != ERR_OK) return Error;                       // If there is an error while calling __SC16IS7XX_WaitBeforePoll() then return the error
+  }
+  return ERR_OK;
+}
+
+
+
+#ifdef SC16IS7XX_USE_BUFFERS
+//=============================================================================
+// Retrieve data from Rx UART FIFO of the SC16IS7XX UART to the Rx Buffer
+//=============================================================================
+eERRORRESULT SC16IS7XX_RetrieveRxFIFOtoBuffer(SC16IS7XX_UART *pUART)
+{
+#ifdef CHECK_NULL_PARAM
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+#endif
+  if ((pUART->DriverConfig & SC16IS7XX_DRIVER_IRQ_SERVICE) > 0) return ERR__NOT_AVAILABLE; // The Rx FIFO can only be read by SC16IS7XX_ServiceInterrupt()
+  size_t ActuallyReceived;                 // Dummy
+  uint8_t DummyByte = 0;                   // Dummy
+  setSC16IS7XX_ReceiveError LastDataError; // Dummy
+  return SC16IS7XX_ReceiveData(pUART, &DummyByte, 0, &ActuallyReceived, &LastDataError); // This will get 0 bytes into Rx data and will trigger a get from UART Rx FIFO
 }
 
 
 
+//=============================================================================
+// Peek data in the Rx Buffer of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_RxPeek(SC16IS7XX_UART *pUART, uint8_t **ptr1, size_t *len1, uint8_t **ptr2, size_t *len2)
+{
+#ifdef CHECK_NULL_PARAM
+  if ((pUART == NULL) || (ptr1 == NULL) || (len1 == NULL) || (ptr2 == NULL) || (len2 == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  SC16IS7XX_Buffer* const pBuf = &pUART->RxBuffer;
+  *len1 = 0;
+  *len2 = 0;
+  if (pBuf->pData == NULL) return ERR__NULL_BUFFER;
+  const size_t DataCount = __SC16IS7XX_GetBufferDataCount(pBuf);
+  const size_t FirstPartSize = pBuf->BufferSize - SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosOut); // Calculate data available to the end of buffer
+  *ptr1 = &pBuf->pData[SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosOut)];          // First part starts at Out position
+  *ptr2 = &pBuf->pData[0];                                                   // Second part starts at the start of buffer
+  *len1 = (DataCount > FirstPartSize ? FirstPartSize : DataCount);
+  *len2 = DataCount - *len1;
+  return ERR_OK;
+}
+
 
 
-//**********************************************************************************************************************************************************
 //=============================================================================
-// [STATIC] Configure interrupt of the SC16IS7XX device UART
+// Consume data in the Rx Buffer of the SC16IS7XX UART
 //=============================================================================
-// DO NOT USE DIRECTLY, use SC16IS7XX_InitUART() instead! UART configuration needs to be configured with a safe UART configuration to avoid spurious effects, which is done in the SC16IS7XX_InitUART() function
-eERRORRESULT __SC16IS7XX_ConfigureFIFOs(SC16IS7XX_UART *pUART, bool useFIFOs, eSC16IS7XX_IntTxTriggerLevel txTrigLvl, eSC16IS7XX_IntRxTriggerLevel rxTrigLvl)
+eERRORRESULT SC16IS7XX_RxConsume(SC16IS7XX_UART *pUART, size_t count)
 {
 #ifdef CHECK_NULL_PARAM
   if (pUART == NULL) return ERR__PARAMETER_ERROR;
 #endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+  SC16IS7XX_Buffer* const pBuf = &pUART->RxBuffer;
+  if (pBuf->pData == NULL) return ERR__NULL_BUFFER;
+  if (count == 0) return ERR_OK;
+  if (count > __SC16IS7XX_GetBufferDataCount(pBuf)) return ERR__OUT_OF_RANGE; // More than the data in the buffer
+  __SC16IS7XX_AdvanceBufferOut(pBuf, count);                                 // Release the space of the data consumed
+  pUART->RxScanned = 0;                                                      // The data scanned by SC16IS7XX_ReceiveUntil() are not at the same offset anymore
+#ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+  __SC16IS7XX_ReleaseRxTimestamps(pUART, count);                             // Release the timestamps of the data consumed
 #endif
-  eERRORRESULT Error;
-
-  //--- FIFO enable ---
-  SC16IS7XX_FCR_Register RegFCR;
-  RegFCR.FCR = (useFIFOs ? SC16IS7XX_FCR_RX_TX_FIFO_ENABLE : SC16IS7XX_FCR_RX_TX_FIFO_DISABLE); // In this driver we use the TLR register to configure the Tx and Rx Trigger Level, so we let the Trigger Level at default value which is 0x00
-  Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_FCR, RegFCR.FCR);         // Write the FCR register
-  if (Error != ERR_OK) return Error;                                                            // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-
-  //--- Set Trigger Level ---
-  SC16IS7XX_TLR_Register RegTLR;
-  RegTLR.TLR = SC16IS7XX_TLR_TX_FIFO_TRIGGER_LEVEL_SET(txTrigLvl) | SC16IS7XX_TLR_RX_FIFO_TRIGGER_LEVEL_SET(rxTrigLvl);
-  return SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_TLR, RegTLR.TLR);          // Write the TLR register
+  return __SC16IS7XX_UnmaskRxInterrupts(pUART);                              // Space has been freed, enable again the Rx interrupts if they were masked
 }
 
 
 
+#ifdef SC16IS7XX_USE_RX_TIMESTAMPS
 //=============================================================================
-// Reset Rx and/or Tx FIFO of the SC16IS7XX UART
+// Get the timestamp of a data in the Rx Buffer of the SC16IS7XX UART
 //=============================================================================
-eERRORRESULT SC16IS7XX_ResetFIFO(SC16IS7XX_UART *pUART, bool resetTxFIFO, bool resetRxFIFO)
+eERRORRESULT SC16IS7XX_GetRxTimestamp(SC16IS7XX_UART *pUART, size_t offset, uint32_t *timems)
 {
 #ifdef CHECK_NULL_PARAM
-  if ((pUART == NULL) || (pUARTConf == NULL)) return ERR__PARAMETER_ERROR;
+  if ((pUART == NULL) || (timems == NULL)) return ERR__PARAMETER_ERROR;
 #endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__UNKNOWN_DEVICE;
+  SC16IS7XX_RxTimestamps* const pRing = &pUART->RxTimestamps;
+  if ((pUART->RxBuffer.pData == NULL) || (pRing->pStamps == NULL)) return ERR__NULL_BUFFER;
+  if (offset >= __SC16IS7XX_GetBufferDataCount(&pUART->RxBuffer)) return ERR__OUT_OF_RANGE; // No data at this offset
+  SC16IS7XX_MEMORY_BARRIER();                                                // The timestamp position read shall not be done before the Rx buffer position read, the timestamp is published first
+
+  //--- Search the burst of the data ---
+  const size_t DataPos = pRing->DataOut + offset;                            // Position of the data in the Rx data stream
+  const size_t PosIn   = pRing->PosIn;                                       // Take a snapshot of the producer position
+  SC16IS7XX_MEMORY_BARRIER();                                                // Timestamp reads shall not be done before the producer position read
+  for (size_t PosOut = pRing->PosOut; PosOut != PosIn; )
+  {
+    const SC16IS7XX_RxTimestamp* const pStamp = &pRing->pStamps[PosOut];
+    if ((size_t)(DataPos - pStamp->Pos) < pStamp->Count)                     // The data is in this burst
+    {
+      *timems = pStamp->Timems;
+      return ERR_OK;
+    }
+    if (++PosOut >= pRing->StampCount) PosOut = 0;
+  }
+  return ERR__NO_DATA_AVAILABLE;                                             // The burst of the data was not timestamped
+}
 #endif
-  eERRORRESULT Error;
-
-  //--- Read the IIR register to get the FIFO enable configuration ---
-  SC16IS7XX_IIR_Register RegIIR;
-  Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_IIR, &RegIIR.IIR); // Read the IIR register
-  if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
 
-  //--- Set the reset of FIFOs ---
-  SC16IS7XX_FCR_Register RegFCR;                                                                             // We need to fill the FCR register with the previous configuration because the FCR is a write only register
-  RegFCR.FCR = ((RegIIR.IIR & SC16IS7XX_IIR_FIFOs_ARE_ENABLE) > 0 ? SC16IS7XX_FCR_RX_TX_FIFO_ENABLE : 0x00); // We get the FIFO enable flag in the IIR register because it mirrors the contents of FCR[0]. In this driver we use the TLR register to configure the Tx and Rx Trigger Level, so we let the Trigger Level at default value which is 0x00
-  if (resetRxFIFO) RegFCR.FCR |= SC16IS7XX_FCR_RESET_RX_FIFO;                                                // Clears the contents of the receive FIFO and resets the FIFO level logic (the Receive Shift Register is not cleared or altered). This bit will return to a logic 0 after clearing the FIFO
-  if (resetTxFIFO) RegFCR.FCR |= SC16IS7XX_FCR_RESET_TX_FIFO;                                                // Clears the contents of the transmit FIFO and resets the FIFO level logic (the Transmit Shift Register is not cleared or altered). This bit will return to a logic 0 after clearing the FIFO
-  return SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_FCR, RegFCR.FCR);                       // Write the FCR register
-}
 
 
+//=============================================================================
+// [STATIC] Find the first delimiter in a data array
+//=============================================================================
+const uint8_t* __SC16IS7XX_FindDelimiter(const uint8_t *data, size_t size, const char *delimiterSet, const uint8_t *delimiterMap)
+{
+  if (delimiterSet[1] == '\0') return (const uint8_t*)memchr(data, delimiterSet[0], size); // Only one delimiter, use the optimized search of the library
+  for (size_t z = 0; z < size; ++z)
+    if ((delimiterMap[data[z] >> 3] & (1u << (data[z] & 0x7))) > 0) return &data[z];
+  return NULL;
+}
 
 
 
-//**********************************************************************************************************************************************************
 //=============================================================================
-// Enable/disable Transmitter and/or receiver of the SC16IS7XX UART
+// Receive a delimited frame from the Rx Buffer of the SC16IS7XX UART
 //=============================================================================
-eERRORRESULT SC16IS7XX_TxRxDisable(SC16IS7XX_UART *pUART, bool disableTx, bool disableRx)
+eERRORRESULT SC16IS7XX_ReceiveUntil(SC16IS7XX_UART *pUART, const char *delimiterSet, uint8_t *buf, size_t max, size_t *len)
 {
 #ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__PARAMETER_ERROR;
-#endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+  if ((pUART == NULL) || (delimiterSet == NULL) || (buf == NULL) || (len == NULL)) return ERR__PARAMETER_ERROR;
 #endif
+  if ((max == 0) || (delimiterSet[0] == '\0')) return ERR__PARAMETER_ERROR;
+  SC16IS7XX_Buffer* const pBuf = &pUART->RxBuffer;
+  *len = 0;
+  if (pBuf->pData == NULL) return ERR__NULL_BUFFER;
 
-  SC16IS7XX_EFCR_Register RegEFCR;
-  RegEFCR.EFCR = SC16IS7XX_EFCR_TX_ENABLE | SC16IS7XX_EFCR_RX_ENABLE; // Initial value
-  if (disableTx) RegEFCR.EFCR |= SC16IS7XX_EFCR_TX_DISABLE;           // Disable Transmitter
-  if (disableRx) RegEFCR.EFCR |= SC16IS7XX_EFCR_RX_DISABLE;           // Disable Receiver
-  return SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_EFCR, RegEFCR.EFCR, SC16IS7XX_EFCR_TX_RX_DISABLE_Mask); // Modify the EFCR register
-}
+  //--- Prepare the delimiter map ---
+  uint8_t DelimiterMap[256 / 8];
+  if (delimiterSet[1] != '\0')                                              // Only needed with more than one delimiter
+  {
+    memset(&DelimiterMap[0], 0, sizeof(DelimiterMap));
+    for (const char* pChar = delimiterSet; *pChar != '\0'; ++pChar)
+      DelimiterMap[(uint8_t)*pChar >> 3] |= (uint8_t)(1u << ((uint8_t)*pChar & 0x7));
+  }
 
+  //--- Scan the new data ---
+  const size_t PosOut    = pBuf->PosOut;
+  const size_t DataCount = __SC16IS7XX_GetBufferDataCount(pBuf);
+  const size_t ScanEnd = (DataCount > max ? max : DataCount);                // No need to scan more than a frame can hold
+  size_t FrameSize = 0;
+  size_t Offset = pUART->RxScanned;
+  while (Offset < ScanEnd)
+  {
+    size_t Index = SC16IS7XX_BUFFER_INDEX(pBuf, PosOut) + Offset;            // Index of the first data to scan
+    if (Index >= pBuf->BufferSize) Index -= pBuf->BufferSize;
+    const size_t PartSize = ((ScanEnd - Offset) > (pBuf->BufferSize - Index) ? (pBuf->BufferSize - Index) : (ScanEnd - Offset)); // Scan up to the end of buffer at once
+    const uint8_t* pFound = __SC16IS7XX_FindDelimiter(&pBuf->pData[Index], PartSize, delimiterSet, &DelimiterMap[0]);
+    if (pFound != NULL)
+    {
+      FrameSize = Offset + (size_t)(pFound - &pBuf->pData[Index]) + 1;       // The frame includes the delimiter
+      break;
+    }
+    Offset += PartSize;
+  }
 
+  //--- Get the frame ---
+  const bool IsComplete = (FrameSize > 0);
+  if (IsComplete == false)
+  {
+    pUART->RxScanned = ScanEnd;                                              // Remember the data already scanned
+    if ((ScanEnd < max) && (DataCount < SC16IS7XX_BUFFER_CAPACITY(pBuf))) return ERR_OK; // The frame is not complete yet
+    FrameSize = ScanEnd;                                                     // The frame cannot be held by buf or the Rx buffer, return its first part
+  }
+  *len = __SC16IS7XX_RxBufferToDataBuff(pBuf, buf, FrameSize);              // Copy the frame and remove it from the Rx buffer
+#ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+  __SC16IS7XX_ReleaseRxTimestamps(pUART, *len);                              // Release the timestamps of the frame
+#endif
+  pUART->RxScanned = 0;
+  eERRORRESULT Error = __SC16IS7XX_UnmaskRxInterrupts(pUART);                // Space has been freed, enable again the Rx interrupts if they were masked
+  if (Error != ERR_OK) return Error;                                         // If there is an error while calling __SC16IS7XX_UnmaskRxInterrupts() then return the error
+  return (IsComplete ? ERR_OK : ERR__BUFFER_FULL);
+}
 
 
 
-//**********************************************************************************************************************************************************
 //=============================================================================
-// Configure interrupt of the SC16IS7XX UART
+// [STATIC] Move data from the Rx FIFO of the UART to its Rx buffer
 //=============================================================================
-eERRORRESULT SC16IS7XX_ConfigureInterrupt(SC16IS7XX_UART *pUART, setSC16IS7XX_Interrupts interruptsFlags)
+eERRORRESULT __SC16IS7XX_RxFIFOtoRxBuffer(SC16IS7XX_UART *pUART, size_t count)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__PARAMETER_ERROR;
+  SC16IS7XX_Buffer* const pBuf = &pUART->RxBuffer;
+  eERRORRESULT Error;
+#ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+  const bool UseTimestamps = (pUART->RxTimestamps.pStamps != NULL) && (pUART->Device->fnGetCurrentms != NULL) && (count > 0);
+  const uint32_t Timems = (UseTimestamps ? pUART->Device->fnGetCurrentms() : 0u); // Time of the burst
 #endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+  while (count > 0)
+  {
+    const size_t AvailableBufSize = __SC16IS7XX_GetBufferContiguousSpace(pBuf);
+    if (AvailableBufSize == 0) break;                                          // The Rx buffer is full
+    const size_t DataSizeToGet = (count > AvailableBufSize ? AvailableBufSize : count);
+    Error = __SC16IS7XX_ReadData(pUART->Device, pUART->Channel, RegSC16IS7XX_RHR, &pBuf->pData[SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosIn)], (uint8_t)DataSizeToGet); // Receive the data of this part of the buffer at once
+    if (Error != ERR_OK) return Error;                                         // If there is an error while calling __SC16IS7XX_ReadData() then return the error
+#ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+    if (UseTimestamps) __SC16IS7XX_AddRxTimestamp(pUART, DataSizeToGet, Timems); // Timestamp the data received before their publication, the consumer never sees data without their timestamp
 #endif
-  return SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, (uint8_t)interruptsFlags & SC16IS7XX_INTERRUPTS_FLAGS_MASK); // Write the IER register
+    __SC16IS7XX_AdvanceBufferIn(pBuf, DataSizeToGet);                          // Publish the data received
+    count -= DataSizeToGet;
+  }
+  return ERR_OK;
 }
 
 
 
 //=============================================================================
-// Get interrupt event of the SC16IS7XX UART
+// [STATIC] Move data from the Rx FIFO of the UART to its Rx buffer with the LSR check of the chars
 //=============================================================================
-eERRORRESULT SC16IS7XX_GetInterruptEvents(SC16IS7XX_UART *pUART, eSC16IS7XX_InterruptSource *interruptFlag)
+eERRORRESULT __SC16IS7XX_RxFIFOtoRxBufferChecked(SC16IS7XX_UART *pUART, size_t count, bool isSafeRX)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__PARAMETER_ERROR;
-#endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
-#endif
+  SC16IS7XX_Buffer* const pBuf = &pUART->RxBuffer;
+  SC16IS7XX_LSR_Register RegLSR;
   eERRORRESULT Error;
-  SC16IS7XX_IIR_Register RegIIR;
-
-  Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_IIR, &RegIIR.IIR);       // Read the IIR register
-  if (Error != ERR_OK) return Error;                                                          // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
-  *interruptFlag = (eSC16IS7XX_InterruptSource)SC16IS7XX_IIR_INTERRUT_SOURCE_GET(RegIIR.IIR); // Extract interrupt
+  while (count > 0)
+  {
+    if (__SC16IS7XX_GetBufferContiguousSpace(pBuf) == 0) break;                // The Rx buffer is full
+    Error = SC16IS7XX_ReadRegister(pUART->Device, pUART->Channel, RegSC16IS7XX_LSR, &RegLSR.LSR); // Read the LSR register
+    if (Error != ERR_OK) return Error;                                         // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+    const setSC16IS7XX_ReceiveError CharError = (setSC16IS7XX_ReceiveError)(RegLSR.LSR & (uint8_t)SC16IS7XX_RX_ERROR_Mask); // Get current char error
+    if ((isSafeRX == false) && ((RegLSR.LSR & SC16IS7XX_LSR_FIFO_DATA_ERROR) == 0)) // Hybrid receive and no parity, framing or break error in the FIFO
+    {
+      pUART->RxErrors |= CharError;                                            // Only an overrun error can be reported here
+      return __SC16IS7XX_RxFIFOtoRxBuffer(pUART, count);                       // Receive all remaining data at once
+    }
+    const size_t Index = SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosIn);
+    Error = SC16IS7XX_ReadRegister(pUART->Device, pUART->Channel, RegSC16IS7XX_RHR, &pBuf->pData[Index]); // Receive the next char in FIFO
+    if (Error != ERR_OK) return Error;                                         // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+#ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+    if ((pUART->RxTimestamps.pStamps != NULL) && (pUART->Device->fnGetCurrentms != NULL))
+      __SC16IS7XX_AddRxTimestamp(pUART, 1, pUART->Device->fnGetCurrentms());   // Timestamp the char received
+#endif
+    __SC16IS7XX_AdvanceBufferIn(pBuf, 1);                                      // Publish the char received
+    count--;
+    if (CharError != SC16IS7XX_NO_RX_ERROR)
+    {
+      pUART->RxErrors |= CharError;                                            // Record the receive errors
+      if (isSafeRX || (pUART->fnRxError == NULL)) return ERR__RECEIVE_ERROR;   // Stop at the erroneous char
+      pUART->fnRxError(pUART, Index, CharError);                               // Report the position of the erroneous char in the Rx buffer
+    }
+  }
   return ERR_OK;
 }
 
 
 
 //=============================================================================
-// Get status of the SC16IS7XX UART
+// [STATIC] Enable again the Rx interrupts masked while the Rx buffer was full
 //=============================================================================
-eERRORRESULT SC16IS7XX_GetUARTstatus(SC16IS7XX_UART *pUART, setSC16IS7XX_Status *statusFlag)
+eERRORRESULT __SC16IS7XX_UnmaskRxInterrupts(SC16IS7XX_UART *pUART)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__PARAMETER_ERROR;
-#endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-  eERRORRESULT Error;
+  const uint8_t RxIER = pUART->RxIERmasked;
+  if (RxIER == 0) return ERR_OK;                                             // The Rx interrupts are not masked
+  if (__SC16IS7XX_GetBufferDataCount(&pUART->RxBuffer) >= SC16IS7XX_BUFFER_CAPACITY(&pUART->RxBuffer)) return ERR_OK; // Still no space
+  pUART->RxIERmasked = 0;
+  return SC16IS7XX_ModifyRegister(pUART->Device, pUART->Channel, RegSC16IS7XX_IER, RxIER, RxIER); // Enable again the Rx interrupts
+}
 
-  SC16IS7XX_LSR_Register RegLSR;
-  Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_LSR, &RegLSR.LSR); // Read the LSR register
-  *statusFlag = (setSC16IS7XX_Status)(RegLSR.LSR & SC16IS7XX_STATUS_Mask);
-  return Error;
+
+
+//=============================================================================
+// [STATIC] Enable again the THR interrupt masked while the Tx buffer was empty
+//=============================================================================
+eERRORRESULT __SC16IS7XX_UnmaskTxInterrupt(SC16IS7XX_UART *pUART)
+{
+  const uint8_t TxIER = pUART->TxIERmasked;
+  if (TxIER == 0) return ERR_OK;                                             // The THR interrupt is not masked
+  if (__SC16IS7XX_GetBufferDataCount(&pUART->TxBuffer) == 0) return ERR_OK;  // Still nothing to send
+  pUART->TxIERmasked = 0;
+  return SC16IS7XX_ModifyRegister(pUART->Device, pUART->Channel, RegSC16IS7XX_IER, TxIER, TxIER); // Enable again the THR interrupt, the Tx FIFO below the trigger level gives a THR interrupt at once
 }
 
 
 
+#ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+//=============================================================================
+// [STATIC] Add a timestamp for a Rx FIFO burst stored in the Rx buffer of the UART
+//=============================================================================
+void __SC16IS7XX_AddRxTimestamp(SC16IS7XX_UART *pUART, size_t count, uint32_t timems)
+{
+  SC16IS7XX_RxTimestamps* const pRing = &pUART->RxTimestamps;
+  const size_t DataPos = pRing->DataIn;
+  pRing->DataIn = DataPos + count;                                           // Account the data even when they cannot be timestamped
+  size_t PosIn = pRing->PosIn + 1;                                           // Increment In position
+  if (PosIn >= pRing->StampCount) PosIn = 0;                                 // Correct In position
+  if (PosIn == pRing->PosOut)                                                // The ring is full
+  {
+    pRing->Dropped++;
+    return;
+  }
+  SC16IS7XX_RxTimestamp* const pStamp = &pRing->pStamps[pRing->PosIn];
+  pStamp->Pos    = DataPos;
+  pStamp->Count  = count;
+  pStamp->Timems = timems;
+  SC16IS7XX_MEMORY_BARRIER();                                                // Timestamp writes shall be done before the consumer sees the new position
+  pRing->PosIn = PosIn;
+}
+
 
 
-//**********************************************************************************************************************************************************
 //=============================================================================
-// Get available space in the transmit FIFO of the SC16IS7XX UART
+// [STATIC] Account data consumed from the Rx buffer of the UART and release the timestamps of the bursts fully consumed
 //=============================================================================
-eERRORRESULT SC16IS7XX_GetAvailableSpaceTxFIFO(SC16IS7XX_UART *pUART, uint8_t *availableSpace)
+void __SC16IS7XX_ReleaseRxTimestamps(SC16IS7XX_UART *pUART, size_t count)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__PARAMETER_ERROR;
-#endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+  SC16IS7XX_RxTimestamps* const pRing = &pUART->RxTimestamps;
+  if (pRing->pStamps == NULL) return;
+  const size_t DataOut = pRing->DataOut + count;
+  pRing->DataOut = DataOut;
+  const size_t PosIn = pRing->PosIn;                                         // Take a snapshot of the producer position
+  SC16IS7XX_MEMORY_BARRIER();                                                // Timestamp reads shall not be done before the producer position read
+  size_t PosOut = pRing->PosOut;
+  while (PosOut != PosIn)
+  {
+    const SC16IS7XX_RxTimestamp* const pStamp = &pRing->pStamps[PosOut];
+    const size_t Remaining = pStamp->Pos + pStamp->Count - DataOut;          // Data of the burst still in the Rx buffer, wraps to a huge value when the burst is consumed
+    if ((Remaining > 0) && (Remaining <= pUART->RxBuffer.BufferSize)) break; // The burst is not fully consumed, neither are the next ones
+    if (++PosOut >= pRing->StampCount) PosOut = 0;
+  }
+  SC16IS7XX_MEMORY_BARRIER();                                                // Timestamp reads shall be done before the producer sees the new position
+  pRing->PosOut = PosOut;
+}
 #endif
-  return SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_TXLVL, availableSpace); // Read the TXLVL register
+
+
+
+//=============================================================================
+// [STATIC] Move data from the Tx buffer of the UART to its Tx FIFO
+//=============================================================================
+eERRORRESULT __SC16IS7XX_TxBufferToTxFIFO(SC16IS7XX_UART *pUART, size_t space)
+{
+  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
+  eERRORRESULT Error;
+  while (space > 0)
+  {
+    const size_t AvailableBufSize = __SC16IS7XX_GetBufferContiguousData(pBuf);
+    if (AvailableBufSize == 0) break;                                          // No more data to send
+    const size_t DataSizeToSend = (space > AvailableBufSize ? AvailableBufSize : space);
+    Error = __SC16IS7XX_WriteData(pUART->Device, pUART->Channel, RegSC16IS7XX_THR, &pBuf->pData[SC16IS7XX_BUFFER_INDEX(pBuf, pBuf->PosOut)], (uint8_t)DataSizeToSend); // Send the data of this part of the buffer at once
+    if (Error != ERR_OK) return Error;                                         // If there is an error while calling __SC16IS7XX_WriteData() then return the error
+    __SC16IS7XX_AdvanceBufferOut(pBuf, DataSizeToSend);                        // Release the space of the data sent
+    space -= DataSizeToSend;
+  }
+  return ERR_OK;
 }
 
 
 
 //=============================================================================
-// Get number of characters stored in receive FIFO of the SC16IS7XX UART
+// [STATIC] Transfer data of segments to the Tx buffer of the UART
 //=============================================================================
-eERRORRESULT SC16IS7XX_GetDataCountRxFIFO(SC16IS7XX_UART *pUART, uint8_t *dataCount)
+void __SC16IS7XX_SegmentsToTxBuffer(SC16IS7XX_Buffer* const pBuf, const SC16IS7XX_TxSegment *segments, size_t segmentCount, size_t *segmentIndex, size_t *segmentOffset)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pUART == NULL) return ERR__PARAMETER_ERROR;
-#endif
-  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-#ifdef CHECK_NULL_PARAM
-  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
+  while (*segmentIndex < segmentCount)
+  {
+    const size_t SegmentDataSize = segments[*segmentIndex].Size - *segmentOffset;
+    const size_t CountCopied = __SC16IS7XX_DataBuffToTxBuffer(pBuf, &segments[*segmentIndex].pData[*segmentOffset], SegmentDataSize); // Move data of this segment to Tx buffer
+    __SC16IS7XX_AdvanceSegments(segments, segmentCount, segmentIndex, segmentOffset, CountCopied);
+    if (CountCopied < SegmentDataSize) break;                                  // The Tx buffer is full
+  }
+}
+
+
+
+//=============================================================================
+// [STATIC] Write a char of a formatted output in the Tx buffer of the UART
+//=============================================================================
+void __SC16IS7XX_PrintfChar(SC16IS7XX_PrintfWriter* pWriter, char aChar)
+{
+  if (pWriter->Space == 0) __SC16IS7XX_PrintfFlush(pWriter, true);          // The Tx buffer is full, send data to make room
+  if (pWriter->Error != ERR_OK) return;                                      // The output stops at the first error
+  SC16IS7XX_Buffer* const pBuf = &pWriter->pUART->TxBuffer;
+  pBuf->pData[SC16IS7XX_BUFFER_INDEX(pBuf, pWriter->PosIn)] = (uint8_t)aChar; // The char is not visible to the consumer until published
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+  ++pWriter->PosIn;
+#else
+  if (++pWriter->PosIn >= pBuf->BufferSize) pWriter->PosIn = 0;              // Wrap the position
 #endif
-  return SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_RXLVL, dataCount); // Read the RXLVL register
+  ++pWriter->Pending;
+  --pWriter->Space;
 }
 
 
 
+//=============================================================================
+// [STATIC] Write a padded field of a formatted output in the Tx buffer of the UART
+//=============================================================================
+void __SC16IS7XX_PrintfField(SC16IS7XX_PrintfWriter* pWriter, const char* prefix, size_t prefixLen, size_t zeroCount, const char* data, size_t dataLen, size_t width, bool leftAlign)
+{
+  const size_t FieldLen = prefixLen + zeroCount + dataLen;
+  size_t PadCount = (width > FieldLen ? width - FieldLen : 0);
+  if (leftAlign == false) for (; PadCount > 0; --PadCount) __SC16IS7XX_PrintfChar(pWriter, ' ');
+  for (size_t z = 0; z < prefixLen; ++z) __SC16IS7XX_PrintfChar(pWriter, prefix[z]);
+  for (; zeroCount > 0; --zeroCount) __SC16IS7XX_PrintfChar(pWriter, '0');
+  for (size_t z = 0; z < dataLen; ++z) __SC16IS7XX_PrintfChar(pWriter, data[z]);
+  for (; PadCount > 0; --PadCount) __SC16IS7XX_PrintfChar(pWriter, ' ');    // Left alignment pads after the data
+}
+
 
 
-//**********************************************************************************************************************************************************
 //=============================================================================
-// Try to transmit data to UART FIFO of the SC16IS7XX UART
+// [STATIC] Convert an unsigned value to digits
 //=============================================================================
-eERRORRESULT SC16IS7XX_TransmitData(SC16IS7XX_UART *pUART, uint8_t *data, size_t size, size_t *actuallySent)
+char* __SC16IS7XX_PrintfUintToStr(char* pEnd, unsigned long long value, unsigned int base, bool upperCase)
+{
+  const char* const DigitChars = (upperCase ? "0123456789ABCDEF" : "0123456789abcdef");
+  char* pDigit = pEnd;
+  while (value > UINT32_MAX)                                                 // Divide on 64 bits only while the value needs it
+  {
+    *--pDigit = DigitChars[value % base];
+    value /= base;
+  }
+  uint32_t Value32 = (uint32_t)value;
+  do
+  {
+    *--pDigit = DigitChars[Value32 % base];
+    Value32 /= base;
+  } while (Value32 > 0);
+  return pDigit;
+}
+
+
+
+//=============================================================================
+// [STATIC] Publish the pending chars of a formatted output and send the Tx buffer to the Tx FIFO
+//=============================================================================
+void __SC16IS7XX_PrintfFlush(SC16IS7XX_PrintfWriter* pWriter, bool waitRoom)
+{
+  if (pWriter->Error != ERR_OK) return;
+  SC16IS7XX_UART* const pUART = pWriter->pUART;
+  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
+  eERRORRESULT Error;
+  __SC16IS7XX_AdvanceBufferIn(pBuf, pWriter->Pending);                       // Publish the chars written
+  pWriter->Pending = 0;
+  while (true)
+  {
+    if ((pUART->DriverConfig & SC16IS7XX_DRIVER_IRQ_SERVICE) > 0)
+         Error = __SC16IS7XX_UnmaskTxInterrupt(pUART);                        // The Tx buffer is sent by SC16IS7XX_ServiceInterrupt()
+    else Error = SC16IS7XX_FlushTxBufferToFIFO(pUART);
+    if ((Error != ERR_OK) && (Error != ERR__BUSY) && (Error != ERR__SPI_BUSY) && (Error != ERR__I2C_BUSY)) { pWriter->Error = Error; return; } // If there is an error while calling SC16IS7XX_FlushTxBufferToFIFO() then keep the error
+    const size_t DataCount = __SC16IS7XX_GetBufferDataCount(pBuf);
+    pWriter->Space = SC16IS7XX_BUFFER_CAPACITY(pBuf) - DataCount;
+    if ((waitRoom == false) || (pWriter->Space > 0)) return;
+    Error = __SC16IS7XX_WaitBeforePoll(pUART, pWriter->StartTime, (uint32_t)(DataCount > SC16IS7XX_FIFO_SIZE ? SC16IS7XX_FIFO_SIZE : DataCount)); // The Tx FIFO is full, wait the room for the data
+    if (Error != ERR_OK) { pWriter->Error = Error; return; }                // If there is an error while calling __SC16IS7XX_WaitBeforePoll() then keep the error
+  }
+}
+
+
+
+//=============================================================================
+// Service the interrupts of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_ServiceInterrupt(SC16IS7XX_UART *pUART)
 {
 #ifdef CHECK_NULL_PARAM
-  if ((pUART == NULL) || (data == NULL) || (actuallySent == NULL)) return ERR__PARAMETER_ERROR;
+  if (pUART == NULL) return ERR__PARAMETER_ERROR;
 #endif
   SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
 #ifdef CHECK_NULL_PARAM
   if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
 #endif
-  const bool IsSafeTX = ((pUART->DriverConfig & SC16IS7XX_DRIVER_SAFE_TX) > 0);
-  eERRORRESULT Error;
-  *actuallySent = 0;
-
-#ifdef SC16IS7XX_USE_BUFFERS
-  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
-  size_t AvailableBufSize;
-  if ((pBuf->pData != NULL) && (IsSafeTX == false) && (pBuf->IsFull == false))
-  {
-    //--- Move data to Tx buffer ---
-    if (pBuf->PosIn >= pBuf->PosOut)
-         AvailableBufSize = pBuf->BufferSize - pBuf->PosIn;                            // Calculate space available to the end of buffer
-    else AvailableBufSize = pBuf->PosOut - pBuf->PosIn;                                // Calculate space available to Out position
-    *actuallySent = (size > AvailableBufSize ? AvailableBufSize : size);               // Set how many data will be store into the Tx buffer
-    if (*actuallySent > 0)
-    {
-      memcpy(&pBuf->pData[pBuf->PosIn], data, *actuallySent);                          // Copy data to Tx buffer
-      pBuf->PosIn += *actuallySent;                                                    // Increment In position
-      if (pBuf->PosIn >= pBuf->BufferSize) pBuf->PosIn -= pBuf->BufferSize;            // Correct In position
-      pBuf->IsFull = (pBuf->PosIn == pBuf->PosOut);                                    // If after incrementing both In and Out are at the same position then the buffer is full
-    }
-  }
-#endif
-
-  //--- Get free space on Tx FIFO ---
-  uint8_t AvailableSpace;
-  Error = SC16IS7XX_GetAvailableSpaceTxFIFO(pUART, &AvailableSpace);                   // Get how many space there is in the transmit FIFO
-  if (Error != ERR_OK) return Error;                                                   // If there is an error while calling SC16IS7XX_GetAvailableSpaceTxFIFO() then return the error
+  const bool IsSafeRX   = ((pUART->DriverConfig & SC16IS7XX_DRIVER_SAFE_RX) > 0);
+  const bool IsHybridRX = ((pUART->DriverConfig & SC16IS7XX_DRIVER_HYBRID_RX) > 0) && (IsSafeRX == false);
+  eERRORRESULT Error, ErrorReturn = ERR_OK;
+  SC16IS7XX_IIR_Register RegIIR;
+  uint8_t RegValue;
 
-  //--- Send data if possible ---
-  if (IsSafeTX)                                                                        //*** Safe transmit
+  for (size_t zLoop = 0; zLoop < SC16IS7XX_SERVICE_INTERRUPT_MAX_LOOPS; ++zLoop)
   {
-    size_t CountToSend = (size > (size_t)AvailableSpace ? (size_t)AvailableSpace : size);
-    while (CountToSend > 0)
+    Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_IIR, &RegIIR.IIR);              // Read the IIR register. This also clears the THR, Xoff and CTS/RTS interrupts
+    if (Error != ERR_OK) return Error;                                                                 // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+    if ((RegIIR.IIR & SC16IS7XX_IIR_INTERRUPT_PENDING_Mask) == SC16IS7XX_IIR_NO_INTERRUPT_PENDING) break; // No more interrupt pending
+    const eSC16IS7XX_InterruptSource Source = (eSC16IS7XX_InterruptSource)SC16IS7XX_IIR_INTERRUT_SOURCE_GET(RegIIR.IIR);
+    bool DrainRxFIFO = false;
+
+    switch (Source)
     {
-      Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_THR, *data);
-      if (Error != ERR_OK) return Error;                                               // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
-      ++(*actuallySent);
-      ++data;
-      --CountToSend;
+      case SC16IS7XX_RECEIVER_LINE_STATUS:                                                             //*** Receive Line Status error
+        Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_LSR, &RegValue);            // Read the LSR register. This clears the interrupt
+        if (Error != ERR_OK) return Error;                                                             // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+        pUART->RxErrors |= (setSC16IS7XX_ReceiveError)(RegValue & (uint8_t)SC16IS7XX_RX_ERROR_Mask);   // Record the receive errors
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+        if ((pUART->pTriggerControl != NULL) && ((RegValue & SC16IS7XX_LSR_OVERRUN_ERROR) > 0)) pUART->pTriggerControl->OverrunCount++; // The Rx interrupt was serviced too late
+#endif
+        DrainRxFIFO = ((RegValue & SC16IS7XX_LSR_DATA_IN_RX_FIFO) > 0);                                // Read the Rx FIFO data to recover
+        break;
+      case SC16IS7XX_RECEIVER_TIMEOUT:                                                                 //*** Receiver time-out interrupt
+      case SC16IS7XX_RHR_INTERRUPT:                                                                    //*** RHR interrupt
+        DrainRxFIFO = true;
+        break;
+      case SC16IS7XX_THR_INTERRUPT:                                                                    //*** THR interrupt
+        if (pUART->TxBuffer.pData == NULL) break;                                                      // No Tx buffer, the interrupt is cleared by the IIR read
+        if (pUART->TxBuffer.PosOut == pUART->TxBuffer.PosIn)                                           // Nothing to send
+        {
+          if ((pUART->DriverConfig & SC16IS7XX_DRIVER_IRQ_SERVICE) == 0) break;                        // The next transmit writes the Tx FIFO directly
+          pUART->TxIERmasked = SC16IS7XX_IER_THR_INTERRUPT_ENABLE;                                     // The producer enables it again when it adds data. Set before the mask to not miss a commit
+          SC16IS7XX_MEMORY_BARRIER();                                                                  // The flag shall be set before the data check below
+          Error = SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, SC16IS7XX_IER_THR_INTERRUPT_DISABLE, SC16IS7XX_IER_THR_INTERRUPT_ENABLE); // Mask the THR interrupt, enabling it again gives a new THR interrupt
+          if (Error != ERR_OK) return Error;                                                           // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
+          Error = __SC16IS7XX_UnmaskTxInterrupt(pUART);                                                // The producer added data before seeing the flag
+          if (Error != ERR_OK) return Error;                                                           // If there is an error while calling __SC16IS7XX_UnmaskTxInterrupt() then return the error
+          break;
+        }
+        Error = SC16IS7XX_GetAvailableSpaceTxFIFO(pUART, &RegValue);                                   // Get how many space there is in the transmit FIFO
+        if (Error != ERR_OK) return Error;                                                             // If there is an error while calling SC16IS7XX_GetAvailableSpaceTxFIFO() then return the error
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+        if (pUART->pTriggerControl != NULL)
+        {
+          SC16IS7XX_TriggerControl* const pControl = pUART->pTriggerControl;
+          const uint8_t Latency = (RegValue > pControl->TxTrigger ? (uint8_t)(RegValue - pControl->TxTrigger) : 0); // Chars sent between the interrupt and the TXLVL read
+          if (Latency > pControl->TxLatencyMax) pControl->TxLatencyMax = Latency;
+          pControl->TxServiceCount++;
+        }
+#endif
+        Error = __SC16IS7XX_TxBufferToTxFIFO(pUART, RegValue);                                         // Refill the Tx FIFO
+        if (Error != ERR_OK) return Error;                                                             // If there is an error while calling __SC16IS7XX_TxBufferToTxFIFO() then return the error
+        break;
+      case SC16IS7XX_MODEM_INTERRUPT:                                                                  //*** Modem interrupt
+        Error = SC16IS7XX_GetControlPinStatus(pUART, &RegValue);                                       // Read the MSR register. This clears the interrupt
+        if (Error != ERR_OK) return Error;                                                             // If there is an error while calling SC16IS7XX_GetControlPinStatus() then return the error
+        if (pUART->fnInterruptEvent != NULL) pUART->fnInterruptEvent(pUART, Source, RegValue);
+        break;
+      case SC16IS7XX_INPUT_PIN_CHANGE_STATE:                                                           //*** Input pin change of state
+        Error = SC16IS7XX_ReadRegister(pComp, SC16IS7XX_NO_CHANNEL, RegSC16IS7XX_IOState, &RegValue);  // Read the IOState register. This clears the interrupt
+        if (Error != ERR_OK) return Error;                                                             // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+        if (pUART->fnInterruptEvent != NULL) pUART->fnInterruptEvent(pUART, Source, RegValue);
+        break;
+      case SC16IS7XX_RECEIVED_XOFF_SIGNAL:                                                             //*** Received Xoff signal/special character
+      case SC16IS7XX_CTS_RTS_CHANGE_LOW_TO_HIGH:                                                       //*** CTS, RTS change of state from active (LOW) to inactive (HIGH)
+        if (pUART->fnInterruptEvent != NULL) pUART->fnInterruptEvent(pUART, Source, 0);                // The interrupt is cleared by the IIR read
+        break;
+      default: return ERR__UNKNOWN_ELEMENT;
     }
-  }
-  else                                                                                 //*** Burst transmit
-  {
-    size_t DataSizeToSend = 0;
-    uint8_t* pData;
 
-#ifdef SC16IS7XX_USE_BUFFERS
-    if (pBuf->pData != NULL)
+    //--- Drain the Rx FIFO ---
+    if (DrainRxFIFO)
     {
-      pData = &pBuf->pData[pBuf->PosOut];                                              // Select data to send
-      //--- Calculate data size to send ---
-      if ((pBuf->PosOut != pBuf->PosIn) || pBuf->IsFull)                               // Only if there are data to send
+      if (pUART->RxBuffer.pData == NULL) return ERR__NULL_BUFFER;                                      // No Rx buffer to store the data
+      if (__SC16IS7XX_GetBufferContiguousSpace(&pUART->RxBuffer) == 0)                                 // The application shall get data from the Rx buffer
       {
-        if (pBuf->PosOut >= pBuf->PosIn)
-             AvailableBufSize = pBuf->BufferSize - pBuf->PosIn;                        // Calculate space available to the end of buffer
-        else AvailableBufSize = pBuf->PosIn - pBuf->PosOut;                            // Calculate space available to Out position
-        DataSizeToSend = (AvailableBufSize > (size_t)AvailableSpace ? (size_t)AvailableSpace : AvailableBufSize); // Set how many data will actually be sent
-        if (DataSizeToSend > 0)
+        Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, &RegValue);            // Read the IER register
+        if (Error != ERR_OK) return Error;                                                             // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+        const uint8_t RxIER = RegValue & (SC16IS7XX_IER_RHR_INTERRUPT_ENABLE | SC16IS7XX_IER_RLS_INTERRUPT_ENABLE);
+        pUART->RxIERmasked |= RxIER;                                                                   // The consumer enables them again when it frees space in the Rx buffer. Set before the mask to not miss a consume
+        SC16IS7XX_MEMORY_BARRIER();                                                                    // The flag shall be set before the space check below
+        Error = SC16IS7XX_WriteRegister(pComp, pUART->Channel, RegSC16IS7XX_IER, (RegValue & ~RxIER)); // Mask the Rx interrupts, else the pending Rx interrupt would fire again at once
+        if (Error != ERR_OK) return Error;                                                             // If there is an error while calling SC16IS7XX_WriteRegister() then return the error
+        if (__SC16IS7XX_GetBufferContiguousSpace(&pUART->RxBuffer) > 0)                                // The consumer freed space before seeing the flag
         {
-          pBuf->PosOut += DataSizeToSend;                                              // Increment Out position
-          if (pBuf->PosOut >= pBuf->BufferSize) pBuf->PosOut -= pBuf->BufferSize;      // Correct Out position
-          pBuf->IsFull = false;                                                        // If data will be send, then the buffer will not be full
+          Error = __SC16IS7XX_UnmaskRxInterrupts(pUART);                                               // Enable again the Rx interrupts
+          if (Error != ERR_OK) return Error;                                                           // If there is an error while calling __SC16IS7XX_UnmaskRxInterrupts() then return the error
         }
+        else ErrorReturn = ERR__BUFFER_FULL;
+        continue;                                                                                      // Service the other interrupt sources
+      }
+      Error = SC16IS7XX_GetDataCountRxFIFO(pUART, &RegValue);                                          // Get how many characters there is in the receive FIFO
+      if (Error != ERR_OK) return Error;                                                               // If there is an error while calling SC16IS7XX_GetDataCountRxFIFO() then return the error
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+      if (pUART->pTriggerControl != NULL)
+      {
+        SC16IS7XX_TriggerControl* const pControl = pUART->pTriggerControl;
+        pControl->RxBytes += RegValue;
+        const uint8_t Latency = (RegValue > pControl->RxTrigger ? (uint8_t)(RegValue - pControl->RxTrigger) : 0); // Chars received between the interrupt and the RXLVL read
+        if ((Source == SC16IS7XX_RHR_INTERRUPT) && (Latency > pControl->RxLatencyMax)) pControl->RxLatencyMax = Latency; // Only the RHR interrupt fires at the trigger level
       }
-    }
-    else
 #endif
-    {
-      *actuallySent = (size > (size_t)AvailableSpace ? (size_t)AvailableSpace : size); // Set how many data will actually be sent
-      DataSizeToSend = *actuallySent;
-      pData = data;
+      if (IsSafeRX || IsHybridRX)
+        Error = __SC16IS7XX_RxFIFOtoRxBufferChecked(pUART, RegValue, IsSafeRX);                        // Drain the Rx FIFO with the LSR check of the chars
+      else Error = __SC16IS7XX_RxFIFOtoRxBuffer(pUART, RegValue);                                      // Drain the Rx FIFO
+      if (Error == ERR__RECEIVE_ERROR) { ErrorReturn = Error; break; }                                // The erroneous char is the last one of the RxBuffer, the next service continues the drain
+      if (Error != ERR_OK) return Error;                                                          // If there is an error while calling __SC16IS7XX_RxFIFOtoRxBuffer() then return the error
     }
-    return __SC16IS7XX_WriteData(pComp, pUART->Channel, RegSC16IS7XX_THR, pData, DataSizeToSend); // Send all possible data at once
   }
-  return ERR_OK;
-}
-
-#ifdef USE_GENERICS_DEFINED
-eERRORRESULT SC16IS7XX_TransmitData_Gen(UART_Interface *pIntDev, uint8_t *data, size_t size, size_t *actuallySent)
-{
-#ifdef CHECK_NULL_PARAM
-  if (pIntDev == NULL) return ERR__PARAMETER_ERROR;
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+  if (pUART->pTriggerControl != NULL)
+  {
+    Error = __SC16IS7XX_TriggerControlService(pUART);                      // Account the service and adjust the trigger levels
+    if (Error != ERR_OK) return Error;                                     // If there is an error while calling __SC16IS7XX_TriggerControlService() then return the error
+  }
 #endif
-  SC16IS7XX_UART* pUART = (SC16IS7XX_UART*)(pIntDev->InterfaceDevice); // Get the SC16IS7XX_UART device of this UART port
-  return SC16IS7XX_TransmitData(pUART, data, size, actuallySent);
+  return ErrorReturn;
 }
-#endif
 
 
 
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
 //=============================================================================
-// Transmit a char to UART FIFO of the SC16IS7XX UART
+// [STATIC] Account a service and adjust the trigger levels of the SC16IS7XX UART
 //=============================================================================
-eERRORRESULT SC16IS7XX_TransmitChar(SC16IS7XX_UART *pUART, const char data)
+eERRORRESULT __SC16IS7XX_TriggerControlService(SC16IS7XX_UART *pUART)
 {
-  eERRORRESULT Error;
-  uint8_t DataToSend = (uint8_t)data;
-  size_t ActuallySent = 0;
-  do
+  SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
+  SC16IS7XX_TriggerControl* const pControl = pUART->pTriggerControl;
+  const uint16_t WindowServices = (pControl->WindowServices > 0 ? pControl->WindowServices : SC16IS7XX_TRIGGER_CONTROL_WINDOW);
+  if (++pControl->ServiceCount < WindowServices) return ERR_OK;
+  if ((pControl->RxTrigger == 0) || (pControl->TxTrigger == 0)) return ERR_OK;          // The trigger levels are not known, the UART shall be initialized after setting pTriggerControl
+  const uint32_t CharTimeus = (pUART->CharTimeus > 0 ? pUART->CharTimeus : 1u);
+
+  //--- Publish the measurements of the window ---
+  if (pComp->fnGetCurrentms != NULL)
   {
-    Error = SC16IS7XX_TransmitData(pUART, &DataToSend, 1, &ActuallySent);
-    if (Error != ERR_OK) return Error; // If there is an error while calling SC16IS7XX_TransmitData() then return the error
-  } while (ActuallySent == 0);
-  return ERR_OK;
+    const uint32_t Currentms = pComp->fnGetCurrentms();
+    const uint32_t Elapsedms = SC16IS7XX_TIME_DIFF(pControl->WindowStartms, Currentms);
+    pControl->InterruptRate = ((uint32_t)pControl->ServiceCount * 1000u) / (Elapsedms > 0 ? Elapsedms : 1u);
+    pControl->WindowStartms = Currentms;
+  }
+  pControl->BytesPerService = (uint16_t)(pControl->RxBytes / pControl->ServiceCount);
+  pControl->Latencyus = (uint32_t)(pControl->RxLatencyMax > pControl->TxLatencyMax ? pControl->RxLatencyMax : pControl->TxLatencyMax) * CharTimeus;
+
+  //--- Calculate the Rx trigger level ---
+  int32_t RxTrigger = pControl->RxTrigger;
+  int32_t RxMax = (int32_t)SC16IS7XX_FIFO_SIZE - (int32_t)pControl->RxHeadroomMin - (int32_t)pControl->RxLatencyMax; // Keep the headroom with the latency observed
+  if ((pControl->MaxLatencyus > 0) && ((int32_t)(pControl->MaxLatencyus / CharTimeus) < RxMax)) RxMax = (int32_t)(pControl->MaxLatencyus / CharTimeus); // A char waits up to the trigger level
+  if (pControl->OverrunCount > 0) RxTrigger /= 2;                                        // An overrun occurred, lower the trigger level at once
+  else if (RxTrigger > RxMax) RxTrigger = RxMax;                                         // Out of bounds, lower the trigger level at once
+  else if (((RxTrigger + (int32_t)SC16IS7XX_TRIGGER_LEVEL_STEP) <= RxMax) && (pControl->BytesPerService >= RxTrigger)) RxTrigger += SC16IS7XX_TRIGGER_LEVEL_STEP; // The traffic fills the trigger level, raise it one step to have fewer interrupts
+
+  //--- Calculate the Tx trigger level ---
+  int32_t TxTrigger = pControl->TxTrigger;
+  const int32_t TxMax = (int32_t)SC16IS7XX_FIFO_SIZE - (int32_t)pControl->TxHeadroomMin - (int32_t)pControl->TxLatencyMax; // Keep chars in the Tx FIFO with the latency observed
+  if (TxTrigger > TxMax) TxTrigger = TxMax;                                              // Out of bounds, lower the trigger level at once
+  else if (((TxTrigger + (int32_t)SC16IS7XX_TRIGGER_LEVEL_STEP) <= TxMax) && (pControl->TxServiceCount > 0)) TxTrigger += SC16IS7XX_TRIGGER_LEVEL_STEP; // Raise it one step to have fewer interrupts
+
+  //--- Start a new window ---
+  pControl->ServiceCount   = 0;
+  pControl->OverrunCount   = 0;
+  pControl->RxBytes        = 0;
+  pControl->RxLatencyMax   = 0;
+  pControl->TxLatencyMax   = 0;
+  pControl->TxServiceCount = 0;
+
+  //--- Set the new trigger levels ---
+  const int32_t LevelMin = (int32_t)SC16IS7XX_TRIGGER_LEVEL_STEP, LevelMax = (int32_t)(SC16IS7XX_FIFO_SIZE - SC16IS7XX_TRIGGER_LEVEL_STEP); // The TLR trigger levels are from 4 to 60
+  if (RxTrigger < LevelMin) RxTrigger = LevelMin;
+  if (RxTrigger > LevelMax) RxTrigger = LevelMax;
+  if (TxTrigger < LevelMin) TxTrigger = LevelMin;
+  if (TxTrigger > LevelMax) TxTrigger = LevelMax;
+  const eSC16IS7XX_IntRxTriggerLevel RxTrigLvl = (eSC16IS7XX_IntRxTriggerLevel)(RxTrigger / (int32_t)SC16IS7XX_TRIGGER_LEVEL_STEP); // Round down to the granularity
+  const eSC16IS7XX_IntTxTriggerLevel TxTrigLvl = (eSC16IS7XX_IntTxTriggerLevel)(TxTrigger / (int32_t)SC16IS7XX_TRIGGER_LEVEL_STEP);
+  if (((RxTrigLvl * SC16IS7XX_TRIGGER_LEVEL_STEP) == pControl->RxTrigger) && ((TxTrigLvl * SC16IS7XX_TRIGGER_LEVEL_STEP) == pControl->TxTrigger)) return ERR_OK; // Nothing to change
+  return SC16IS7XX_SetTriggerLevels(pUART, TxTrigLvl, RxTrigLvl);
 }
+#endif
 
 
 
-#ifdef SC16IS7XX_USE_BUFFERS
 //=============================================================================
-// Flush data from UART Tx Buffer to the FIFO of the SC16IS7XX UART
+// Poll several SC16IS7XX UARTs and service the most urgent first
 //=============================================================================
-eERRORRESULT SC16IS7XX_FlushTxBufferToFIFO(SC16IS7XX_UART *pUART)
+eERRORRESULT SC16IS7XX_PollUARTs(SC16IS7XX_Poller *pPoller)
 {
-  size_t ActuallySent;   // Dummy
-  uint8_t DummyByte = 0; // Dummy
-  return SC16IS7XX_TransmitData(pUART, &DummyByte, 0, &ActuallySent); // This will put 0 bytes into Tx FIFO and will trigger a send to UART Tx FIFO
+#ifdef CHECK_NULL_PARAM
+  if ((pPoller == NULL) || (pPoller->pUARTs == NULL)) return ERR__PARAMETER_ERROR;
+#endif
+  const size_t UARTcount = pPoller->UARTcount;
+  if (UARTcount > SC16IS7XX_POLLER_MAX_UART) return ERR__CONFIGURATION;
+  if ((pPoller->MaxIntervalus > 0) && (pPoller->MinIntervalus > pPoller->MaxIntervalus)) return ERR__CONFIGURATION;
+  for (size_t zUART = 0; zUART < UARTcount; ++zUART)
+    if ((pPoller->pUARTs[zUART] != NULL) && ((pPoller->pUARTs[zUART]->DriverConfig & SC16IS7XX_DRIVER_IRQ_SERVICE) > 0)) return ERR__CONFIGURATION; // The FIFOs of this UART can only be accessed by SC16IS7XX_ServiceInterrupt()
+  if (UARTcount == 0) return ERR_OK;
+  eERRORRESULT Error, ErrorReturn = ERR_OK;
+  uint32_t Deadline[SC16IS7XX_POLLER_MAX_UART]; // Time in microseconds before the Rx FIFO overflows or the Tx FIFO is empty. UINT32_MAX if nothing to do
+  uint8_t RxFIFOcount[SC16IS7XX_POLLER_MAX_UART];
+  uint8_t TxFIFOspace[SC16IS7XX_POLLER_MAX_UART];
+  bool Serviced[SC16IS7XX_POLLER_MAX_UART];
+
+  //--- Read the FIFO levels of each UART ---
+  for (size_t zUART = 0; zUART < UARTcount; ++zUART)
+  {
+    SC16IS7XX_UART* pUART = pPoller->pUARTs[zUART];
+    Deadline[zUART]    = UINT32_MAX;
+    RxFIFOcount[zUART] = 0;
+    TxFIFOspace[zUART] = 0;
+    Serviced[zUART]    = false;
+    if (pUART == NULL) continue;
+    const uint32_t CharTimeus = (pUART->CharTimeus > 0 ? pUART->CharTimeus : 1u);
+    if ((pUART->RxBuffer.pData != NULL) && (__SC16IS7XX_GetBufferContiguousSpace(&pUART->RxBuffer) > 0)) // Nothing can be received while the Rx buffer is full
+    {
+      Error = SC16IS7XX_GetDataCountRxFIFO(pUART, &RxFIFOcount[zUART]);                  // Get how many characters there is in the receive FIFO
+      if (Error != ERR_OK) return Error;                                                 // If there is an error while calling SC16IS7XX_GetDataCountRxFIFO() then return the error
+      if (RxFIFOcount[zUART] > SC16IS7XX_FIFO_SIZE) RxFIFOcount[zUART] = SC16IS7XX_FIFO_SIZE;
+      if (RxFIFOcount[zUART] > 0) Deadline[zUART] = (SC16IS7XX_FIFO_SIZE - RxFIFOcount[zUART]) * CharTimeus;
+    }
+    if ((pUART->TxBuffer.pData != NULL) && (__SC16IS7XX_GetBufferDataCount(&pUART->TxBuffer) > 0))    // Only the UARTs with data to send can starve
+    {
+      Error = SC16IS7XX_GetAvailableSpaceTxFIFO(pUART, &TxFIFOspace[zUART]);             // Get how many space there is in the transmit FIFO
+      if (Error != ERR_OK) return Error;                                                 // If there is an error while calling SC16IS7XX_GetAvailableSpaceTxFIFO() then return the error
+      if (TxFIFOspace[zUART] > SC16IS7XX_FIFO_SIZE) TxFIFOspace[zUART] = SC16IS7XX_FIFO_SIZE;
+      const uint32_t TxDeadline = ((SC16IS7XX_FIFO_SIZE - TxFIFOspace[zUART]) + 1u) * CharTimeus; // The Tx FIFO data and the char in the TSR. An Rx overflow comes first at equal fill
+      if ((TxFIFOspace[zUART] > 0) && (TxDeadline < Deadline[zUART])) Deadline[zUART] = TxDeadline;
+    }
+  }
+
+  //--- Service the most urgent UARTs first ---
+  size_t ServiceCount = pPoller->MaxServicePerPass;
+  if ((ServiceCount == 0) || (ServiceCount > UARTcount)) ServiceCount = UARTcount;
+  if (pPoller->NextUART >= UARTcount) pPoller->NextUART = 0;
+  for (; ServiceCount > 0; --ServiceCount)
+  {
+    size_t MostUrgent = UARTcount;
+    uint32_t MostUrgentDeadline = UINT32_MAX;
+    for (size_t zScan = 0; zScan < UARTcount; ++zScan)
+    {
+      size_t zUART = pPoller->NextUART + zScan;                                          // Start at NextUART to rotate the UARTs of the same urgency
+      if (zUART >= UARTcount) zUART -= UARTcount;
+      if ((Serviced[zUART] == false) && (Deadline[zUART] < MostUrgentDeadline)) { MostUrgent = zUART; MostUrgentDeadline = Deadline[zUART]; }
+    }
+    if (MostUrgent >= UARTcount) break;                                                  // No more UART to service
+    SC16IS7XX_UART* pUART = pPoller->pUARTs[MostUrgent];
+    const bool IsSafeRX   = ((pUART->DriverConfig & SC16IS7XX_DRIVER_SAFE_RX) > 0);
+    const bool IsHybridRX = ((pUART->DriverConfig & SC16IS7XX_DRIVER_HYBRID_RX) > 0) && (IsSafeRX == false);
+    if (IsSafeRX || IsHybridRX)
+      Error = __SC16IS7XX_RxFIFOtoRxBufferChecked(pUART, RxFIFOcount[MostUrgent], IsSafeRX); // Drain the Rx FIFO with the LSR check of the chars
+    else Error = __SC16IS7XX_RxFIFOtoRxBuffer(pUART, RxFIFOcount[MostUrgent]);           // Drain the Rx FIFO
+    if (Error == ERR__RECEIVE_ERROR) ErrorReturn = Error;                                // The erroneous char is the last one of the RxBuffer, the next pass continues the drain
+    else if (Error != ERR_OK) return Error;                                              // If there is an error while calling __SC16IS7XX_RxFIFOtoRxBuffer() then return the error
+    Error = __SC16IS7XX_TxBufferToTxFIFO(pUART, TxFIFOspace[MostUrgent]);                // Refill the Tx FIFO
+    if (Error != ERR_OK) return Error;                                                   // If there is an error while calling __SC16IS7XX_TxBufferToTxFIFO() then return the error
+    Serviced[MostUrgent] = true;
+  }
+  if (++pPoller->NextUART >= UARTcount) pPoller->NextUART = 0;
+
+  //--- Adapt the poll interval ---
+  uint32_t NextDeadline = UINT32_MAX;
+  for (size_t zUART = 0; zUART < UARTcount; ++zUART)
+  {
+    uint32_t UARTdeadline = Deadline[zUART];
+    if (Serviced[zUART])                                                                 // A serviced UART with traffic can fill its Rx FIFO or empty its Tx FIFO in a FIFO size time
+      UARTdeadline = SC16IS7XX_FIFO_SIZE * (pPoller->pUARTs[zUART]->CharTimeus > 0 ? pPoller->pUARTs[zUART]->CharTimeus : 1u);
+    if (UARTdeadline < NextDeadline) NextDeadline = UARTdeadline;
+  }
+  uint32_t Intervalus;
+  if (NextDeadline == UINT32_MAX)                                                        // No traffic, slow down the polling
+    Intervalus = (pPoller->Intervalus == 0 ? 1u : (pPoller->Intervalus > (UINT32_MAX / 2) ? UINT32_MAX : pPoller->Intervalus * 2));
+  else Intervalus = NextDeadline / 2;                                                    // Traffic, poll again before half of the time left on the most urgent UART
+  if (Intervalus < pPoller->MinIntervalus) Intervalus = pPoller->MinIntervalus;
+  if ((pPoller->MaxIntervalus > 0) && (Intervalus > pPoller->MaxIntervalus)) Intervalus = pPoller->MaxIntervalus; // 0 is no maximum
+  pPoller->Intervalus = Intervalus;
+  return ErrorReturn;
 }
 #endif
 
 
 
+
+
+//**********************************************************************************************************************************************************
 //=============================================================================
-// Flush all data in TxBuffer, UART FIFO and TSR empty of the SC16IS7XX UART
+// Get control pins (CD, RI, DSR, CTS) status of the SC16IS7XX device
 //=============================================================================
-eERRORRESULT SC16IS7XX_WaitEndTx(SC16IS7XX_UART *pUART)
+eERRORRESULT SC16IS7XX_GetControlPinStatus(SC16IS7XX_UART *pUART, uint8_t *controlPinsStatus)
 {
 #ifdef CHECK_NULL_PARAM
   if (pUART == NULL) return ERR__PARAMETER_ERROR;
 #endif
   SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
-  eERRORRESULT Error;
-
-#ifdef SC16IS7XX_USE_BUFFERS
-  SC16IS7XX_Buffer* const pBuf = &pUART->TxBuffer;
-  //--- Flush Tx buffer ---
-  if (pBuf->pData != NULL)
-    while (pBuf->IsFull || (pBuf->PosIn != pBuf->PosOut))
-    {
-      Error = SC16IS7XX_FlushTxBufferToFIFO(pUART);
-      if ((Error != ERR_OK) && (Error != ERR__BUSY) && (Error != ERR__SPI_BUSY) && (Error != ERR__I2C_BUSY)) return Error; // If there is an error while calling SC16IS7XX_FlushTxBufferToFIFO() then return the error
-    }
+#ifdef CHECK_NULL_PARAM
+  if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
 #endif
+  if (SC16IS7XX_KEEP_TLR_ACCESS(pUART) == false)
+    return SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_MSR, controlPinsStatus); // Read the MSR register
+  eERRORRESULT Error;
 
-  //--- Wait end FIFO empty and TSR empty ---
-  SC16IS7XX_LSR_Register RegLSR;
-  while (true)
-  {
-    Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_LSR, &RegLSR.LSR); // Read the LSR register
-    if (Error != ERR_OK) return Error;                                                    // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
-    if (SC16IS7XX_IS_THR_AND_TSR_EMPTY(RegLSR.LSR)) break;
-  }
-  return ERR_OK;
+  //--- MSR is at the TCR address, disable TCR and TLR access while reading it ---
+  Error = SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_DISABLE, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask);
+  if (Error != ERR_OK) return Error;                                                         // If there is an error while calling SC16IS7XX_ModifyRegister() then return the error
+  Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_MSR, controlPinsStatus); // Read the MSR register
+  if (Error != ERR_OK) return Error;                                                         // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
+  return SC16IS7XX_ModifyRegister(pComp, pUART->Channel, RegSC16IS7XX_MCR, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask); // Enable again the TCR and TLR access for the adaptive trigger levels
 }
 
 
 
-
-
-//**********************************************************************************************************************************************************
-#ifdef SC16IS7XX_USE_BUFFERS
 //=============================================================================
-// [STATIC] Transfer available data from Rx buffer of the UART
+// Get control pins (CD, RI, DSR, CTS) status of the SC16IS7XX device
 //=============================================================================
-void __SC16IS7XX_RxBufferToDataBuff(SC16IS7XX_Buffer* const pBuf, uint8_t *data, size_t *size, size_t *actuallyReceived)
+bool SC16IS7XX_IsClearToSend(SC16IS7XX_UART *pUART)
 {
-  size_t AvailableBufSize;
-  if ((pBuf->PosOut != pBuf->PosIn) || pBuf->IsFull)                           // Only if there are data in the buffer
-  {
-    if (pBuf->PosOut >= pBuf->PosIn)
-         AvailableBufSize = pBuf->BufferSize - pBuf->PosOut;                   // Calculate data available to the end of buffer
-    else AvailableBufSize = pBuf->PosIn - pBuf->PosOut;                        // Calculate data available to In position
-    *actuallyReceived = (*size > AvailableBufSize ? AvailableBufSize : *size); // Set how many data will be store into the Tx buffer
-    if (*actuallyReceived > 0)
-    {
-      memcpy(data, &pBuf->pData[pBuf->PosOut], *actuallyReceived);             // Copy data from Rx buffer
-      *size -= *actuallyReceived;                                              // Subtract the size of data with actually received
-      pBuf->PosOut += *actuallyReceived;                                       // Increment Out position
-      if (pBuf->PosOut >= pBuf->BufferSize) pBuf->PosOut -= pBuf->BufferSize;  // Correct Out position
-      pBuf->IsFull = false;                                                    // If data are removed from buffer, then the buffer is no longer full
-    }
-  }
+  eERRORRESULT Error;
+  uint8_t Value;
+
+  //--- Get control pins status ---
+  Error = SC16IS7XX_GetControlPinStatus(pUART, &Value);
+  if (Error != ERR_OK) return false;                    // If there is an error while calling SC16IS7XX_GetControlPinStatus() then return that the communication is not clear to send
+  return ((Value & SC16IS7XX_MSR_CTS_PIN_IS_HIGH) > 0); // Return the Clear To Send status
 }
-#endif
 
 
 
+
+
+//**********************************************************************************************************************************************************
+#ifdef SC16IS7XX_USE_NON_BLOCKING_TRANSFERS
 //=============================================================================
-// Receive available data from UART FIFO of the SC16IS7XX
+// [STATIC] Start a non-blocking transfer with the SC16IS7XX UART
 //=============================================================================
-eERRORRESULT SC16IS7XX_ReceiveData(SC16IS7XX_UART *pUART, uint8_t *data, size_t size, size_t *actuallyReceived, setSC16IS7XX_ReceiveError *lastDataError)
+eERRORRESULT __SC16IS7XX_StartNonBlockingTransfer(SC16IS7XX_UART *pUART, const uint8_t address, uint8_t *data, size_t size, bool isRead)
 {
 #ifdef CHECK_NULL_PARAM
-  if ((pUART == NULL) || (data == NULL) || (actuallyReceived == NULL) || (lastDataError == NULL)) return ERR__PARAMETER_ERROR;
+  if ((pUART == NULL) || (data == NULL)) return ERR__PARAMETER_ERROR;
 #endif
   SC16IS7XX* pComp = pUART->Device; // Get the SC16IS7XX device of this UART
 #ifdef CHECK_NULL_PARAM
   if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
 #endif
-  const bool IsSafeRX = ((pUART->DriverConfig & SC16IS7XX_DRIVER_SAFE_RX) > 0);
-  eERRORRESULT Error;
-  SC16IS7XX_LSR_Register RegLSR;
-
-#ifdef SC16IS7XX_USE_BUFFERS
-  SC16IS7XX_Buffer* const pBuf = &pUART->RxBuffer;
-  //--- Move data from Rx buffer ---
-  if ((pBuf->pData != NULL) && (IsSafeRX == false)) __SC16IS7XX_RxBufferToDataBuff(pBuf, data, &size, actuallyReceived);
+  if (pUART->TransferInProgress) return ERR__BUSY;                         // Only one non-blocking transfer at a time per UART
+  if (size == 0) return ERR_OK;
+  eERRORRESULT Error = ERR_OK;
+  uint8_t TransactionNumber = 0;
+  uint8_t Address = SC16IS7XX_CHANNEL_SET(pUART->Channel) | SC16IS7XX_ADDRESS_SET(address);
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  Error = __SC16IS7XX_WritePendingLCR(pComp, pUART->Channel);              // Write back a deferred LCR before accessing the register
+  if (Error != ERR_OK) return Error;                                       // If there is an error while calling __SC16IS7XX_WritePendingLCR() then return the error
 #endif
 
-  //--- Get available data count in Rx FIFO ---
-  uint8_t AvailableData;
-  *actuallyReceived = 0;
-  Error = SC16IS7XX_GetDataCountRxFIFO(pUART, &AvailableData);                                     // Get how many characters there is in the receive FIFO
-  if (Error != ERR_OK) return Error;                                                               // If there is an error while calling SC16IS7XX_GetDataCountRxFIFO() then return the error
-
-  //--- Send data if possible ---
-  if (IsSafeRX)                                                                                    //*** Safe receive
+#ifdef SC16IS7XX_I2C_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
   {
-    size_t CountToGet = (size > (size_t)AvailableData ? (size_t)AvailableData : size);
-    while (CountToGet > 0)
+    I2C_Interface* pI2C = GET_I2C_INTERFACE;
+# if defined(CHECK_NULL_PARAM)
+#   if defined(USE_DYNAMIC_INTERFACE)
+    if (pI2C == NULL) return ERR__PARAMETER_ERROR;
+#   endif
+    if (pI2C->fnI2C_Transfer == NULL) return ERR__PARAMETER_ERROR;
+# endif
+    uint8_t ChipAddrW = (pComp->I2Caddress & I2C_WRITE_ANDMASK);
+
+    //--- Send the address ---
+    I2CInterface_Packet AddrPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, true, &Address, sizeof(uint8_t), false, (isRead ? I2C_WRITE_THEN_READ_FIRST_PART : I2C_WRITE_THEN_WRITE_FIRST_PART));
+    Error = pI2C->fnI2C_Transfer(pI2C, &AddrPacketDesc);              // Transfer the address
+    if (Error == ERR__I2C_NACK) return ERR__NOT_READY;                // If the device receive a NAK, then the device is not ready
+    if (Error == ERR__I2C_OTHER_BUSY) return ERR__BUSY;               // The interface is busy with another transfer, retry later
+    if (Error != ERR_OK) return Error;                                // If there is an error while calling fnI2C_Transfer() then return the Error
+    //--- Start the data transfer ---
+    I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, false, data, size, true, I2C_WRITE_THEN_WRITE_SECOND_PART);
+    if (isRead)
     {
-      //--- Verify current char ---
-      Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_LSR, &RegLSR.LSR);        // Read the LSR register
-      if (Error != ERR_OK) return Error;                                                           // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
-      *lastDataError = (setSC16IS7XX_ReceiveError)(RegLSR.LSR & (uint8_t)SC16IS7XX_RX_ERROR_Mask); // Get last received char error
-      Error = SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_RHR, data);               // Receive the next char in FIFO
-      if (Error != ERR_OK) return Error;                                                           // If there is an error while calling SC16IS7XX_ReadRegister() then return the error
-      (*actuallyReceived)++;
-      if (*lastDataError != SC16IS7XX_NO_RX_ERROR) return ERR__RECEIVE_ERROR;
-      data++;
-      CountToGet--;
+      DataPacketDesc.Config.Bits.TransferType = I2C_WRITE_THEN_READ_SECOND_PART;
+      DataPacketDesc.ChipAddr = (ChipAddrW | I2C_READ_ORMASK);        // Restart at first data read transfer
+      DataPacketDesc.Start    = true;
     }
+    DataPacketDesc.Config.Value |= I2C_USE_NON_BLOCKING;              // Ask for a non-blocking transfer with a new transaction number
+    Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc);              // Start the data transfer and stop transfer at last byte
+    TransactionNumber = DataPacketDesc.Config.Bits.TransactionInc;    // Get the transaction number given by the interface
+    if ((Error != ERR_OK) && (Error != ERR__I2C_BUSY) && (Error != ERR__BUSY))
+      __SC16IS7XX_EndFailedTransfer(pComp);                           // The data transfer has not been accepted, the stop may not have been sent, free the bus
   }
-  else                                                                                           //*** Burst receive
+#endif
+#ifdef SC16IS7XX_SPI_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_SPI)
   {
-    size_t DataSizeToGet = 0;
-    uint8_t* pData;
+    SPI_Interface* pSPI = GET_SPI_INTERFACE;
+# if defined(CHECK_NULL_PARAM)
+#   if defined(USE_DYNAMIC_INTERFACE)
+    if (pSPI == NULL) return ERR__PARAMETER_ERROR;
+#   endif
+    if (pSPI->fnSPI_Transfer == NULL) return ERR__PARAMETER_ERROR;
+# endif
+    Address |= (isRead ? SC16IS7XX_SPI_READ : SC16IS7XX_SPI_WRITE);
 
-#ifdef SC16IS7XX_USE_BUFFERS
-    size_t AvailableBufSize;
-    if (pBuf->pData != NULL)
+    //--- Send the address ---
+    SPIInterface_Packet AddrPacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Address, sizeof(uint8_t), false); // Prepare SPI packet description to use
+    Error = pSPI->fnSPI_Transfer(pSPI, &AddrPacketDesc);                                               // Transfer the address
+    if (Error == ERR__SPI_OTHER_BUSY) return ERR__BUSY;                                                // The interface is busy with another transfer, retry later
+    if (Error != ERR_OK) return Error;                                                                 // If there is an error while calling fnSPI_Transfer() then return the Error
+    //--- Start the data transfer ---
+    SPIInterface_Packet DataPacketDesc = SPI_INTERFACE_TX_DATA_DESC(data, size, true);                 // Prepare SPI packet description to use
+    if (isRead)
     {
-      pData = &pBuf->pData[pBuf->PosIn];                                                         // Select data to get
-      //--- Calculate data size to get ---
-      if (pBuf->IsFull == false)                                                                 // Only if the buffer is not full
-      {
-         if (pBuf->PosIn >= pBuf->PosOut)
-              AvailableBufSize = pBuf->BufferSize - pBuf->PosIn;                                 // Calculate data available to the end of buffer
-         else AvailableBufSize = pBuf->PosOut - pBuf->PosIn;                                     // Calculate data available to Out position
-         DataSizeToGet = (AvailableBufSize > (size_t)AvailableData ? (size_t)AvailableData : AvailableBufSize); // Set how many data will actually be received
-         if (DataSizeToGet > 0)
-         {
-           pBuf->PosIn += DataSizeToGet;                                                         // Increment In position
-           if (pBuf->PosIn >= pBuf->BufferSize) pBuf->PosIn -= pBuf->BufferSize;                 // Correct In position
-           pBuf->IsFull = (pBuf->PosOut == pBuf->PosIn);                                         // Buffer is full only if the buffer positions are the same after retrieving data
-         }
-      }
+      DataPacketDesc.Config.Value |= SPI_USE_DUMMYBYTE_FOR_RECEIVE;                                    // Receive the data using dummy bytes
+      DataPacketDesc.TxData = NULL;
+      DataPacketDesc.RxData = data;
     }
-    else
+    DataPacketDesc.Config.Value |= SPI_USE_POLLING;                                                    // Ask for a non-blocking transfer with a new transaction number
+    Error = pSPI->fnSPI_Transfer(pSPI, &DataPacketDesc);                                               // Start the data transfer and stop transfer at last byte
+    TransactionNumber = DataPacketDesc.Config.Bits.TransactionInc;                                     // Get the transaction number given by the interface
+    if ((Error != ERR_OK) && (Error != ERR__SPI_BUSY) && (Error != ERR__BUSY))
+      __SC16IS7XX_EndFailedTransfer(pComp);                                                            // The data transfer has not been accepted, release the chip select
+  }
 #endif
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+  if ((Error == ERR_OK) || (Error == ERR__BUSY) || (Error == ERR__SPI_BUSY) || (Error == ERR__I2C_BUSY))
+    __SC16IS7XX_CountTransaction(pComp, pUART->Channel, address, size, isRead); // Account the transaction
+#endif
+#ifdef SC16IS7XX_USE_TRACE
+  pUART->pTransferData = NULL;
+  if ((Error == ERR_OK) && (pComp->pTrace != NULL))
+    __SC16IS7XX_TraceAccess(pComp, pUART->Channel, address, data, size, (isRead ? SC16IS7XX_TRACE_READ : 0)); // The interface performed a blocking transfer, record the access
+  if (((Error == ERR__BUSY) || (Error == ERR__SPI_BUSY) || (Error == ERR__I2C_BUSY)) && (pComp->pTrace != NULL))
+  {
+    if (isRead)                                                            // The data are not received yet, the read is recorded by SC16IS7XX_PollTransfer() at its completion
     {
-      *actuallyReceived = (size > (size_t)AvailableData ? (size_t)AvailableData : size);         // Set how many data will actually be received
-      DataSizeToGet = *actuallyReceived;
-      pData = data;
-    }
-    Error = __SC16IS7XX_ReadData(pComp, pUART->Channel, RegSC16IS7XX_RHR, pData, DataSizeToGet); // Receive all possible data at once
-#ifdef SC16IS7XX_USE_BUFFERS
-    if ((Error == ERR_OK) && (pBuf->pData != NULL))                                              // Not a DMA transfer (otherwise Error would be ERR__BUSY, ERR__SPI_BUSY, or ERR__I2C_BUSY)
-    {
-      //--- Move data from Rx buffer ---
-      __SC16IS7XX_RxBufferToDataBuff(pBuf, data, &size, actuallyReceived);                       // Copy the new data received to data buffer
+      pUART->pTransferData   = data;
+      pUART->TransferSize    = size;
+      pUART->TransferAddress = address;
     }
-    else
+    else __SC16IS7XX_TraceAccess(pComp, pUART->Channel, address, data, size, SC16IS7XX_TRACE_NON_BLOCKING); // Record the write
+  }
 #endif
-    return Error;
+#ifdef SC16IS7XX_USE_TX_CREDIT
+  if (((Error == ERR_OK) || (Error == ERR__BUSY) || (Error == ERR__SPI_BUSY) || (Error == ERR__I2C_BUSY)) && (isRead == false))
+    __SC16IS7XX_TrackTxCredit(pComp, pUART->Channel, address, data, size, false); // Data written are accounted at start, data read are not available yet
+#endif
+  if ((Error == ERR__BUSY) || (Error == ERR__SPI_BUSY) || (Error == ERR__I2C_BUSY)) // The non-blocking transfer has been accepted and is in progress
+  {
+    pUART->TransactionNumber  = TransactionNumber;
+    pUART->TransferInProgress = true;
+    return ERR_OK;
   }
+  if (Error != ERR_OK) return Error;                                       // If there is an error while starting the transfer then return the Error
+  if (pUART->fnTransferComplete != NULL) pUART->fnTransferComplete(pUART, ERR_OK); // The interface performed a blocking transfer, the transfer is already complete
   return ERR_OK;
 }
 
-#ifdef USE_GENERICS_DEFINED
-eERRORRESULT SC16IS7XX_ReceiveData_Gen(UART_Interface *pIntDev, uint8_t *data, size_t size, size_t *actuallyReceived, uint8_t *lastDataError)
+
+
+//=============================================================================
+// Start a non-blocking burst transmit to the Tx FIFO of the SC16IS7XX UART
+//=============================================================================
+eERRORRESULT SC16IS7XX_StartTransmitBurst(SC16IS7XX_UART *pUART, uint8_t *data, size_t size)
 {
-#ifdef CHECK_NULL_PARAM
-  if (pIntDev == NULL) return ERR__PARAMETER_ERROR;
-#endif
-  SC16IS7XX_UART* pUART = (SC16IS7XX_UART*)(pIntDev->InterfaceDevice); // Get the SC16IS7XX_UART device of this UART port
-  return SC16IS7XX_ReceiveData(pUART, data, size, actuallyReceived, lastDataError);
+  return __SC16IS7XX_StartNonBlockingTransfer(pUART, RegSC16IS7XX_THR, data, size, false);
 }
-#endif
 
 
 
 //=============================================================================
-// Receive a char from UART FIFO of the SC16IS7XX
+// Start a non-blocking burst receive from the Rx FIFO of the SC16IS7XX UART
 //=============================================================================
-eERRORRESULT SC16IS7XX_ReceiveChar(SC16IS7XX_UART *pUART, char *data, setSC16IS7XX_ReceiveError *charError)
+eERRORRESULT SC16IS7XX_StartReceiveBurst(SC16IS7XX_UART *pUART, uint8_t *data, size_t size)
 {
-  eERRORRESULT Error;
-  size_t ActuallyReceived = 0;
-  do
-  {
-    Error = SC16IS7XX_ReceiveData(pUART, (uint8_t*)data, 1, &ActuallyReceived, charError);
-    if (Error != ERR_OK) return Error; // If there is an error while calling SC16IS7XX_ReceiveData() then return the error
-  } while (ActuallyReceived == 0);
-  return ERR_OK;
+  return __SC16IS7XX_StartNonBlockingTransfer(pUART, RegSC16IS7XX_RHR, data, size, true);
 }
 
 
 
-#ifdef SC16IS7XX_USE_BUFFERS
 //=============================================================================
-// Retrieve data from Rx UART FIFO of the SC16IS7XX UART to the Rx Buffer
+// Start a non-blocking read of a register of the SC16IS7XX UART
 //=============================================================================
-eERRORRESULT SC16IS7XX_RetrieveRxFIFOtoBuffer(SC16IS7XX_UART *pUART)
+eERRORRESULT SC16IS7XX_StartReadRegister(SC16IS7XX_UART *pUART, const uint8_t registerAddr, uint8_t *registerValue)
 {
-  size_t ActuallyReceived;                 // Dummy
-  uint8_t DummyByte = 0;                   // Dummy
-  setSC16IS7XX_ReceiveError LastDataError; // Dummy
-  return SC16IS7XX_ReceiveData(pUART, &DummyByte, 0, &ActuallyReceived, &LastDataError); // This will get 0 bytes into Rx data and will trigger a get from UART Rx FIFO
+  return __SC16IS7XX_StartNonBlockingTransfer(pUART, registerAddr, registerValue, 1, true);
 }
-#endif
 
 
 
-
-
-//**********************************************************************************************************************************************************
 //=============================================================================
-// Get control pins (CD, RI, DSR, CTS) status of the SC16IS7XX device
+// Poll the non-blocking transfer of the SC16IS7XX UART
 //=============================================================================
-eERRORRESULT SC16IS7XX_GetControlPinStatus(SC16IS7XX_UART *pUART, uint8_t *controlPinsStatus)
+eERRORRESULT SC16IS7XX_PollTransfer(SC16IS7XX_UART *pUART)
 {
 #ifdef CHECK_NULL_PARAM
   if (pUART == NULL) return ERR__PARAMETER_ERROR;
@@ -1674,24 +4395,48 @@ eERRORRESULT SC16IS7XX_GetControlPinStatus(SC16IS7XX_UART *pUART, uint8_t *contr
 #ifdef CHECK_NULL_PARAM
   if (pComp == NULL) return ERR__UNKNOWN_DEVICE;
 #endif
-  return SC16IS7XX_ReadRegister(pComp, pUART->Channel, RegSC16IS7XX_MSR, controlPinsStatus); // Read the MSR register
-}
-
-
-
-//=============================================================================
-// Get control pins (CD, RI, DSR, CTS) status of the SC16IS7XX device
-//=============================================================================
-bool SC16IS7XX_IsClearToSend(SC16IS7XX_UART *pUART)
-{
-  eERRORRESULT Error;
-  uint8_t Value;
+  if (pUART->TransferInProgress == false) return ERR_OK;                   // No transfer in progress
+  eERRORRESULT Error = ERR_OK;
 
-  //--- Get control pins status ---
-  Error = SC16IS7XX_GetControlPinStatus(pUART, &Value);
-  if (Error != ERR_OK) return false;                    // If there is an error while calling SC16IS7XX_GetControlPinStatus() then return that the communication is not clear to send
-  return ((Value & SC16IS7XX_MSR_CTS_PIN_IS_HIGH) > 0); // Return the Clear To Send status
+#ifdef SC16IS7XX_I2C_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_I2C)
+  {
+    I2C_Interface* pI2C = GET_I2C_INTERFACE;
+# if defined(CHECK_NULL_PARAM)
+#   if defined(USE_DYNAMIC_INTERFACE)
+    if (pI2C == NULL) return ERR__PARAMETER_ERROR;
+#   endif
+    if (pI2C->fnI2C_Transfer == NULL) return ERR__PARAMETER_ERROR;
+# endif
+    I2CInterface_Packet PacketDesc = I2C_INTERFACE8_CHECK_DMA_DESC(pComp->I2Caddress, pUART->TransactionNumber);
+    Error = pI2C->fnI2C_Transfer(pI2C, &PacketDesc);                 // Check the transfer status
+  }
+#endif
+#ifdef SC16IS7XX_SPI_DEFINED
+  if (pComp->Interface == SC16IS7XX_INTERFACE_SPI)
+  {
+    SPI_Interface* pSPI = GET_SPI_INTERFACE;
+# if defined(CHECK_NULL_PARAM)
+#   if defined(USE_DYNAMIC_INTERFACE)
+    if (pSPI == NULL) return ERR__PARAMETER_ERROR;
+#   endif
+    if (pSPI->fnSPI_Transfer == NULL) return ERR__PARAMETER_ERROR;
+# endif
+    SPIInterface_Packet PacketDesc = SPI_INTERFACE_CHECK_DMA_DESC(pUART->TransactionNumber);
+    Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);                 // Check the transfer status
+  }
+#endif
+  if ((Error == ERR__BUSY) || (Error == ERR__SPI_BUSY) || (Error == ERR__I2C_BUSY)) return ERR__BUSY; // The transfer is still in progress
+  pUART->TransferInProgress = false;
+#ifdef SC16IS7XX_USE_TRACE
+  if ((Error == ERR_OK) && (pUART->pTransferData != NULL) && (pComp->pTrace != NULL))
+    __SC16IS7XX_TraceAccess(pComp, pUART->Channel, pUART->TransferAddress, pUART->pTransferData, pUART->TransferSize, SC16IS7XX_TRACE_READ | SC16IS7XX_TRACE_NON_BLOCKING); // Record the read with the data received
+  pUART->pTransferData = NULL;
+#endif
+  if (pUART->fnTransferComplete != NULL) pUART->fnTransferComplete(pUART, Error); // Signal the end of the transfer
+  return Error;
 }
+#endif
 
 
 
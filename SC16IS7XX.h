@@ -1,8 +1,8 @@
 /*!*****************************************************************************
  * @file    SC16IS7XX.h
  * @author  Fabien 'Emandhal' MAILLY
- * @version 1.0.2
- * @date    18/06/2023
+ * @version 1.0.3
+ * @date    15/10/2026
  * @brief   SC16IS740, SC16IS741, SC16IS741A, SC16IS750, SC16IS752, SC16IS760,
  *          SC16IS762 driver
  * @details The SC16IS7XX component is a Single/Double UART with I2C-bus/SPI
@@ -39,6 +39,32 @@
  *****************************************************************************/
 
 /* Revision history:
+ * 1.0.3    Add optional shadow registers (SC16IS7XX_USE_SHADOW_REGISTERS)
+ *          Add optional single packet SPI register access (SC16IS7XX_USE_SPI_SINGLE_PACKET)
+ *          Add optional register scripts (SC16IS7XX_USE_REGISTER_SCRIPT) and fnGetCurrentms
+ *          Add optional non-blocking transfers (SC16IS7XX_USE_NON_BLOCKING_TRANSFERS)
+ *          Add SC16IS7XX_GetChannelSnapshot()
+ *          Add optional bus statistics (SC16IS7XX_USE_BUS_STATISTICS)
+ *          Add optional shared bus request queue (SC16IS7XX_USE_BUS_QUEUE)
+ *          Add optional header-only fast path (SC16IS7XX_USE_FAST_PATH)
+ *          Add optional register access trace (SC16IS7XX_USE_TRACE)
+ *          Add optional LCR bank tracking and bank sessions (SC16IS7XX_USE_BANK_TRACKING)
+ *          Add SC16IS7XX_ServiceInterrupt()
+ *          Add optional Tx FIFO credit tracking (SC16IS7XX_USE_TX_CREDIT)
+ *          Add hybrid receive mode (SC16IS7XX_DRIVER_HYBRID_RX)
+ *          Tx/Rx buffers are now handled across their wrap point in one call
+ *          Add SC16IS7XX_TxReserve() and SC16IS7XX_TxCommit()
+ *          Add SC16IS7XX_RxPeek() and SC16IS7XX_RxConsume()
+ *          Tx/Rx buffers are now single-producer/single-consumer rings without the IsFull flag, they now hold BufferSize-1 bytes
+ *          Add interrupt service mode (SC16IS7XX_DRIVER_IRQ_SERVICE)
+ *          Add optional power-of-two buffers with free-running positions (SC16IS7XX_USE_POW2_BUFFERS)
+ *          Add SC16IS7XX_ReceiveUntil()
+ *          Add timeout and sleep hooks for the blocking functions (fnSleep and BlockingTimeoutms)
+ *          Add SC16IS7XX_TransmitDataV()
+ *          Add SC16IS7XX_Printf() and SC16IS7XX_VPrintf()
+ *          Add SC16IS7XX_PollUARTs() to poll several UARTs without IRQ lines
+ *          Add SC16IS7XX_SetTriggerLevels() and optional adaptive trigger levels (SC16IS7XX_USE_ADAPTIVE_TRIGGER)
+ *          Add optional Rx timestamps per Rx FIFO burst (SC16IS7XX_USE_RX_TIMESTAMPS) and SC16IS7XX_GetRxTimestamp()
  * 1.0.1    GPIO interface rework
  * 1.0.1    I2C interface rework for I2C DMA use and polling
  *          Add Tx and Rx ring buffers
@@ -53,6 +79,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <stdarg.h>
 //-----------------------------------------------------------------------------
 
 #if (defined(SC16IS7XX_ONLY_I2C) || !defined(SC16IS7XX_ONLY_SPI)) && !defined(SC16IS7XX_I2C_DEFINED)
@@ -63,6 +90,10 @@
 #  define SC16IS7XX_SPI_DEFINED
 #endif
 
+#if defined(SC16IS7XX_SPI_DEFINED) && defined(SC16IS7XX_USE_SPI_SINGLE_PACKET) && !defined(SC16IS7XX_SPI_SCRATCH_BUFFER_SIZE)
+#  define SC16IS7XX_SPI_SCRATCH_BUFFER_SIZE  ( 8 ) //! Size of the scratch buffer (address + data) of single packet SPI accesses. Accesses with more data use separate address and data transfers
+#endif
+
 //-----------------------------------------------------------------------------
 #include "ErrorsDef.h"
 #ifdef SC16IS7XX_I2C_DEFINED
@@ -108,6 +139,7 @@
 #define SC16IS7XX_I2C_CLOCK_MAX   (   400000u ) //! Max I2C clock frequency
 #define SC16IS7XX_SPI_CLOCK_MAX   (  4000000u ) //! Max SPI clock frequency for SC16IS740/741/750/752
 #define SC16IS76X_SPI_CLOCK_MAX   ( 15000000u ) //! Max SPI clock frequency for SC16IS760/762
+#define SC16IS7XX_FIFO_SIZE       (       64u ) //! Size of the Tx and Rx FIFOs
 
 //-----------------------------------------------------------------------------
 
@@ -879,12 +911,14 @@ SC16IS7XX_CONTROL_ITEM_SIZE(SC16IS7XX_I2Ccommand, 1);
 #define SC16IS7XX_CHANNEL_Pos          1
 #define SC16IS7XX_CHANNEL_Mask         (0x3u << SC16IS7XX_CHANNEL_Pos)
 #define SC16IS7XX_CHANNEL_SET(value)   (((uint8_t)(value) << SC16IS7XX_CHANNEL_Pos) & SC16IS7XX_CHANNEL_Mask)               //!< Set Channels bits
-#define SC16IS7XX_CHANNEL_GET(value)   ((eSC16IS7XX_Channels)(((value) & SC16IS7XX_CHANNEL_Mask) >> SC16IS7XX_CHANNEL_Pos)) //!< Get Channels bits
+#define SC16IS7XX_CHANNEL_GET(value)   ((eSC16IS7XX_Channel)(((value) & SC16IS7XX_CHANNEL_Mask) >> SC16IS7XX_CHANNEL_Pos)) //!< Get Channels bits
 #define SC16IS7XX_ADDRESS_Pos          3
 #define SC16IS7XX_ADDRESS_Mask         (0xFu << SC16IS7XX_ADDRESS_Pos)
 #define SC16IS7XX_ADDRESS_SET(value)   (((uint8_t)(value) << SC16IS7XX_ADDRESS_Pos) & SC16IS7XX_ADDRESS_Mask) //!< Set Address bits
 #define SC16IS7XX_ADDRESS_GET(value)   (((value) & SC16IS7XX_ADDRESS_Mask) >> SC16IS7XX_ADDRESS_Pos)          //!< Get Address bits
 
+#define SC16IS7XX_REGISTER_ADDRESS_COUNT  16 //!< Count of register addresses per channel
+
 //-----------------------------------------------------------------------------
 
 //! Interface select
@@ -917,6 +951,209 @@ typedef struct SC16IS7XX SC16IS7XX; //! SC16IS7XX component object structure
 
 //-----------------------------------------------------------------------------
 
+/*! @brief Function that gives the current millisecond of the system to the driver
+ *
+ * This function will be called when the driver need to get current millisecond
+ * @return Returns the current millisecond of the system
+ */
+typedef uint32_t (*SC16IS7XX_GetCurrentms_Func)(void);
+
+/*! @brief Function that lets the system sleep or yield while the driver waits the device
+ *
+ * This function will be called by the blocking functions of the driver before polling the device again
+ * @param[in] *pComp Is the pointed structure of the device that waits
+ * @param[in] durationus Is the expected time in microseconds before the device can progress. The function can return earlier (yield) or later
+ */
+typedef void (*SC16IS7XX_Sleep_Func)(SC16IS7XX *pComp, uint32_t durationus);
+
+//-----------------------------------------------------------------------------
+
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+//! Register banks of the SC16IS7XX. The bank accessed at an address depends on the LCR value, and on MCR[2] and EFR[4] for the TCR and TLR registers
+typedef enum
+{
+  SC16IS7XX_BANK_GENERAL,  //!< General register set (LCR[7] = 0)
+  SC16IS7XX_BANK_TCR_TLR,  //!< TCR and TLR registers (LCR[7] = 0, MCR[2] = 1 and EFR[4] = 1)
+  SC16IS7XX_BANK_SPECIAL,  //!< Special register set (LCR[7] = 1 and LCR ≠ 0xBF)
+  SC16IS7XX_BANK_ENHANCED, //!< Enhanced register set (LCR = 0xBF)
+  SC16IS7XX_BANK_COUNT,    // Keep last
+  SC16IS7XX_BANK_UNKNOWN = SC16IS7XX_BANK_COUNT, //!< The bank cannot be determined because LCR, MCR or EFR value is not known
+} eSC16IS7XX_RegisterBank;
+
+//! Shadow registers of a SC16IS7XX channel
+typedef struct SC16IS7XX_ShadowRegisters
+{
+  uint8_t Value[SC16IS7XX_BANK_COUNT][SC16IS7XX_REGISTER_ADDRESS_COUNT]; //!< Last known value of each register of each bank
+  uint16_t Valid[SC16IS7XX_BANK_COUNT];                                  //!< Register value known flags of each bank (one bit per register address)
+} SC16IS7XX_ShadowRegisters;
+#endif
+
+//-----------------------------------------------------------------------------
+
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+//! Register bank state of a SC16IS7XX channel
+typedef struct SC16IS7XX_BankState
+{
+  uint8_t LCR;          //!< Current LCR value of the channel in the device. Valid only if IsKnown is set
+  uint8_t PendingLCR;   //!< LCR value to write back before the next access of a register of the channel. Valid only if IsPending is set
+  uint8_t SessionDepth; //!< Count of nested bank sessions in progress on the channel
+  bool IsKnown;         //!< Indicate that the LCR value of the channel is known
+  bool IsPending;       //!< Indicate that a return to general registers has been deferred by a bank session
+} SC16IS7XX_BankState;
+#endif
+
+//-----------------------------------------------------------------------------
+
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+//! Bus transaction counters structure
+typedef struct SC16IS7XX_BusCounters
+{
+  uint32_t Transactions;  //!< Count of transactions (one register address sent followed by data)
+  uint32_t PayloadBytes;  //!< Count of data bytes read or written
+  uint32_t OverheadBytes; //!< Count of other bytes on the bus: register address byte with SPI, chip address and register address bytes with I2C
+} SC16IS7XX_BusCounters;
+
+//! Bus statistics structure of a SC16IS7XX device, split by channel and register address
+typedef struct SC16IS7XX_BusStatistics
+{
+  SC16IS7XX_BusCounters Read[SC16IS7XX_CHANNEL_COUNT][SC16IS7XX_REGISTER_ADDRESS_COUNT];  //!< Read transactions counters
+  SC16IS7XX_BusCounters Write[SC16IS7XX_CHANNEL_COUNT][SC16IS7XX_REGISTER_ADDRESS_COUNT]; //!< Write transactions counters
+} SC16IS7XX_BusStatistics;
+#endif
+
+//-----------------------------------------------------------------------------
+
+#ifdef SC16IS7XX_USE_TRACE
+#ifndef SC16IS7XX_TRACE_DATA_SIZE
+#  define SC16IS7XX_TRACE_DATA_SIZE  4 //!< Count of first data bytes recorded in each trace entry
+#endif
+
+//! Trace entry flags
+typedef enum
+{
+  SC16IS7XX_TRACE_READ         = 0x01, //!< The access is a read, else this is a write
+  SC16IS7XX_TRACE_LCR_KNOWN    = 0x02, //!< The LCR field holds the LCR value of the channel at the time of the access, else the register bank is unknown
+  SC16IS7XX_TRACE_NON_BLOCKING = 0x04, //!< The access is a non-blocking transfer. A write is recorded at its start, a read at its completion by SC16IS7XX_PollTransfer() with the data received
+} eSC16IS7XX_TraceFlags;
+
+//! Trace entry structure. The entries are packed so that a dump of the entries can be decoded on a host (see Tools/SC16IS7XXtraceDecoder.c)
+SC16IS7XX_PACKITEM
+typedef struct __SC16IS7XX_PACKED__ SC16IS7XX_TraceEntry
+{
+  uint32_t Timestamp;                      //!< Millisecond of the access given by fnGetCurrentms (0 if fnGetCurrentms is NULL)
+  uint16_t CallSite;                       //!< Call site tag set with SC16IS7XX_SetTraceCallSite() at the time of the access
+  uint8_t Command;                         //!< Channel and register address of the access, formatted as the register address byte sent to the device (see SC16IS7XX_CHANNEL_SET() and SC16IS7XX_ADDRESS_SET())
+  uint8_t Flags;                           //!< Access flags (#eSC16IS7XX_TraceFlags)
+  uint8_t LCR;                             //!< LCR value of the channel at the time of the access, which selects the register bank. Valid only if SC16IS7XX_TRACE_LCR_KNOWN is set
+  uint8_t Size;                            //!< Count of data bytes of the access (saturated to 255)
+  uint8_t Data[SC16IS7XX_TRACE_DATA_SIZE]; //!< First data bytes of the access
+} SC16IS7XX_TraceEntry;
+SC16IS7XX_UNPACKITEM
+
+//! Trace ring structure
+typedef struct SC16IS7XX_Trace
+{
+  SC16IS7XX_TraceEntry* pEntries;           //!< Entries array where the accesses are recorded
+  size_t EntryCount;                        //!< Count of entries of the pEntries array
+  size_t PosIn;                             //!< Next entry to write. No need to fill, set at trace start
+  uint32_t TotalCount;                      //!< Count of accesses recorded since trace start. No need to fill, set at trace start. When greater than EntryCount, the oldest entries have been overwritten
+  uint16_t CallSite;                        //!< Current call site tag. No need to fill, set at trace start
+  uint8_t LastLCR[SC16IS7XX_CHANNEL_COUNT]; //!< Last LCR value seen on the bus for each channel. No need to fill
+  uint8_t LCRknown;                         //!< Channels with a known LastLCR value (one bit per channel). No need to fill, cleared at trace start
+} SC16IS7XX_Trace;
+#endif
+
+//-----------------------------------------------------------------------------
+
+#ifdef SC16IS7XX_USE_BUS_QUEUE
+//! Bus request priorities. Requests with a lower value are executed first
+typedef enum
+{
+  SC16IS7XX_PRIORITY_RX_DRAIN, //!< Rx FIFO drain requests
+  SC16IS7XX_PRIORITY_TX_FILL,  //!< Tx FIFO fill requests
+  SC16IS7XX_PRIORITY_CONFIG,   //!< Configuration requests
+  SC16IS7XX_PRIORITY_COUNT,    // Keep last
+} eSC16IS7XX_BusPriority;
+
+typedef struct SC16IS7XX_BusRequest SC16IS7XX_BusRequest; //! SC16IS7XX bus request structure
+
+/*! @brief Bus request execution function
+ *
+ * This function will be called by the bus owner to execute the request. It can use all the driver functions of the devices on the bus
+ * @param[in] *pRequest Is the pointed structure of the request to execute
+ * @return Returns an #eERRORRESULT value enum
+ */
+typedef eERRORRESULT (*SC16IS7XX_BusRequest_Func)(SC16IS7XX_BusRequest *pRequest);
+
+/*! @brief Bus queue lock function
+ *
+ * This function will be called when the bus queue needs to be protected against concurrent accesses (ex: disable interrupts)
+ */
+typedef void (*SC16IS7XX_BusLock_Func)(void);
+
+//! SC16IS7XX bus request structure
+struct SC16IS7XX_BusRequest
+{
+  SC16IS7XX_BusRequest_Func fnExecute; //!< This function will be called to execute the request
+  void *pContext;                      //!< Optional, can be used to store the context of the request (ex: the UART to drain) or NULL
+  volatile eERRORRESULT Result;        //!< Result of the request execution. No need to fill, set when the request is done
+  volatile bool IsDone;                //!< Indicate that the request has been executed. No need to fill, cleared at submission
+  volatile bool IsQueued;              //!< Indicate that the request is in the queue, waiting for its execution. Set to 'false' before the first submission. No need to fill after
+  SC16IS7XX_BusRequest *pNext;         //!< Next request in the queue. Only used with the queue locked. No need to fill
+};
+
+//! SC16IS7XX bus queue structure. All devices that use the same SPI or I2C interface should attach to the same bus queue
+//! The driver functions do not submit requests by themselves: the application wraps its driver calls (ex: a Rx FIFO drain) in requests and submits them with SC16IS7XX_SubmitBusRequest()
+typedef struct SC16IS7XX_BusQueue
+{
+  SC16IS7XX_BusLock_Func fnLock;                       //!< This function will be called to enter a critical section on the queue. Can be NULL if the queue is used in only one context
+  SC16IS7XX_BusLock_Func fnUnlock;                     //!< This function will be called to exit the critical section on the queue. Can be NULL if the queue is used in only one context
+  SC16IS7XX_BusRequest *pHead[SC16IS7XX_PRIORITY_COUNT]; //!< First request of each priority. No need to fill, set to NULL at initialization
+  SC16IS7XX_BusRequest *pTail[SC16IS7XX_PRIORITY_COUNT]; //!< Last request of each priority. No need to fill, set to NULL at initialization
+  volatile bool IsOwned;                               //!< Indicate that a bus owner is executing the requests. No need to fill, set to 'false' at initialization
+} SC16IS7XX_BusQueue;
+#endif
+
+//-----------------------------------------------------------------------------
+
+#ifdef SC16IS7XX_USE_REGISTER_SCRIPT
+//! Register script operations
+typedef enum
+{
+  SC16IS7XX_SCRIPT_WRITE          = 0x0, //!< Write Value to the register
+  SC16IS7XX_SCRIPT_MODIFY         = 0x1, //!< Modify the register. Bits set to '1' in Mask are set to the Value's corresponding bits
+  SC16IS7XX_SCRIPT_SET_ACCESS     = 0x2, //!< Set register access to Value (#eSC16IS7XX_AccessTo). The original LCR value of the channel is saved for the next SC16IS7XX_SCRIPT_RESTORE_ACCESS of the same channel, do not nest them on a channel
+  SC16IS7XX_SCRIPT_RESTORE_ACCESS = 0x3, //!< Return access to general registers with the LCR value saved by the last SC16IS7XX_SCRIPT_SET_ACCESS of the channel
+  SC16IS7XX_SCRIPT_DELAY          = 0x4, //!< Wait at least Value milliseconds. Needs the fnGetCurrentms function of the device, uses the fnSleep function of the device if set
+} eSC16IS7XX_ScriptOperation;
+
+//! Register script step structure
+typedef struct SC16IS7XX_ScriptStep
+{
+  uint8_t Operation; //!< Operation of the step (#eSC16IS7XX_ScriptOperation)
+  uint8_t Command;   //!< Channel and register address of the step, formatted as the register address byte sent to the device (see SC16IS7XX_CHANNEL_SET() and SC16IS7XX_ADDRESS_SET())
+  uint8_t Value;     //!< Value to write, register access to set or delay in milliseconds
+  uint8_t Mask;      //!< Bits to modify for the SC16IS7XX_SCRIPT_MODIFY operation
+} SC16IS7XX_ScriptStep;
+
+//! Script step helpers, to write constant scripts
+#define SC16IS7XX_SCRIPT_WRITE_STEP(channel,addr,value)       { SC16IS7XX_SCRIPT_WRITE         , SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(addr), (value), 0x00   }
+#define SC16IS7XX_SCRIPT_MODIFY_STEP(channel,addr,value,mask) { SC16IS7XX_SCRIPT_MODIFY        , SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(addr), (value), (mask) }
+#define SC16IS7XX_SCRIPT_SET_ACCESS_STEP(channel,accessTo)    { SC16IS7XX_SCRIPT_SET_ACCESS    , SC16IS7XX_CHANNEL_SET(channel)                                , (uint8_t)(accessTo), 0x00 }
+#define SC16IS7XX_SCRIPT_RESTORE_ACCESS_STEP(channel)         { SC16IS7XX_SCRIPT_RESTORE_ACCESS, SC16IS7XX_CHANNEL_SET(channel)                                , 0x00   , 0x00   }
+#define SC16IS7XX_SCRIPT_DELAY_STEP(delayMs)                  { SC16IS7XX_SCRIPT_DELAY         , 0x00                                                          , (delayMs), 0x00 }
+
+//! Register script recording structure
+typedef struct SC16IS7XX_Script
+{
+  SC16IS7XX_ScriptStep* pSteps; //!< Steps array where the script is recorded
+  size_t MaxSteps;              //!< Maximum steps count of the pSteps array
+  size_t StepCount;             //!< Steps count of the script. No need to fill, set at recording start. Can be greater than MaxSteps if the recording overflowed
+} SC16IS7XX_Script;
+#endif
+
+//-----------------------------------------------------------------------------
+
 //! SC16IS7XX device object structure
 struct SC16IS7XX
 {
@@ -954,10 +1191,43 @@ struct SC16IS7XX
 #endif
   };
   uint32_t InterfaceClockSpeed;   //!< SPI/I2C clock speed in Hertz
+#ifdef SC16IS7XX_USE_BUS_QUEUE
+  SC16IS7XX_BusQueue *BusQueue;   //!< Bus queue of the interface shared with other devices. Can be NULL if the device has an exclusive access to the interface
+#endif
+
+  //--- Time call function ---
+  SC16IS7XX_GetCurrentms_Func fnGetCurrentms; //!< This function will be called when the driver need to get current millisecond. Can be NULL if no time related feature is used
+  SC16IS7XX_Sleep_Func fnSleep;               //!< This function will be called by the blocking functions to sleep or yield the expected time before polling the device again. Can be NULL, then the device is polled continuously
+  uint32_t BlockingTimeoutms;                 //!< Timeout in milliseconds of the blocking functions SC16IS7XX_TransmitChar(), SC16IS7XX_ReceiveChar() and SC16IS7XX_WaitEndTx(). Needs the fnGetCurrentms function. Set to 0 to wait forever
 
   //--- GPIO configuration ---
   uint8_t GPIOsOutDir;            //!< GPIOs pins direction (0 = set to output ; 1 = set to input). Used to speed up direction change
   uint8_t GPIOsOutLevel;          //!< GPIOs pins output level (0 = set to '0' ; 1 = set to '1'). Used to speed up output change
+
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+  //--- Shadow registers ---
+  SC16IS7XX_ShadowRegisters Shadow[SC16IS7XX_CHANNEL_COUNT]; //!< Shadow copy of the writable registers of each channel, used to avoid reading back registers before modifying them. No need to fill, invalidated at device reset. GPIO and IOControl registers are stored in the channel A
+#endif
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+  //--- Register bank tracking ---
+  SC16IS7XX_BankState BankState[SC16IS7XX_CHANNEL_COUNT]; //!< Register bank state of each channel, used to avoid reading LCR and redundant register set switches. No need to fill, cleared at initialization and invalidated at device reset
+#endif
+#ifdef SC16IS7XX_USE_REGISTER_SCRIPT
+  //--- Register script ---
+  SC16IS7XX_Script* pRecordScript; //!< Script where register writes are recorded, NULL if no recording in progress. Set it to NULL at initialization
+#endif
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+  //--- Bus statistics ---
+  SC16IS7XX_BusStatistics Statistics; //!< Bus transactions statistics of the device. No need to fill, reset at initialization
+#endif
+#ifdef SC16IS7XX_USE_TRACE
+  //--- Register access trace ---
+  SC16IS7XX_Trace* pTrace; //!< Trace ring where the bus accesses are recorded, NULL if no trace in progress. Set it to NULL at initialization
+#endif
+#ifdef SC16IS7XX_USE_TX_CREDIT
+  //--- Tx FIFO credit ---
+  uint8_t TxFIFOcredit[SC16IS7XX_CHANNEL_COUNT]; //!< Free spaces in the Tx FIFO of each channel known without reading TXLVL. Refreshed at each TXLVL read and decreased at each THR write, the real free space can only be greater. No need to fill, cleared at initialization
+#endif
 };
 
 //! This unique ID is a helper for pointer recognition when using USE_GENERICS_DEFINED for generic call of GPIO or PORT use (using GPIO_Interface.h)
@@ -1069,6 +1339,183 @@ eERRORRESULT SC16IS7XX_SetRegisterAccess(SC16IS7XX *pComp, const eSC16IS7XX_Chan
  */
 eERRORRESULT SC16IS7XX_ReturnAccessToGeneralRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, uint8_t originalLCRregValue);
 
+#ifdef SC16IS7XX_USE_BANK_TRACKING
+/*! @brief Begin a bank session on a channel of the SC16IS7XX
+ *
+ * Inside a bank session, SC16IS7XX_ReturnAccessToGeneralRegister() is deferred: the LCR is written back only before the next access of another register of the channel, or at the end of the outermost session.
+ * A SC16IS7XX_SetRegisterAccess() to the register set still selected then costs no bus transaction. This way, back-to-back enhanced or special register operations switch the register set only once
+ * Sessions can be nested, each call shall be paired with a call to SC16IS7XX_EndBankSession()
+ * @warning The fast path functions (SC16IS7XX_USE_FAST_PATH) do not write back a deferred LCR, do not use them on the channel inside a bank session
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] channel Is the UART channel to use
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_BeginBankSession(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel);
+
+/*! @brief End a bank session on a channel of the SC16IS7XX
+ *
+ * At the end of the outermost session, a deferred return to general registers is written to the device
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] channel Is the UART channel to use
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_EndBankSession(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel);
+
+/*! @brief Invalidate the register bank state of all channels of the SC16IS7XX
+ *
+ * Call this function if the device has been reset by another way than SC16IS7XX_SoftResetDevice() (hardware reset pin, power cycle...) or if the LCR has been modified outside of this driver
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ */
+void SC16IS7XX_InvalidateBankState(SC16IS7XX *pComp);
+#endif
+
+#ifdef SC16IS7XX_USE_SHADOW_REGISTERS
+/*! @brief Invalidate all shadow registers of the SC16IS7XX
+ *
+ * Call this function if the device has been reset by another way than SC16IS7XX_SoftResetDevice() (hardware reset pin, power cycle...) or if registers has been modified outside of this driver
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ */
+void SC16IS7XX_InvalidateShadowRegisters(SC16IS7XX *pComp);
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef SC16IS7XX_USE_REGISTER_SCRIPT
+/*! @brief Start recording register writes of the SC16IS7XX into a script
+ *
+ * While recording, each successful register write (SC16IS7XX_WriteRegister(), and so SC16IS7XX_ModifyRegister() and all configuration functions) is also appended to the script as a SC16IS7XX_SCRIPT_WRITE step with the value actually written.
+ * The registers are still accessed on the device, so a configuration sequence (ex: SC16IS7XX_InitUART()) can be recorded once and replayed with SC16IS7XX_ExecuteScript() after a device reset
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] *pScript Is the pointed structure of the script where the writes will be recorded
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_StartScriptRecording(SC16IS7XX *pComp, SC16IS7XX_Script* pScript);
+
+/*! @brief Stop recording register writes of the SC16IS7XX
+ *
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUFFER_FULL if the script had not enough steps to record all the writes
+ */
+eERRORRESULT SC16IS7XX_StopScriptRecording(SC16IS7XX *pComp);
+
+/*! @brief Execute a register script on the SC16IS7XX
+ *
+ * The steps are executed in order and the execution stops at the first error
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] *pSteps Is the steps array of the script to execute
+ * @param[in] stepCount Is the steps count of the script to execute
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__PARAMETER_ERROR for a SC16IS7XX_SCRIPT_DELAY step without the fnGetCurrentms function of the device
+ */
+eERRORRESULT SC16IS7XX_ExecuteScript(SC16IS7XX *pComp, const SC16IS7XX_ScriptStep* pSteps, size_t stepCount);
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef SC16IS7XX_USE_BUS_STATISTICS
+/*! @brief Get a snapshot of the bus statistics of the SC16IS7XX
+ *
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[out] *pStatistics Is where the bus statistics will be copied
+ * @param[in] resetAfterCopy Indicate if the bus statistics have to be reset after the copy
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_GetBusStatistics(SC16IS7XX *pComp, SC16IS7XX_BusStatistics *pStatistics, bool resetAfterCopy);
+
+/*! @brief Reset the bus statistics of the SC16IS7XX
+ *
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_ResetBusStatistics(SC16IS7XX *pComp);
+
+/*! @brief Get the total bus counters of a channel of the SC16IS7XX
+ *
+ * Sum the read and write counters of all registers of the channel. Compare with the counters of the THR and RHR registers to get the bytes on the wire per UART byte
+ * @param[in] *pStatistics Is the pointed structure of the bus statistics to be used
+ * @param[in] channel Is the channel to sum
+ * @param[out] *pTotal Is where the total counters will be stored
+ */
+void SC16IS7XX_GetBusTotalCounters(const SC16IS7XX_BusStatistics *pStatistics, const eSC16IS7XX_Channel channel, SC16IS7XX_BusCounters *pTotal);
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef SC16IS7XX_USE_TRACE
+/*! @brief Start the trace of the bus accesses of the SC16IS7XX
+ *
+ * Each register access that succeeds is recorded in the trace ring. When the ring is full, the oldest entries are overwritten
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] *pTrace Is the pointed structure of the trace ring where the accesses will be recorded
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_StartTrace(SC16IS7XX *pComp, SC16IS7XX_Trace* pTrace);
+
+/*! @brief Stop the trace of the bus accesses of the SC16IS7XX
+ *
+ * The trace ring keeps its entries and can be read with SC16IS7XX_GetTraceEntries()
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_StopTrace(SC16IS7XX *pComp);
+
+/*! @brief Set the call site tag of the next traced accesses of the SC16IS7XX
+ *
+ * Set a tag before calling a driver function to get the cost of this call site in the host decoder summary
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] callSite Is the call site tag to set (0 for untagged accesses)
+ */
+void SC16IS7XX_SetTraceCallSite(SC16IS7XX *pComp, uint16_t callSite);
+
+/*! @brief Get the entries of a trace ring from the oldest to the newest
+ *
+ * The copied entries can be dumped as is to a host and decoded with Tools/SC16IS7XXtraceDecoder.c
+ * @param[in] *pTrace Is the pointed structure of the trace ring to be used
+ * @param[out] *pEntries Is where the entries will be copied
+ * @param[in] maxCount Is the maximum count of entries of the pEntries array
+ * @param[out] *pCount Is where the count of entries copied will be stored
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_GetTraceEntries(const SC16IS7XX_Trace* pTrace, SC16IS7XX_TraceEntry* pEntries, size_t maxCount, size_t *pCount);
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+#ifdef SC16IS7XX_USE_BUS_QUEUE
+/*! @brief Submit a request to the bus queue of the SC16IS7XX
+ *
+ * The request is added at the end of the requests with the same priority, then the queue is processed if no other bus owner is processing it. If the device has no bus queue, the request is executed immediately
+ * A request still in the queue is not added again (ex: an ISR that submits its static drain request again before the bus owner executed it), it will be executed once
+ * A request is executed after the request the bus owner is executing. A long sequence (ex: configuration) should be split into several requests, or its fnExecute should call SC16IS7XX_YieldBusQueue() between its steps, so that the Rx drain requests of other devices are not delayed by the whole sequence
+ * @warning The request structure shall stay valid until IsDone is set
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] *pRequest Is the pointed structure of the request to submit
+ * @param[in] priority Is the priority of the request
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUSY if the request is pending (already in the queue, or will be executed by the current bus owner), else returns the result of the request (pRequest->Result)
+ */
+eERRORRESULT SC16IS7XX_SubmitBusRequest(SC16IS7XX *pComp, SC16IS7XX_BusRequest *pRequest, eSC16IS7XX_BusPriority priority);
+
+/*! @brief Process the requests of a bus queue
+ *
+ * The caller becomes the bus owner and executes all the queued requests back to back by priority order, until the queue is empty
+ * @param[in] *pQueue Is the pointed structure of the bus queue to process
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUSY if another bus owner is already processing the queue, else returns the result of the last request executed
+ */
+eERRORRESULT SC16IS7XX_ProcessBusQueue(SC16IS7XX_BusQueue *pQueue);
+
+/*! @brief Execute the pending Rx drain requests of a bus queue from the current request
+ *
+ * Call this function from the fnExecute function of a long request (ex: configuration) between its steps, to execute the SC16IS7XX_PRIORITY_RX_DRAIN requests submitted meanwhile.
+ * The bus is free between two steps: the step of the current request shall be complete (ex: no register bank left selected that a drain request would not expect)
+ * @param[in] *pQueue Is the pointed structure of the bus queue of the current request
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__NOT_AVAILABLE if the queue is not being processed by a bus owner. The results of the requests executed are in their Result
+ */
+eERRORRESULT SC16IS7XX_YieldBusQueue(SC16IS7XX_BusQueue *pQueue);
+#endif
+
 //-----------------------------------------------------------------------------
 
 
@@ -1239,6 +1686,8 @@ typedef enum
   SC16IS7XX_DRIVER_SAFE_TX        = 0x01, //!< The UART driver will send data to FIFO one data at a time and will check if everything went well (slower)
   SC16IS7XX_DRIVER_BURST_RX       = 0x00, //!< The UART driver will receive data from FIFO at once, without checking if each char was received correctly
   SC16IS7XX_DRIVER_SAFE_RX        = 0x02, //!< The UART driver will receive data from FIFO one data at a time and will check if everything went well (slower)
+  SC16IS7XX_DRIVER_HYBRID_RX      = 0x04, //!< The UART driver will receive data from FIFO at once while no error is in the FIFO, then one data at a time with error check until the erroneous chars are out of the FIFO. Ignored if SC16IS7XX_DRIVER_SAFE_RX is set
+  SC16IS7XX_DRIVER_IRQ_SERVICE    = 0x08, //!< The Tx and Rx FIFOs are only accessed by SC16IS7XX_ServiceInterrupt() in an interrupt, the other functions only use the Tx and Rx buffers (see SC16IS7XX_Buffer). Needs SC16IS7XX_USE_BUFFERS
   SC16IS7XX_TEST_LOOPBACK_AT_INIT = 0x80, //!< Test the UART loopback at startup. It sends 2 chars by loopback UART (just internally) to test the UART configuration (slow at initialization, especially on slow UARTs)
 } eSC16IS7XX_DriverConfig;
 
@@ -1246,18 +1695,178 @@ typedef eSC16IS7XX_DriverConfig setSC16IS7XX_DriverConfig; //! Set of Driver con
 
 //-----------------------------------------------------------------------------
 
-//! SC16IS7XX UART buffer structure
+#ifdef SC16IS7XX_USE_BUFFERS
+#  ifndef SC16IS7XX_MEMORY_BARRIER
+#    if defined(__GNUC__) || defined(__clang__)
+#      define SC16IS7XX_MEMORY_BARRIER()  __sync_synchronize() //!< Memory barrier between the data accesses and the position updates of the buffers
+#    else
+#      define SC16IS7XX_MEMORY_BARRIER()  do { } while (0)     //!< Only the volatile positions order the accesses, enough on a single core CPU that does not reorder its memory accesses
+#      warning "SC16IS7XX_MEMORY_BARRIER() is not defined for this compiler, only the volatile positions of the buffers order the accesses"
+#    endif
+#  endif
+#endif
+
+/*! SC16IS7XX UART buffer structure
+ * This is a single-producer/single-consumer ring buffer: PosIn is only written by the producer and PosOut only by the consumer, one byte is always left free to tell a full buffer from an empty one.
+ * The producer of the Tx buffer is SC16IS7XX_TransmitData(), SC16IS7XX_TransmitDataV(), SC16IS7XX_Printf(), SC16IS7XX_TxReserve()/SC16IS7XX_TxCommit() and its consumer is the THR burst (SC16IS7XX_TransmitData(), SC16IS7XX_TransmitDataV(), SC16IS7XX_FlushTxBufferToFIFO(), SC16IS7XX_Printf() or SC16IS7XX_ServiceInterrupt()).
+ * The producer of the Rx buffer is the RHR burst (SC16IS7XX_ReceiveData(), SC16IS7XX_RetrieveRxFIFOtoBuffer() or SC16IS7XX_ServiceInterrupt()) and its consumer is SC16IS7XX_ReceiveData(), SC16IS7XX_ReceiveUntil(), SC16IS7XX_RxPeek()/SC16IS7XX_RxConsume().
+ * So without SC16IS7XX_DRIVER_IRQ_SERVICE, SC16IS7XX_TransmitData(), SC16IS7XX_TransmitDataV(), SC16IS7XX_Printf() and SC16IS7XX_ReceiveData() are both producer and consumer of a buffer and shall not be used while SC16IS7XX_ServiceInterrupt() can run.
+ * With SC16IS7XX_DRIVER_IRQ_SERVICE, SC16IS7XX_ServiceInterrupt() is the only one to access the FIFOs: SC16IS7XX_TransmitData(), SC16IS7XX_TransmitDataV(), SC16IS7XX_Printf() and SC16IS7XX_TxReserve()/SC16IS7XX_TxCommit() only produce in the Tx buffer,
+ * SC16IS7XX_ReceiveData(), SC16IS7XX_ReceiveUntil() and SC16IS7XX_RxPeek()/SC16IS7XX_RxConsume() only consume from the Rx buffer, and SC16IS7XX_FlushTxBufferToFIFO() and SC16IS7XX_RetrieveRxFIFOtoBuffer() return ERR__NOT_AVAILABLE.
+ * The application can then use them without masking the interrupt, except for the register access that enables again an interrupt masked by SC16IS7XX_ServiceInterrupt() (THR interrupt when the Tx buffer was empty, Rx interrupts when the Rx buffer was full), which shares the bus with the interrupt
+ * With SC16IS7XX_USE_POW2_BUFFERS, the buffer size shall be a power of two, the positions are free-running counters (the index in the buffer is the position modulo the size) and the buffer can hold BufferSize bytes
+ * @warning The positions shall be written atomically by the CPU (size_t not greater than the CPU word)
+ */
 typedef struct SC16IS7XX_Buffer
 {
   uint8_t* pData;         //!< Pointer to a buffer (Tx or Rx). This buffer will be a ring buffer
-  size_t BufferSize;      //!< Buffer size in bytes
-  volatile size_t PosIn;  //!< Input position in the buffer. Will increment on each byte added to the buffer
-  volatile size_t PosOut; //!< Output position in the buffer. Will increment on each byte sent to the UART FIFO (Tx) or received by application (Rx)
-  volatile bool IsFull;   //!< Is the buffer full?
+  size_t BufferSize;      //!< Buffer size in bytes. The buffer can hold up to BufferSize-1 bytes (BufferSize bytes with SC16IS7XX_USE_POW2_BUFFERS, then it shall be a power of two)
+  volatile size_t PosIn;  //!< Input position in the buffer. Will increment on each byte added to the buffer. Only written by the producer
+  volatile size_t PosOut; //!< Output position in the buffer. Will increment on each byte sent to the UART FIFO (Tx) or received by application (Rx). Only written by the consumer
 } SC16IS7XX_Buffer;
 
 //-----------------------------------------------------------------------------
 
+//! SC16IS7XX UART transmit segment structure, used by SC16IS7XX_TransmitDataV()
+typedef struct SC16IS7XX_TxSegment
+{
+  const uint8_t* pData; //!< Pointer to the data of the segment
+  size_t Size;          //!< Size of the data of the segment in bytes. Can be 0
+} SC16IS7XX_TxSegment;
+
+//-----------------------------------------------------------------------------
+
+/*! @brief Receive error handler
+ *
+ * This function will be called by SC16IS7XX_ReceiveData() in SC16IS7XX_DRIVER_HYBRID_RX mode for each erroneous char received
+ * @param[in] *pUART Is the pointed structure of the UART where the char has been received
+ * @param[in] position Is the position of the erroneous char in the data buffer given to SC16IS7XX_ReceiveData()
+ * @param[in] charError Is the char received error
+ */
+typedef void (*SC16IS7XX_RxError_Func)(SC16IS7XX_UART *pUART, size_t position, setSC16IS7XX_ReceiveError charError);
+
+#ifdef SC16IS7XX_USE_NON_BLOCKING_TRANSFERS
+/*! @brief Non-blocking transfer complete handler
+ *
+ * This function will be called when a non-blocking transfer of the UART is complete
+ * @param[in] *pUART Is the pointed structure of the UART where the transfer is complete
+ * @param[in] transferResult Is the result of the transfer. ERR_OK if the transfer succeed
+ */
+typedef void (*SC16IS7XX_TransferComplete_Func)(SC16IS7XX_UART *pUART, eERRORRESULT transferResult);
+#endif
+
+#ifdef SC16IS7XX_USE_BUFFERS
+#ifndef SC16IS7XX_SERVICE_INTERRUPT_MAX_LOOPS
+#  define SC16IS7XX_SERVICE_INTERRUPT_MAX_LOOPS  ( 8 ) //!< Maximum interrupt sources handled by one call of SC16IS7XX_ServiceInterrupt(). Bounds the time spent in the interrupt service
+#endif
+
+/*! @brief Interrupt event handler
+ *
+ * This function will be called by SC16IS7XX_ServiceInterrupt() for each modem, input pin change, Xoff/special character and CTS/RTS event of the UART
+ * @param[in] *pUART Is the pointed structure of the UART where the event occurs
+ * @param[in] source Is the interrupt source of the event
+ * @param[in] value Is the MSR register value for SC16IS7XX_MODEM_INTERRUPT, the IOState register value for SC16IS7XX_INPUT_PIN_CHANGE_STATE, else 0
+ */
+typedef void (*SC16IS7XX_InterruptEvent_Func)(SC16IS7XX_UART *pUART, eSC16IS7XX_InterruptSource source, uint8_t value);
+
+#ifndef SC16IS7XX_POLLER_MAX_UART
+#  define SC16IS7XX_POLLER_MAX_UART  ( 16 ) //!< Maximum UARTs handled by one poller
+#endif
+
+//! SC16IS7XX UART poller structure, used by SC16IS7XX_PollUARTs() to service several UARTs without IRQ lines
+typedef struct SC16IS7XX_Poller
+{
+  //--- Configuration ---
+  SC16IS7XX_UART **pUARTs;  //!< Array of the UARTs to poll, can be on several devices. Each UART should have a TxBuffer and a RxBuffer, and shall not use SC16IS7XX_DRIVER_IRQ_SERVICE. An UART can be NULL
+  size_t UARTcount;         //!< Count of UARTs in the pUARTs array (up to SC16IS7XX_POLLER_MAX_UART)
+  size_t MaxServicePerPass; //!< Maximum UARTs serviced by one pass, the most urgent first. Set to 0 to service all the UARTs with data to transfer
+  uint32_t MinIntervalus;   //!< Minimum poll interval in microseconds. Set to 0 for no minimum
+  uint32_t MaxIntervalus;   //!< Maximum poll interval in microseconds, reached without traffic. Set to 0 for no maximum, else it shall not be lower than MinIntervalus
+  //--- State ---
+  uint32_t Intervalus;      //!< Time to wait in microseconds before the next pass, set by SC16IS7XX_PollUARTs(). No need to fill
+  size_t NextUART;          //!< First UART scanned by the next pass, rotated for fairness between the UARTs of the same urgency. No need to fill
+} SC16IS7XX_Poller;
+
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+#ifndef SC16IS7XX_TRIGGER_CONTROL_WINDOW
+#  define SC16IS7XX_TRIGGER_CONTROL_WINDOW  ( 16 ) //!< Default count of SC16IS7XX_ServiceInterrupt() calls between two adjustments of the trigger levels
+#endif
+
+/*! SC16IS7XX UART adaptive trigger levels structure
+ * SC16IS7XX_ServiceInterrupt() measures the service latency (chars received after the Rx trigger level, or sent after the Tx trigger level, before the FIFO level is read), the bytes per service and the interrupt rate.
+ * Every window of services, the trigger levels are set as high as possible (fewer interrupts) within the bounds: the Rx level goes up one step per window and goes down at once, it is halved on Rx overrun.
+ * The trigger levels are changed with SC16IS7XX_SetTriggerLevels(), without UART reinitialization.
+ * While pTriggerControl is set, the UART initialization keeps TCR and TLR access enabled (MCR[2]) and each adjustment is a single TLR write. SC16IS7XX_GetControlPinStatus() disables this access around the MSR read, and the SPR register of the UART is not accessible
+ */
+typedef struct SC16IS7XX_TriggerControl
+{
+  //--- Configuration ---
+  uint32_t MaxLatencyus;    //!< Maximum time in microseconds a char can wait in the Rx FIFO before the Rx interrupt, at full line rate. Set to 0 for no latency bound
+  uint8_t RxHeadroomMin;    //!< Minimum free space wanted in the Rx FIFO when the Rx interrupt is serviced, to avoid overruns
+  uint8_t TxHeadroomMin;    //!< Minimum chars wanted in the Tx FIFO when the Tx interrupt is serviced, to avoid the Tx line starving
+  uint16_t WindowServices;  //!< Count of services between two adjustments. Set to 0 to use SC16IS7XX_TRIGGER_CONTROL_WINDOW
+  //--- Current trigger levels ---
+  uint8_t RxTrigger;        //!< Current Rx trigger level in chars (4 to 60). No need to fill, set by the UART initialization and SC16IS7XX_SetTriggerLevels()
+  uint8_t TxTrigger;        //!< Current Tx trigger level in spaces (4 to 60). No need to fill, set by the UART initialization and SC16IS7XX_SetTriggerLevels()
+  //--- Measurements of the last window ---
+  uint32_t InterruptRate;   //!< Services per second. Needs the fnGetCurrentms function of the device, else 0
+  uint16_t BytesPerService; //!< Average count of chars received per service
+  uint32_t Latencyus;       //!< Maximum service latency in microseconds
+  //--- Current window ---
+  uint32_t WindowStartms;   //!< Start time of the window. No need to fill
+  uint16_t ServiceCount;    //!< Count of services. No need to fill
+  uint16_t OverrunCount;    //!< Count of Rx overruns. No need to fill
+  uint32_t RxBytes;         //!< Count of chars received. No need to fill
+  uint8_t RxLatencyMax;     //!< Maximum chars received after the Rx trigger level before the service. No need to fill
+  uint8_t TxLatencyMax;     //!< Maximum chars sent after the Tx trigger level before the service. No need to fill
+  uint16_t TxServiceCount;  //!< Count of Tx FIFO refills. No need to fill
+} SC16IS7XX_TriggerControl;
+#endif
+
+#ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+//-----------------------------------------------------------------------------
+
+//! SC16IS7XX Rx timestamp structure, one per Rx FIFO burst stored in the Rx buffer
+typedef struct SC16IS7XX_RxTimestamp
+{
+  size_t Pos;      //!< Position of the first char of the burst in the Rx data stream (free-running count of chars stored in the Rx buffer)
+  size_t Count;    //!< Count of chars of the burst
+  uint32_t Timems; //!< Time of the burst given by the fnGetCurrentms function of the device
+} SC16IS7XX_RxTimestamp;
+
+/*! @brief SC16IS7XX Rx timestamps ring structure
+ *
+ * This ring follows the Rx buffer: each Rx FIFO burst adds a timestamp and the timestamps are released when all the chars of their burst are consumed.
+ * The producer is the Rx FIFO burst and the consumer is the Rx buffer consumer, like the Rx buffer. The stream positions are free-running counters
+ */
+typedef struct SC16IS7XX_RxTimestamps
+{
+  SC16IS7XX_RxTimestamp* pStamps; //!< Pointer to a timestamps array. This array will be a ring. Can be NULL, then no timestamps are recorded
+  size_t StampCount;              //!< Count of timestamps in the array. The ring can hold up to StampCount-1 timestamps
+  volatile size_t PosIn;          //!< Input position in the ring. Only written by the producer. No need to fill, cleared at UART initialization
+  volatile size_t PosOut;         //!< Output position in the ring. Only written by the consumer. No need to fill, cleared at UART initialization
+  volatile size_t DataIn;         //!< Count of chars stored in the Rx buffer. Only written by the producer. No need to fill, cleared at UART initialization
+  size_t DataOut;                 //!< Count of chars consumed from the Rx buffer. Only written by the consumer. No need to fill, cleared at UART initialization
+  volatile uint32_t Dropped;      //!< Count of bursts not timestamped because the ring was full. No need to fill
+} SC16IS7XX_RxTimestamps;
+#endif
+#endif
+
+//-----------------------------------------------------------------------------
+
+//! SC16IS7XX UART channel status snapshot structure
+typedef struct SC16IS7XX_ChannelSnapshot
+{
+  eSC16IS7XX_InterruptSource InterruptSource; //!< Interrupt source of the UART (from IIR register)
+  setSC16IS7XX_Status Status;                 //!< Status flags of the UART (from LSR register), same as SC16IS7XX_GetUARTstatus()
+  uint8_t LineStatus;                         //!< Raw LSR register value, including the overrun, parity, framing and break error flags
+  uint8_t RxFIFOcount;                        //!< Number of characters stored in receive FIFO (RXLVL register)
+  uint8_t TxFIFOspace;                        //!< Available space in the transmit FIFO (TXLVL register)
+  uint8_t ControlPinsStatus;                  //!< Control pins (CD, RI, DSR, CTS) status and change flags (MSR register), same as SC16IS7XX_GetControlPinStatus()
+} SC16IS7XX_ChannelSnapshot;
+
+//-----------------------------------------------------------------------------
+
 /*! @brief SC16IS7XX UART object structure
  * @warning Each Channel and Device tuple should be unique. Only 1 possible tuple on SC16IS7X0 and 2 possible tuples on SC16IS7X2 devices
  */
@@ -1266,15 +1875,43 @@ struct SC16IS7XX_UART
   //--- UART configuration ---
   eSC16IS7XX_Channel Channel;             //!< UART channel of the SC16IS7XX
   setSC16IS7XX_DriverConfig DriverConfig; //!< UART driver configuration. Configuration can be OR'ed
+  SC16IS7XX_RxError_Func fnRxError;       //!< With SC16IS7XX_DRIVER_HYBRID_RX, this function will be called for each erroneous char received (with SC16IS7XX_ServiceInterrupt(), the position is the index in RxBuffer.pData). Can be NULL, then the receive stops at the erroneous char like with SC16IS7XX_DRIVER_SAFE_RX
 
   //--- Device configuration ---
   void *UserDriverData;                   //!< Optional, can be used to store driver data or NULL
   SC16IS7XX *Device;                      //!< SC16IS7XX device where this UART comes from
+  uint32_t CharTimeus;                    //!< Duration of one char on the UART line in microseconds, used to calculate the waits of the blocking functions. No need to fill, set by SC16IS7XX_SetUARTBaudRate()
 
 #ifdef SC16IS7XX_USE_BUFFERS
   //--- Tx/Rx buffers ---
   SC16IS7XX_Buffer TxBuffer;              //!< Tx ring buffer. Only used with SC16IS7XX_DRIVER_BURST_TX
   SC16IS7XX_Buffer RxBuffer;              //!< Rx ring buffer. Only used with SC16IS7XX_DRIVER_BURST_RX
+  //--- Interrupt service ---
+  SC16IS7XX_InterruptEvent_Func fnInterruptEvent; //!< This function will be called by SC16IS7XX_ServiceInterrupt() on modem, input pin change, Xoff and CTS/RTS events. Can be NULL
+  volatile setSC16IS7XX_ReceiveError RxErrors;    //!< Receive errors seen by SC16IS7XX_ServiceInterrupt(). No need to fill, the application clears it after handling the errors
+  volatile uint8_t RxIERmasked;                   //!< Rx interrupts (IER bits) masked by SC16IS7XX_ServiceInterrupt() while the RxBuffer is full. No need to fill, cleared at UART initialization
+  volatile uint8_t TxIERmasked;                   //!< THR interrupt (IER bit) masked by SC16IS7XX_ServiceInterrupt() while the TxBuffer is empty with SC16IS7XX_DRIVER_IRQ_SERVICE. No need to fill, cleared at UART initialization
+  //--- Delimiter scan ---
+  size_t RxScanned;                       //!< Count of data from the Out position of the Rx buffer already scanned by SC16IS7XX_ReceiveUntil() without finding a delimiter. No need to fill, cleared at UART initialization and at each consume of the Rx buffer
+# ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+  //--- Adaptive trigger levels ---
+  SC16IS7XX_TriggerControl *pTriggerControl; //!< Adaptive trigger levels controller run by SC16IS7XX_ServiceInterrupt(). Can be NULL, then the trigger levels stay at the configured values
+# endif
+# ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+  //--- Rx timestamps ---
+  SC16IS7XX_RxTimestamps RxTimestamps;    //!< Timestamps of the Rx FIFO bursts stored in the Rx buffer. Needs the fnGetCurrentms function of the device
+# endif
+#endif
+#ifdef SC16IS7XX_USE_NON_BLOCKING_TRANSFERS
+  //--- Non-blocking transfers ---
+  SC16IS7XX_TransferComplete_Func fnTransferComplete; //!< This function will be called when a non-blocking transfer is complete. Can be NULL
+  uint8_t TransactionNumber;              //!< Transaction number of the current non-blocking transfer given by the interface. No need to fill
+  bool TransferInProgress;                //!< Indicate that a non-blocking transfer is in progress. Set it to 'false' at initialization
+# ifdef SC16IS7XX_USE_TRACE
+  uint8_t *pTransferData;                 //!< Data of the non-blocking read in progress, recorded in the trace at its completion. NULL if there is no read to record. No need to fill
+  size_t TransferSize;                    //!< Size of the non-blocking read in progress. No need to fill
+  uint8_t TransferAddress;                //!< Register address of the non-blocking read in progress. No need to fill
+# endif
 #endif
 };
 
@@ -1480,6 +2117,17 @@ eERRORRESULT SC16IS7XX_SetUARTBaudRate(SC16IS7XX_UART *pUART, const SC16IS7XX_UA
  */
 eERRORRESULT SC16IS7XX_ResetFIFO(SC16IS7XX_UART *pUART, bool resetTxFIFO, bool resetRxFIFO);
 
+/*! @brief Set the Tx and Rx FIFO trigger levels of the SC16IS7XX UART
+ *
+ * This function changes the TLR register at runtime without UART reinitialization: TLR access is enabled in MCR, TLR is written, then TLR access is disabled.
+ * With the adaptive trigger levels (pTriggerControl set), the TLR access stays enabled and only TLR is written
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] txTrigLvl Is the Tx FIFO trigger level, number of spaces available
+ * @param[in] rxTrigLvl Is the Rx FIFO trigger level, number of characters available
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_SetTriggerLevels(SC16IS7XX_UART *pUART, eSC16IS7XX_IntTxTriggerLevel txTrigLvl, eSC16IS7XX_IntRxTriggerLevel rxTrigLvl);
+
 /*! @brief Reset Tx FIFO of the SC16IS7XX UART
  *
  * @param[in] *pUART Is the pointed structure of the UART to be used
@@ -1559,6 +2207,16 @@ eERRORRESULT SC16IS7XX_GetAvailableSpaceTxFIFO(SC16IS7XX_UART *pUART, uint8_t *a
  */
 eERRORRESULT SC16IS7XX_GetDataCountRxFIFO(SC16IS7XX_UART *pUART, uint8_t *dataCount);
 
+/*! @brief Get a status snapshot of the SC16IS7XX UART
+ *
+ * Read IIR, LSR, RXLVL, TXLVL and MSR registers in one call, back to back on the interface, without going through the API for each register
+ * @warning A call to this function clears the THR interrupt, the LSR error flags and the CD, RI, DSR, CTS change status
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[out] *pSnapshot Is where the snapshot will be stored
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_GetChannelSnapshot(SC16IS7XX_UART *pUART, SC16IS7XX_ChannelSnapshot *pSnapshot);
+
 //-----------------------------------------------------------------------------
 
 
@@ -1576,12 +2234,27 @@ eERRORRESULT SC16IS7XX_TransmitData(SC16IS7XX_UART *pUART, uint8_t *data, size_t
 eERRORRESULT SC16IS7XX_TransmitData_Gen(UART_Interface *pIntDev, uint8_t *data, size_t size, size_t *actuallySent);
 #endif
 
+/*! @brief Try to transmit data of several segments to UART FIFO of the SC16IS7XX UART
+ *
+ * The data of all the segments are sent like one data array: the free space of the Tx FIFO is read once and the data are sent in one THR burst spanning the segments, without copy in an intermediate buffer.
+ * The position (segment index and offset in this segment) is updated with the data actually sent, call again with the same segments to send the remaining data. All data are sent when *segmentIndex is equal to segmentCount
+ * If SC16IS7XX_USE_BUFFERS defined and SC16IS7XX_DRIVER_SAFE_TX not set to DriverConfig and TxBuffer ≠ NULL the data will be sent using the TxBuffer
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] *segments Is the segments array to send to the UART transmitter through the transmit FIFO
+ * @param[in] segmentCount Is the count of segments in the segments array
+ * @param[in,out] *segmentIndex Is the index of the segment where the data to send start (set to 0 for a new transmit). Updated to the segment of the first data not sent
+ * @param[in,out] *segmentOffset Is the offset in the segment where the data to send start (set to 0 for a new transmit). Updated to the offset of the first data not sent
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__OUT_OF_RANGE if the position is not in the segments (*segmentIndex greater than segmentCount, or *segmentOffset greater than the segment size or not 0 when *segmentIndex is equal to segmentCount)
+ */
+eERRORRESULT SC16IS7XX_TransmitDataV(SC16IS7XX_UART *pUART, const SC16IS7XX_TxSegment *segments, size_t segmentCount, size_t *segmentIndex, size_t *segmentOffset);
+
 /*! @brief Transmit a char to UART FIFO of the SC16IS7XX UART
  *
  * If SC16IS7XX_USE_BUFFERS defined and SC16IS7XX_DRIVER_SAFE_TX set to DriverConfig and TxBuffer is not NULL the data will be sent using the TxBuffer
+ * While the Tx FIFO is full, the device fnSleep function is called with one char time before a new try
  * @param[in] *pUART Is the pointed structure of the UART to be used
  * @param[in] data Is the char to send to the UART transmitter through the transmit FIFO
- * @return Returns an #eERRORRESULT value enum
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__TIMEOUT if the device BlockingTimeoutms elapsed
  */
 eERRORRESULT SC16IS7XX_TransmitChar(SC16IS7XX_UART *pUART, const char data);
 
@@ -1592,16 +2265,63 @@ eERRORRESULT SC16IS7XX_TransmitChar(SC16IS7XX_UART *pUART, const char data);
  * Will do nothing if SC16IS7XX_DRIVER_SAFE_TX set to DriverConfig, or TxBuffer is NULL
  * @warning This function does not check the end of data transmit through UART. It just tries to put data into the Tx FIFO of the SC16IS7XX device
  * @param[in] *pUART Is the pointed structure of the UART to be used
- * @return Returns an #eERRORRESULT value enum
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__NOT_AVAILABLE with SC16IS7XX_DRIVER_IRQ_SERVICE
  */
 eERRORRESULT SC16IS7XX_FlushTxBufferToFIFO(SC16IS7XX_UART *pUART);
+
+/*! @brief Reserve space in the Tx Buffer of the SC16IS7XX UART
+ *
+ * This function gives the place in the Tx buffer where the application can directly write the data to send, without intermediate buffer.
+ * The space given is contiguous, it stops at the end of the buffer: when the reserved space is shorter than needed, commit it and reserve again to get the start of the buffer
+ * The data written are sent after a call of SC16IS7XX_TxCommit() by SC16IS7XX_FlushTxBufferToFIFO(), SC16IS7XX_TransmitData() or SC16IS7XX_ServiceInterrupt()
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] maxLen Is the maximum size of the space needed
+ * @param[out] **ptr Is where the pointer to the reserved space will be stored
+ * @param[out] *contiguousLen Is the size of the reserved space (from 1 to maxLen)
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUFFER_FULL if there is no space in the Tx buffer
+ */
+eERRORRESULT SC16IS7XX_TxReserve(SC16IS7XX_UART *pUART, size_t maxLen, uint8_t **ptr, size_t *contiguousLen);
+
+/*! @brief Commit data written in the reserved space of the Tx Buffer of the SC16IS7XX UART
+ *
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] len Is the count of data written in the space given by SC16IS7XX_TxReserve(). Shall not be greater than the contiguousLen returned
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_TxCommit(SC16IS7XX_UART *pUART, size_t len);
+
+/*! @brief Send formatted data to the Tx Buffer of the SC16IS7XX UART
+ *
+ * The chars are formatted directly in the Tx buffer, without intermediate buffer, then the Tx buffer is flushed to the Tx FIFO once at the end.
+ * When the Tx buffer is full, the data are flushed to the Tx FIFO and the function waits for space like SC16IS7XX_TransmitChar() (with the device fnSleep and BlockingTimeoutms)
+ * With SC16IS7XX_DRIVER_IRQ_SERVICE, the Tx FIFO is not accessed: the Tx buffer is sent by SC16IS7XX_ServiceInterrupt() and the function only waits for space in the Tx buffer
+ * Supported conversions are %c, %s, %d, %i, %u, %x, %X, %o, %p and %% with the flags '-', '0', '#', '+', ' ', the width, the precision (also with '*') and the length modifiers 'hh', 'h', 'l', 'll'.
+ * The length modifiers 'j', 'z', 't' and 'L' are not supported, the output stops there and the function returns ERR__PARAMETER_ERROR. It is the same for the conversions not supported (floating point 'f', 'e', 'g', 'a' and their upper case, 'n' and the unknown ones)
+ * Needs the TxBuffer, and SC16IS7XX_DRIVER_SAFE_TX not set to DriverConfig
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] *format Is the format string
+ * @param[in] ... Are the values to format
+ * @return Returns an #eERRORRESULT value enum. On error, the chars formatted before the error are sent
+ */
+eERRORRESULT SC16IS7XX_Printf(SC16IS7XX_UART *pUART, const char *format, ...);
+
+/*! @brief Send formatted data with a va_list to the Tx Buffer of the SC16IS7XX UART
+ *
+ * Same as SC16IS7XX_Printf() with the values in a va_list
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] *format Is the format string
+ * @param[in] args Are the values to format
+ * @return Returns an #eERRORRESULT value enum. On error, the chars formatted before the error are sent
+ */
+eERRORRESULT SC16IS7XX_VPrintf(SC16IS7XX_UART *pUART, const char *format, va_list args);
 #endif
 
 /*! @brief Flush all data in TxBuffer, UART FIFO and TSR empty of the SC16IS7XX UART
  *
  * This function is a blocking function. It does not return until the last bit of the UART transmission is sent
+ * Between each poll, the device fnSleep function is called with the time needed to send the data still in the Tx FIFO
  * @param[in] *pUART Is the pointed structure of the UART to be used
- * @return Returns an #eERRORRESULT value enum
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__TIMEOUT if the device BlockingTimeoutms elapsed
  */
 eERRORRESULT SC16IS7XX_WaitEndTx(SC16IS7XX_UART *pUART);
 
@@ -1611,6 +2331,8 @@ eERRORRESULT SC16IS7XX_WaitEndTx(SC16IS7XX_UART *pUART);
 /*! @brief Receive available data from UART FIFO of the SC16IS7XX UART
  *
  * This function will stop receiving data from FIFO at first char error if the DriverConfig is SC16IS7XX_DRIVER_SAFE_RX
+ * If the DriverConfig is SC16IS7XX_DRIVER_HYBRID_RX, the data are received at once while LSR reports no error in the FIFO, then one at a time with the LSR check of each char.
+ * Each erroneous char is reported to fnRxError, or stops the reception like SC16IS7XX_DRIVER_SAFE_RX if fnRxError is NULL
  * If SC16IS7XX_USE_BUFFERS defined and SC16IS7XX_DRIVER_BURST_RX set to DriverConfig and RxBuffer ≠ NULL the data will be received using the RxBuffer
  * @param[in] *pUART/pIntDev Is the pointed structure of the UART to be used
  * @param[out] *data Is where the data will be stored
@@ -1627,10 +2349,11 @@ eERRORRESULT SC16IS7XX_ReceiveData_Gen(UART_Interface *pIntDev, uint8_t *data, s
 /*! @brief Receive a char from UART FIFO of the SC16IS7XX UART
  *
  * If SC16IS7XX_USE_BUFFERS defined and SC16IS7XX_DRIVER_BURST_RX set to DriverConfig and RxBuffer is not NULL the data will be received using the RxBuffer
+ * While no char is received, the device fnSleep function is called with one char time before a new try
  * @param[in] *pUART Is the pointed structure of the UART to be used
  * @param[out] *data Is where the char will be stored
  * @param[out] *charError Is the char received error. Set to 0 if no errors
- * @return Returns an #eERRORRESULT value enum
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__TIMEOUT if the device BlockingTimeoutms elapsed
  */
 eERRORRESULT SC16IS7XX_ReceiveChar(SC16IS7XX_UART *pUART, char *data, setSC16IS7XX_ReceiveError *charError);
 
@@ -1638,11 +2361,90 @@ eERRORRESULT SC16IS7XX_ReceiveChar(SC16IS7XX_UART *pUART, char *data, setSC16IS7
 /*! @brief Retrieve data from Rx UART FIFO of the SC16IS7XX UART to the Rx Buffer
  *
  * This function should be called regularly to get the data in the Rx FIFO of the SC16IS7XX device and put it into the Rx buffer of the driver
- * Will do nothing if SC16IS7XX_USE_BUFFERS is not defined, or SC16IS7XX_DRIVER_SAFE_RX set to DriverConfig, or RxBuffer is NULL
+ * Will do nothing if SC16IS7XX_USE_BUFFERS is not defined, or SC16IS7XX_DRIVER_SAFE_RX or SC16IS7XX_DRIVER_HYBRID_RX set to DriverConfig, or RxBuffer is NULL
  * @param[in] *pUART Is the pointed structure of the UART to be used
- * @return Returns an #eERRORRESULT value enum
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__NOT_AVAILABLE with SC16IS7XX_DRIVER_IRQ_SERVICE
  */
 eERRORRESULT SC16IS7XX_RetrieveRxFIFOtoBuffer(SC16IS7XX_UART *pUART);
+
+/*! @brief Peek data in the Rx Buffer of the SC16IS7XX UART
+ *
+ * This function gives the data stored in the Rx buffer without copy and without removing them from the buffer. The data can be parsed in place, then removed with SC16IS7XX_RxConsume()
+ * The data are given in two parts: the first part up to the end of the buffer, the second part from the start of the buffer when the data wrap
+ * This function does not get data from the Rx FIFO, use SC16IS7XX_RetrieveRxFIFOtoBuffer() or SC16IS7XX_ServiceInterrupt() to fill the Rx buffer
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[out] **ptr1 Is where the pointer to the first part of data will be stored
+ * @param[out] *len1 Is the size of the first part of data. Set to 0 if there is no data
+ * @param[out] **ptr2 Is where the pointer to the second part of data will be stored
+ * @param[out] *len2 Is the size of the second part of data. Set to 0 if the data do not wrap
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_RxPeek(SC16IS7XX_UART *pUART, uint8_t **ptr1, size_t *len1, uint8_t **ptr2, size_t *len2);
+
+/*! @brief Consume data in the Rx Buffer of the SC16IS7XX UART
+ *
+ * If SC16IS7XX_ServiceInterrupt() masked the Rx interrupts because the Rx buffer was full, they are enabled again here (one register access)
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] count Is the count of data to remove from the Rx buffer. Shall not be greater than the data given by SC16IS7XX_RxPeek()
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_RxConsume(SC16IS7XX_UART *pUART, size_t count);
+
+#ifdef SC16IS7XX_USE_RX_TIMESTAMPS
+/*! @brief Get the timestamp of a data in the Rx Buffer of the SC16IS7XX UART
+ *
+ * The timestamp is the time at which the Rx FIFO burst holding the data was read, call it before consuming the data
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] offset Is the offset of the data from the first data of the Rx buffer (0 for the next data to be received)
+ * @param[out] *timems Is where the timestamp in millisecond will be stored
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__NO_DATA_AVAILABLE if the data was not timestamped
+ */
+eERRORRESULT SC16IS7XX_GetRxTimestamp(SC16IS7XX_UART *pUART, size_t offset, uint32_t *timems);
+#endif
+
+/*! @brief Receive a delimited frame from the Rx Buffer of the SC16IS7XX UART
+ *
+ * This function scans the Rx buffer in place for one of the delimiters and only returns complete frames (delimiter included).
+ * The scan position is kept between calls, the data already scanned are not scanned again while the frame is not complete (any consume of the Rx buffer restarts the scan).
+ * When the frame is longer than max, or than the Rx buffer can hold, the first part of the frame is returned and the function returns ERR__BUFFER_FULL.
+ * This is a fragment: the data returned by the next calls (ERR__BUFFER_FULL again for another fragment, then ERR_OK at the delimiter) are its continuation, not a new frame.
+ * This function does not get data from the Rx FIFO, use SC16IS7XX_RetrieveRxFIFOtoBuffer() or SC16IS7XX_ServiceInterrupt() to fill the Rx buffer
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] *delimiterSet Is the string of the delimiter chars (ex: "\n" or "\r\n"). The '\0' char cannot be a delimiter
+ * @param[out] *buf Is where the frame will be stored
+ * @param[in] max Is the count of data that the buf can hold
+ * @param[out] *len Is the size of the frame received. Set to 0 if no complete frame is available
+ * @return Returns an #eERRORRESULT value enum
+ */
+eERRORRESULT SC16IS7XX_ReceiveUntil(SC16IS7XX_UART *pUART, const char *delimiterSet, uint8_t *buf, size_t max, size_t *len);
+
+/*! @brief Service the interrupts of the SC16IS7XX UART
+ *
+ * Call this function when the IRQ pin of the device is active. It reads IIR until no interrupt is pending (or SC16IS7XX_SERVICE_INTERRUPT_MAX_LOOPS sources are handled) and handles every source:
+ * - Rx line status, Rx time-out and RHR: the LSR errors are OR'ed into RxErrors, then the Rx FIFO is drained into the RxBuffer with one RXLVL read and one or two burst reads.
+ *   With SC16IS7XX_DRIVER_SAFE_RX the chars are received one at a time with the LSR check, the service stops after an erroneous char (it is the last char of the RxBuffer). With SC16IS7XX_DRIVER_HYBRID_RX the chars are received one at a time only while an error is in the Rx FIFO, each erroneous char is reported to fnRxError
+ * - THR: the Tx FIFO is refilled from the TxBuffer with one TXLVL read and one or two burst writes
+ * - Modem, input pin change, Xoff/special character and CTS/RTS: fnInterruptEvent is called
+ * When the RxBuffer is full, the Rx interrupts (IER[0] and IER[2]) are masked, else the pending Rx interrupt would fire again at once. They are enabled again by SC16IS7XX_RxConsume(), SC16IS7XX_ReceiveData() or SC16IS7XX_ReceiveUntil() when space is freed (one register access in the consumer)
+ * With SC16IS7XX_DRIVER_IRQ_SERVICE, when the TxBuffer is empty the THR interrupt (IER[1]) is masked. It is enabled again by the Tx buffer producers when data are added (one register access in the producer), which gives a new THR interrupt
+ * This function uses the RxBuffer and TxBuffer whatever the SC16IS7XX_DRIVER_SAFE_TX configuration
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUFFER_FULL if the RxBuffer is full (the Rx interrupts are masked), or ERR__RECEIVE_ERROR if the service stopped at an erroneous char (the next service continues the drain)
+ */
+eERRORRESULT SC16IS7XX_ServiceInterrupt(SC16IS7XX_UART *pUART);
+
+/*! @brief Poll several SC16IS7XX UARTs and service the most urgent first
+ *
+ * Call this function every pPoller->Intervalus microseconds to service UARTs without IRQ lines, instead of polling each UART in turn. A pass:
+ * - Reads RXLVL of each UART with space in its RxBuffer, and TXLVL of each UART with data in its TxBuffer
+ * - Calculates the time before the Rx FIFO overflows and before the Tx FIFO is empty, with the UART char time
+ * - Services the UARTs with the shortest time first (up to MaxServicePerPass UARTs): Rx FIFO drained to the RxBuffer, Tx FIFO refilled from the TxBuffer, without reading the levels again
+ * - Sets Intervalus to half of the shortest time left, or doubles it without traffic, within MinIntervalus and MaxIntervalus
+ * The Rx data are received as configured by the DriverConfig of each UART: in burst without the char errors check, or with the LSR check of the chars with SC16IS7XX_DRIVER_SAFE_RX and SC16IS7XX_DRIVER_HYBRID_RX (errors in RxErrors, and fnRxError in hybrid). Use SC16IS7XX_ServiceInterrupt() for the modem events
+ * @param[in] *pPoller Is the pointed structure of the poller to be used
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__CONFIGURATION if UARTcount is greater than SC16IS7XX_POLLER_MAX_UART, if MinIntervalus is greater than a non-zero MaxIntervalus, or if an UART uses SC16IS7XX_DRIVER_IRQ_SERVICE (its FIFOs are only accessed by SC16IS7XX_ServiceInterrupt()). Returns ERR__RECEIVE_ERROR if the drain of a SC16IS7XX_DRIVER_SAFE_RX UART, or SC16IS7XX_DRIVER_HYBRID_RX UART without fnRxError, stopped at an erroneous char (the next pass continues the drain)
+ */
+eERRORRESULT SC16IS7XX_PollUARTs(SC16IS7XX_Poller *pPoller);
 #endif
 
 //-----------------------------------------------------------------------------
@@ -1665,6 +2467,237 @@ eERRORRESULT SC16IS7XX_GetControlPinStatus(SC16IS7XX_UART *pUART, uint8_t *contr
  */
 bool SC16IS7XX_IsClearToSend(SC16IS7XX_UART *pUART);
 
+//-----------------------------------------------------------------------------
+
+
+#ifdef SC16IS7XX_USE_NON_BLOCKING_TRANSFERS
+/*! @brief Start a non-blocking burst transmit to the Tx FIFO of the SC16IS7XX UART
+ *
+ * The address byte is sent blocking, then the data are sent with a non-blocking transfer (SPI polling or I2C non-blocking) that the interface can perform with DMA
+ * @warning The data buffer shall stay valid until the end of the transfer, and the data size shall not be greater than the Tx FIFO available space (see SC16IS7XX_GetAvailableSpaceTxFIFO())
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] *data Is the data array to send to the Tx FIFO
+ * @param[in] size Is the count of data to send to the Tx FIFO
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUSY if a transfer of this UART is in progress or if the interface is busy with another transfer
+ */
+eERRORRESULT SC16IS7XX_StartTransmitBurst(SC16IS7XX_UART *pUART, uint8_t *data, size_t size);
+
+/*! @brief Start a non-blocking burst receive from the Rx FIFO of the SC16IS7XX UART
+ *
+ * The address byte is sent blocking, then the data are received with a non-blocking transfer (SPI polling or I2C non-blocking) that the interface can perform with DMA
+ * @warning The data buffer shall stay valid until the end of the transfer, and the data size shall not be greater than the data available in the Rx FIFO (see SC16IS7XX_GetDataCountRxFIFO())
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[out] *data Is where the data will be stored
+ * @param[in] size Is the count of data to get from the Rx FIFO
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUSY if a transfer of this UART is in progress or if the interface is busy with another transfer
+ */
+eERRORRESULT SC16IS7XX_StartReceiveBurst(SC16IS7XX_UART *pUART, uint8_t *data, size_t size);
+
+/*! @brief Start a non-blocking read of a register of the SC16IS7XX UART
+ *
+ * @warning The register value shall stay valid until the end of the transfer. The value read is not stored in the shadow registers
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @param[in] registerAddr Is the register address to be read
+ * @param[out] *registerValue Is where the data will be stored
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUSY if a transfer of this UART is in progress or if the interface is busy with another transfer
+ */
+eERRORRESULT SC16IS7XX_StartReadRegister(SC16IS7XX_UART *pUART, const uint8_t registerAddr, uint8_t *registerValue);
+
+/*! @brief Poll the non-blocking transfer of the SC16IS7XX UART
+ *
+ * When the transfer is complete, the fnTransferComplete function of the UART is called with the transfer result. With SC16IS7XX_USE_TRACE, a successful read is recorded in the trace at this time
+ * @param[in] *pUART Is the pointed structure of the UART to be used
+ * @return Returns an #eERRORRESULT value enum. Returns ERR__BUSY while the transfer is in progress, ERR_OK if the transfer is complete or if there is no transfer in progress
+ */
+eERRORRESULT SC16IS7XX_PollTransfer(SC16IS7XX_UART *pUART);
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+
+
+
+//********************************************************************************************************************
+// SC16IS7XX Fast path API
+//********************************************************************************************************************
+#if defined(SC16IS7XX_USE_FAST_PATH) && (defined(SC16IS7XX_ONLY_SPI) == defined(SC16IS7XX_ONLY_I2C))
+#  error SC16IS7XX_USE_FAST_PATH needs exactly one of SC16IS7XX_ONLY_SPI or SC16IS7XX_ONLY_I2C to be defined
+#endif
+#if defined(SC16IS7XX_USE_FAST_PATH) && (defined(SC16IS7XX_ONLY_SPI) != defined(SC16IS7XX_ONLY_I2C))
+// The fast path functions are bound at compile time to the only interface available (SC16IS7XX_ONLY_SPI or SC16IS7XX_ONLY_I2C).
+// They do not check parameters nor interface, and do not update the shadow registers, the bus statistics or the script recording.
+// With SC16IS7XX_USE_TX_CREDIT, the THR writes consume the Tx FIFO credit like the regular functions, else the next regular transmit would overfill the Tx FIFO.
+// Use them only on a device already initialized by Init_SC16IS7XX() where the byte rate matters (ex: Tx/Rx FIFO transfers in interrupt)
+
+#  ifdef USE_DYNAMIC_INTERFACE
+#    define SC16IS7XX_FAST_I2C_INTERFACE  pComp->I2C
+#    define SC16IS7XX_FAST_SPI_INTERFACE  pComp->SPI
+#  else
+#    define SC16IS7XX_FAST_I2C_INTERFACE  &pComp->I2C
+#    define SC16IS7XX_FAST_SPI_INTERFACE  &pComp->SPI
+#  endif
+#  ifdef SC16IS7XX_USE_TX_CREDIT
+#    define SC16IS7XX_FAST_CONSUME_TX_CREDIT(channel,address,size)  do { if (((address) == RegSC16IS7XX_THR) && ((channel) < SC16IS7XX_CHANNEL_COUNT)) { uint8_t* pCredit_ = &pComp->TxFIFOcredit[channel]; *pCredit_ = ((size) >= (size_t)*pCredit_ ? 0 : (uint8_t)(*pCredit_ - (size))); } } while (0) // Each byte written to THR consumes one credit, even if the transfer fails
+#  else
+#    define SC16IS7XX_FAST_CONSUME_TX_CREDIT(channel,address,size)  do { } while (0)
+#  endif
+#  ifdef SC16IS7XX_ONLY_I2C
+#    define SC16IS7XX_FAST_END_FAILED_TRANSFER()  do { I2CInterface_Packet StopPacketDesc_ = I2C_INTERFACE8_TX_DATA_DESC(pComp->I2Caddress, false, NULL, 0, true, I2C_SIMPLE_TRANSFER); (void)pI2C->fnI2C_Transfer(pI2C, &StopPacketDesc_); } while (0) // Send only a stop to free the bus
+#  else
+#    define SC16IS7XX_FAST_END_FAILED_TRANSFER()  do { SPIInterface_Packet EndPacketDesc_ = SPI_INTERFACE_TX_DATA_DESC(NULL, 0, true); (void)pSPI->fnSPI_Transfer(pSPI, &EndPacketDesc_); } while (0) // Transfer no data and release the chip select
+#  endif
+
+/*! @brief Fast read data from the SC16IS7XX
+ *
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] channel Is the UART channel where to read data
+ * @param[in] address Is the register address to be read
+ * @param[out] *data Is where the data will be stored
+ * @param[in] size Is the size of the data array to read
+ * @return Returns an #eERRORRESULT value enum
+ */
+static inline eERRORRESULT SC16IS7XX_FastReadData(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, uint8_t *data, size_t size)
+{
+  eERRORRESULT Error;
+  uint8_t Address = SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(address);
+#  ifdef SC16IS7XX_ONLY_I2C
+  I2C_Interface* pI2C = SC16IS7XX_FAST_I2C_INTERFACE;
+  const uint8_t ChipAddrW = (pComp->I2Caddress & I2C_WRITE_ANDMASK);
+  I2CInterface_Packet AddrPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, true, &Address, sizeof(uint8_t), false, I2C_WRITE_THEN_READ_FIRST_PART);
+  Error = pI2C->fnI2C_Transfer(pI2C, &AddrPacketDesc); // Transfer the address
+  if (Error == ERR__I2C_NACK) return ERR__NOT_READY;   // If the device receive a NAK, then the device is not ready
+  if (Error != ERR_OK) return Error;                   // If there is an error while calling fnI2C_Transfer() then return the Error
+  I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_RX_DATA_DESC((ChipAddrW | I2C_READ_ORMASK), true, data, size, true, I2C_WRITE_THEN_READ_SECOND_PART);
+  Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc); // Restart at first data read transfer, get the data and stop transfer at last byte
+  if (Error != ERR_OK) SC16IS7XX_FAST_END_FAILED_TRANSFER(); // The stop may not have been sent, free the bus
+  return Error;
+#  else
+  SPI_Interface* pSPI = SC16IS7XX_FAST_SPI_INTERFACE;
+  Address |= SC16IS7XX_SPI_READ;
+  SPIInterface_Packet AddrPacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Address, sizeof(uint8_t), false);      // Prepare SPI packet description to use
+  Error = pSPI->fnSPI_Transfer(pSPI, &AddrPacketDesc);                                                    // Transfer the address
+  if (Error != ERR_OK) return Error;                                                                      // If there is an error while calling fnSPI_Transfer() then return the Error
+  SPIInterface_Packet DataPacketDesc = SPI_INTERFACE_RX_DATA_WITH_DUMMYBYTE_DESC(0x00, data, size, true); // Prepare SPI packet description to use
+  Error = pSPI->fnSPI_Transfer(pSPI, &DataPacketDesc);                                                    // Get the data and stop transfer at last byte
+  if (Error != ERR_OK) SC16IS7XX_FAST_END_FAILED_TRANSFER();                                              // The chip select may still be asserted, release it
+  return Error;
+#  endif
+}
+
+/*! @brief Fast write data to the SC16IS7XX
+ *
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] channel Is the UART channel where to write data
+ * @param[in] address Is the register address where data will be written
+ * @param[in] *data Is the data array to write
+ * @param[in] size Is the size of the data array to write
+ * @return Returns an #eERRORRESULT value enum
+ */
+static inline eERRORRESULT SC16IS7XX_FastWriteData(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t address, uint8_t *data, size_t size)
+{
+  eERRORRESULT Error;
+  uint8_t Address = SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(address) | SC16IS7XX_SPI_WRITE;
+  SC16IS7XX_FAST_CONSUME_TX_CREDIT(channel, address, size);
+#  ifdef SC16IS7XX_ONLY_I2C
+  I2C_Interface* pI2C = SC16IS7XX_FAST_I2C_INTERFACE;
+  const uint8_t ChipAddrW = (pComp->I2Caddress & I2C_WRITE_ANDMASK);
+  I2CInterface_Packet AddrPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, true, &Address, sizeof(uint8_t), false, I2C_WRITE_THEN_WRITE_FIRST_PART);
+  Error = pI2C->fnI2C_Transfer(pI2C, &AddrPacketDesc);              // Transfer the address
+  if (Error == ERR__I2C_NACK) return ERR__NOT_READY;                // If the device receive a NAK, then the device is not ready
+  if (Error == ERR__I2C_NACK_DATA) return ERR__I2C_INVALID_ADDRESS; // If the device receive a NAK while transferring data, then this is an invalid address
+  if (Error != ERR_OK) return Error;                                // If there is an error while calling fnI2C_Transfer() then return the Error
+  I2CInterface_Packet DataPacketDesc = I2C_INTERFACE8_TX_DATA_DESC(ChipAddrW, false, data, size, true, I2C_WRITE_THEN_WRITE_SECOND_PART);
+  Error = pI2C->fnI2C_Transfer(pI2C, &DataPacketDesc);              // Continue by transferring the data, and stop transfer at last byte
+  if (Error != ERR_OK) SC16IS7XX_FAST_END_FAILED_TRANSFER();        // The stop may not have been sent, free the bus
+  return Error;
+#  else
+  SPI_Interface* pSPI = SC16IS7XX_FAST_SPI_INTERFACE;
+  SPIInterface_Packet AddrPacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Address, sizeof(uint8_t), false); // Prepare SPI packet description to use
+  Error = pSPI->fnSPI_Transfer(pSPI, &AddrPacketDesc);                                               // Transfer the address
+  if (Error != ERR_OK) return Error;                                                                 // If there is an error while calling fnSPI_Transfer() then return the Error
+  SPIInterface_Packet DataPacketDesc = SPI_INTERFACE_TX_DATA_DESC(data, size, true);                 // Prepare SPI packet description to use
+  Error = pSPI->fnSPI_Transfer(pSPI, &DataPacketDesc);                                               // Send the data and stop transfer at last byte
+  if (Error != ERR_OK) SC16IS7XX_FAST_END_FAILED_TRANSFER();                                         // The chip select may still be asserted, release it
+  return Error;
+#  endif
+}
+
+/*! @brief Fast read a register of the SC16IS7XX
+ *
+ * With SPI, the address and the data are transferred in one packet
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] channel Is the UART channel where to read data
+ * @param[in] registerAddr Is the register address to be read
+ * @param[out] *registerValue Is where the data will be stored
+ * @return Returns an #eERRORRESULT value enum
+ */
+static inline eERRORRESULT SC16IS7XX_FastReadRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t *registerValue)
+{
+#  ifdef SC16IS7XX_ONLY_I2C
+  return SC16IS7XX_FastReadData(pComp, channel, registerAddr, registerValue, sizeof(uint8_t));
+#  else
+  SPI_Interface* pSPI = SC16IS7XX_FAST_SPI_INTERFACE;
+  uint8_t Buffer[2] = { (uint8_t)(SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(registerAddr) | SC16IS7XX_SPI_READ), 0x00 };
+  SPIInterface_Packet PacketDesc = SPI_INTERFACE_RX_DATA_DESC(&Buffer[0], sizeof(Buffer), true); // Prepare SPI packet description to use
+  eERRORRESULT Error = pSPI->fnSPI_Transfer(pSPI, &PacketDesc);                                 // Transfer the address, get the data and stop transfer at last byte
+  *registerValue = Buffer[1];
+  return Error;
+#  endif
+}
+
+/*! @brief Fast write a register of the SC16IS7XX
+ *
+ * With SPI, the address and the data are transferred in one packet
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] channel Is the UART channel where to write data
+ * @param[in] registerAddr Is the register address where data will be written
+ * @param[in] registerValue Is the data to write
+ * @return Returns an #eERRORRESULT value enum
+ */
+static inline eERRORRESULT SC16IS7XX_FastWriteRegister(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, const uint8_t registerAddr, uint8_t registerValue)
+{
+#  ifdef SC16IS7XX_ONLY_I2C
+  return SC16IS7XX_FastWriteData(pComp, channel, registerAddr, &registerValue, sizeof(uint8_t));
+#  else
+  SPI_Interface* pSPI = SC16IS7XX_FAST_SPI_INTERFACE;
+  SC16IS7XX_FAST_CONSUME_TX_CREDIT(channel, registerAddr, sizeof(uint8_t));
+  uint8_t Buffer[2] = { (uint8_t)(SC16IS7XX_CHANNEL_SET(channel) | SC16IS7XX_ADDRESS_SET(registerAddr) | SC16IS7XX_SPI_WRITE), registerValue };
+  SPIInterface_Packet PacketDesc = SPI_INTERFACE_TX_DATA_DESC(&Buffer[0], sizeof(Buffer), true); // Prepare SPI packet description to use
+  return pSPI->fnSPI_Transfer(pSPI, &PacketDesc);                                               // Transfer the address, send the data and stop transfer at last byte
+#  endif
+}
+
+/*! @brief Fast burst write to the Tx FIFO (THR register) of the SC16IS7XX
+ *
+ * @warning The data size shall not be greater than the Tx FIFO available space (see SC16IS7XX_GetAvailableSpaceTxFIFO())
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] channel Is the UART channel to be used
+ * @param[in] *data Is the data array to send to the Tx FIFO
+ * @param[in] size Is the count of data to send to the Tx FIFO
+ * @return Returns an #eERRORRESULT value enum
+ */
+static inline eERRORRESULT SC16IS7XX_FastWriteTHR(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, uint8_t *data, size_t size)
+{
+  return SC16IS7XX_FastWriteData(pComp, channel, RegSC16IS7XX_THR, data, size);
+}
+
+/*! @brief Fast burst read from the Rx FIFO (RHR register) of the SC16IS7XX
+ *
+ * @warning The data size shall not be greater than the data available in the Rx FIFO (see SC16IS7XX_GetDataCountRxFIFO())
+ * @param[in] *pComp Is the pointed structure of the device to be used
+ * @param[in] channel Is the UART channel to be used
+ * @param[out] *data Is where the data will be stored
+ * @param[in] size Is the count of data to get from the Rx FIFO
+ * @return Returns an #eERRORRESULT value enum
+ */
+static inline eERRORRESULT SC16IS7XX_FastReadRHR(SC16IS7XX *pComp, const eSC16IS7XX_Channel channel, uint8_t *data, size_t size)
+{
+  return SC16IS7XX_FastReadData(pComp, channel, RegSC16IS7XX_RHR, data, size);
+}
+
+#endif
+
 //-----------------------------------------------------------------------------
 #ifdef __cplusplus
 }
@@ -0,0 +1,387 @@
+/*!*****************************************************************************
+ * @file    FakeSC16IS7XX.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host fake of a SC16IS752 on SPI, used by the host unit tests
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+//! Fake channel state
+typedef struct
+{
+  uint8_t Reg[FAKE_BANK_COUNT][16]; //!< Registers of each bank
+  uint8_t FCR;                      //!< Last FCR value written (write only register)
+  uint8_t Rx[FAKE_FIFO_SIZE];       //!< Rx FIFO
+  uint8_t RxError[FAKE_FIFO_SIZE];  //!< Line errors (LSR[4:1]) of each char of the Rx FIFO
+  size_t RxCount;                   //!< Count of chars in the Rx FIFO
+  bool Overrun;                     //!< Overrun error flag, cleared at LSR read
+  uint8_t Tx[FAKE_FIFO_SIZE];       //!< Tx FIFO
+  size_t TxCount;                   //!< Count of chars in the Tx FIFO
+  bool ThrPending;                  //!< THR interrupt pending, cleared at IIR read or THR write
+} Fake_Channel;
+
+Fake_State Fake;
+static Fake_Channel FakeChannel[2];
+static uint8_t FakeCommand;     // Address byte of the current transfer
+static bool FakeHasCommand;     // The address byte of the current transfer has been received
+static size_t FakeAccessIndex;  // Index in the log of the current transfer
+
+unsigned TestFailures = 0;
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Get the register bank accessed at an address of a channel
+//=============================================================================
+static eFake_Bank Fake_GetBank(const Fake_Channel *pChannel, uint8_t address)
+{
+  const uint8_t LCR = pChannel->Reg[FAKE_BANK_GENERAL][RegSC16IS7XX_LCR];
+  if (address == RegSC16IS7XX_LCR) return FAKE_BANK_GENERAL;
+  if ((LCR & 0x80) > 0)
+  {
+    if (address <= RegSC16IS7XX_DLH) return FAKE_BANK_SPECIAL;
+    if (LCR == 0xBF) return FAKE_BANK_ENHANCED;
+    return FAKE_BANK_GENERAL;
+  }
+  const bool TcrTlrEnabled = ((pChannel->Reg[FAKE_BANK_GENERAL][RegSC16IS7XX_MCR] & 0x04) > 0) && ((pChannel->Reg[FAKE_BANK_ENHANCED][RegSC16IS7XX_EFR] & 0x10) > 0);
+  if (TcrTlrEnabled && ((address == RegSC16IS7XX_TCR) || (address == RegSC16IS7XX_TLR))) return FAKE_BANK_TCR_TLR;
+  return FAKE_BANK_GENERAL;
+}
+
+
+//=============================================================================
+// Get the Rx and Tx trigger levels of a channel
+//=============================================================================
+static size_t Fake_RxTrigger(const Fake_Channel *pChannel)
+{
+  static const size_t FCR_LEVELS[4] = { 8, 16, 56, 60 };
+  const uint8_t TLR = (pChannel->Reg[FAKE_BANK_TCR_TLR][RegSC16IS7XX_TLR] >> 4) & 0xF;
+  return (TLR != 0 ? TLR * 4u : FCR_LEVELS[(pChannel->FCR >> 6) & 0x3]);
+}
+
+static size_t Fake_TxTrigger(const Fake_Channel *pChannel)
+{
+  static const size_t FCR_LEVELS[4] = { 8, 16, 32, 56 };
+  const uint8_t TLR = pChannel->Reg[FAKE_BANK_TCR_TLR][RegSC16IS7XX_TLR] & 0xF;
+  return (TLR != 0 ? TLR * 4u : FCR_LEVELS[(pChannel->FCR >> 4) & 0x3]);
+}
+
+
+//=============================================================================
+// Get the LSR and IIR values of a channel
+//=============================================================================
+static uint8_t Fake_LSR(const Fake_Channel *pChannel)
+{
+  uint8_t LSR = 0;
+  if (pChannel->RxCount > 0) LSR |= 0x01 | (pChannel->RxError[0] & 0x1C);
+  if (pChannel->Overrun) LSR |= 0x02;
+  for (size_t z = 0; z < pChannel->RxCount; ++z) if (pChannel->RxError[z] != 0) LSR |= 0x80;
+  if (pChannel->TxCount == 0) LSR |= 0x60;
+  return LSR;
+}
+
+static uint8_t Fake_IIR(Fake_Channel *pChannel)
+{
+  const uint8_t IER = pChannel->Reg[FAKE_BANK_GENERAL][RegSC16IS7XX_IER];
+  const uint8_t FIFOenabled = ((pChannel->FCR & 0x01) > 0 ? 0xC0 : 0x00);
+  if (((IER & 0x04) > 0) && ((Fake_LSR(pChannel) & 0x1E) > 0)) return FIFOenabled | 0x06;
+  if (((IER & 0x01) > 0) && (pChannel->RxCount > 0)) return FIFOenabled | (pChannel->RxCount >= Fake_RxTrigger(pChannel) ? 0x04 : 0x0C);
+  if (((IER & 0x02) > 0) && pChannel->ThrPending)
+  {
+    pChannel->ThrPending = false;                                        // The IIR read clears the THR interrupt
+    return FIFOenabled | 0x02;
+  }
+  return FIFOenabled | 0x01;
+}
+
+
+//=============================================================================
+// Reset the registers of the fake device
+//=============================================================================
+static void Fake_ResetRegisters(void)
+{
+  memset(&FakeChannel[0], 0, sizeof(FakeChannel));
+  for (size_t z = 0; z < 2; ++z)
+  {
+    FakeChannel[z].Reg[FAKE_BANK_GENERAL][RegSC16IS7XX_LCR] = 0x1D;
+    FakeChannel[z].Reg[FAKE_BANK_GENERAL][RegSC16IS7XX_IODir] = 0x00;
+  }
+}
+
+
+//=============================================================================
+// Read a register of a channel
+//=============================================================================
+static uint8_t Fake_Read(uint8_t channel, uint8_t address, eFake_Bank bank)
+{
+  Fake_Channel* pChannel = &FakeChannel[channel];
+  if ((address >= RegSC16IS7XX_IODir) && (address <= RegSC16IS7XX_IOControl)) pChannel = &FakeChannel[0]; // GPIO registers are common to both channels
+  if (bank != FAKE_BANK_GENERAL) return pChannel->Reg[bank][address];
+  switch (address)
+  {
+    case RegSC16IS7XX_RHR:
+    {
+      if (pChannel->RxCount == 0) return 0x00;
+      const uint8_t Data = pChannel->Rx[0];
+      memmove(&pChannel->Rx[0], &pChannel->Rx[1], pChannel->RxCount - 1);
+      memmove(&pChannel->RxError[0], &pChannel->RxError[1], pChannel->RxCount - 1);
+      pChannel->RxCount--;
+      return Data;
+    }
+    case RegSC16IS7XX_IIR: return Fake_IIR(pChannel);
+    case RegSC16IS7XX_LSR:
+    {
+      const uint8_t LSR = Fake_LSR(pChannel);
+      pChannel->Overrun = false;                                         // The LSR read clears the overrun error
+      return LSR;
+    }
+    case RegSC16IS7XX_MSR:   return 0x00;
+    case RegSC16IS7XX_TXLVL: return (uint8_t)(FAKE_FIFO_SIZE - pChannel->TxCount);
+    case RegSC16IS7XX_RXLVL: return (uint8_t)pChannel->RxCount;
+    default: break;
+  }
+  return pChannel->Reg[bank][address];
+}
+
+
+//=============================================================================
+// Write a register of a channel
+//=============================================================================
+static void Fake_Write(uint8_t channel, uint8_t address, eFake_Bank bank, uint8_t value)
+{
+  Fake_Channel* pChannel = &FakeChannel[channel];
+  if ((address >= RegSC16IS7XX_IODir) && (address <= RegSC16IS7XX_IOControl)) pChannel = &FakeChannel[0]; // GPIO registers are common to both channels
+  const bool Enhanced = ((pChannel->Reg[FAKE_BANK_ENHANCED][RegSC16IS7XX_EFR] & 0x10) > 0);
+  if (bank != FAKE_BANK_GENERAL)
+  {
+    pChannel->Reg[bank][address] = value;
+    return;
+  }
+  switch (address)
+  {
+    case RegSC16IS7XX_THR:
+      pChannel->ThrPending = false;                                      // The THR write clears the THR interrupt
+      if ((pChannel->Reg[FAKE_BANK_GENERAL][RegSC16IS7XX_MCR] & 0x10) > 0)     // Loopback, the char goes to the Rx FIFO
+        Fake_PushRx(channel, &value, 1);
+      else if (pChannel->TxCount < FAKE_FIFO_SIZE) pChannel->Tx[pChannel->TxCount++] = value;
+      return;
+    case RegSC16IS7XX_IER:
+      if (Enhanced == false) value = (uint8_t)((value & 0x0F) | (pChannel->Reg[bank][address] & 0xF0)); // IER[7:4] can only be modified when enhanced functions are enabled
+      if ((value & 0x02) > (pChannel->Reg[bank][address] & 0x02)) pChannel->ThrPending = ((FAKE_FIFO_SIZE - pChannel->TxCount) >= Fake_TxTrigger(pChannel));
+      break;
+    case RegSC16IS7XX_FCR:
+      if (Enhanced == false) value = (uint8_t)((value & 0xCF) | (pChannel->FCR & 0x30)); // FCR[5:4] can only be modified when enhanced functions are enabled
+      if ((value & 0x02) > 0) { pChannel->RxCount = 0; pChannel->Overrun = false; }
+      if ((value & 0x04) > 0) pChannel->TxCount = 0;
+      pChannel->FCR = value & ~0x06;
+      return;
+    case RegSC16IS7XX_MCR:
+      if (Enhanced == false) value = (uint8_t)((value & 0x1B) | (pChannel->Reg[bank][address] & 0xE4)); // MCR[7:5] and MCR[2] can only be modified when enhanced functions are enabled
+      break;
+    case RegSC16IS7XX_IOControl:
+      if ((value & 0x08) > 0)                                            // Software reset
+      {
+        Fake_ResetRegisters();
+        return;
+      }
+      break;
+    case RegSC16IS7XX_LSR:
+    case RegSC16IS7XX_TXLVL:
+    case RegSC16IS7XX_RXLVL:
+      return;                                                            // Read only registers
+    default: break;
+  }
+  pChannel->Reg[bank][address] = value;
+}
+
+
+//=============================================================================
+// SPI transfer of the fake device
+//=============================================================================
+static eERRORRESULT Fake_SPIinit(SPI_Interface *pIntDev, uint8_t chipSelect, eSPIInterface_Mode mode, const uint32_t sckFreq)
+{
+  (void)pIntDev; (void)chipSelect; (void)mode; (void)sckFreq;
+  return ERR_OK;
+}
+
+static eERRORRESULT Fake_SPItransfer(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketDesc)
+{
+  (void)pIntDev;
+  if ((Fake.FailTransfer > 0) && (--Fake.FailTransfer == 0)) return ERR__SPI_COMM_ERROR; // Simulate a transfer failure, nothing is transferred
+  Fake.IsSelected = true;
+  for (size_t z = 0; z < pPacketDesc->DataSize; ++z)
+  {
+    const uint8_t Out = (pPacketDesc->TxData != NULL ? pPacketDesc->TxData[z] : pPacketDesc->DummyByte);
+    uint8_t In = 0x00;
+    if (FakeHasCommand == false)                                         // First byte of the transfer, the address byte
+    {
+      FakeCommand    = Out;
+      FakeHasCommand = true;
+      Fake.Transactions++;
+      FakeAccessIndex = Fake.AccessCount++;
+      if (FakeAccessIndex < FAKE_LOG_SIZE)
+      {
+        Fake_Access* pAccess = &Fake.Log[FakeAccessIndex];
+        pAccess->Channel = (Out >> 1) & 0x3;
+        pAccess->Address = (Out >> 3) & 0xF;
+        pAccess->Bank    = (uint8_t)Fake_GetBank(&FakeChannel[pAccess->Channel & 0x1], pAccess->Address);
+        pAccess->IsRead  = ((Out & 0x80) > 0);
+        pAccess->Count   = 0;
+        pAccess->Value   = 0;
+      }
+    }
+    else
+    {
+      const uint8_t Channel = (FakeCommand >> 1) & 0x1;
+      const uint8_t Address = (FakeCommand >> 3) & 0xF;
+      const eFake_Bank Bank = Fake_GetBank(&FakeChannel[Channel], Address);
+      const bool IsRead = ((FakeCommand & 0x80) > 0);
+      if (IsRead) In = Fake_Read(Channel, Address, Bank);
+      else Fake_Write(Channel, Address, Bank, Out);
+      if (FakeAccessIndex < FAKE_LOG_SIZE)
+      {
+        Fake_Access* pAccess = &Fake.Log[FakeAccessIndex];
+        if (pAccess->Count == 0) pAccess->Value = (IsRead ? In : Out);
+        if (pAccess->Count < UINT8_MAX) pAccess->Count++;
+      }
+      if (Fake.Verbose) printf("  %s ch%u @%X bank%u: %02X\n", (IsRead ? "R" : "W"), Channel, Address, (unsigned)Bank, (IsRead ? In : Out));
+    }
+    if (pPacketDesc->RxData != NULL) pPacketDesc->RxData[z] = In;
+  }
+  if (pPacketDesc->Terminate)                                            // Chip select released, the next byte is an address byte
+  {
+    FakeHasCommand  = false;
+    Fake.IsSelected = false;
+  }
+  return ERR_OK;
+}
+
+SPI_Interface FakeSPI = { NULL, Fake_SPIinit, Fake_SPItransfer, 0 };
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Fake device controls
+//=============================================================================
+void Fake_Reset(void)
+{
+  Fake_ResetRegisters();
+  FakeHasCommand    = false;
+  Fake.IsSelected   = false;
+  Fake.Transactions = 0;
+  Fake.FailTransfer = 0;
+  Fake_ClearLog();
+}
+
+void Fake_ClearLog(void)
+{
+  Fake.AccessCount = 0;
+}
+
+uint32_t Fake_GetCurrentms(void)
+{
+  return Fake.Currentms;
+}
+
+void Fake_PushRx(uint8_t channel, const uint8_t *data, size_t size)
+{
+  Fake_Channel* pChannel = &FakeChannel[channel & 0x1];
+  for (size_t z = 0; z < size; ++z)
+  {
+    if (pChannel->RxCount >= FAKE_FIFO_SIZE) { pChannel->Overrun = true; continue; } // The char is lost
+    pChannel->RxError[pChannel->RxCount] = 0;
+    pChannel->Rx[pChannel->RxCount++] = data[z];
+  }
+}
+
+void Fake_SetRxError(uint8_t channel, uint8_t lsrBits)
+{
+  Fake_Channel* pChannel = &FakeChannel[channel & 0x1];
+  if (pChannel->RxCount > 0) pChannel->RxError[pChannel->RxCount - 1] |= (uint8_t)(lsrBits & 0x1C);
+  if ((lsrBits & 0x02) > 0) pChannel->Overrun = true;
+}
+
+size_t Fake_DrainTx(uint8_t channel, uint8_t *data, size_t max)
+{
+  Fake_Channel* pChannel = &FakeChannel[channel & 0x1];
+  const size_t Count = (pChannel->TxCount < max ? pChannel->TxCount : max);
+  const bool WasAboveTrigger = ((FAKE_FIFO_SIZE - pChannel->TxCount) >= Fake_TxTrigger(pChannel));
+  if (data != NULL) memcpy(data, &pChannel->Tx[0], Count);
+  memmove(&pChannel->Tx[0], &pChannel->Tx[Count], pChannel->TxCount - Count);
+  pChannel->TxCount -= Count;
+  if ((WasAboveTrigger == false) && ((FAKE_FIFO_SIZE - pChannel->TxCount) >= Fake_TxTrigger(pChannel))) pChannel->ThrPending = true; // The Tx FIFO crossed the trigger level
+  return Count;
+}
+
+uint8_t Fake_GetRegister(uint8_t channel, eFake_Bank bank, uint8_t address)
+{
+  if (address == RegSC16IS7XX_FCR && bank == FAKE_BANK_GENERAL) return FakeChannel[channel & 0x1].FCR;
+  if ((address >= RegSC16IS7XX_IODir) && (address <= RegSC16IS7XX_IOControl)) channel = 0;
+  return FakeChannel[channel & 0x1].Reg[bank][address & 0xF];
+}
+
+void Fake_SetRegister(uint8_t channel, eFake_Bank bank, uint8_t address, uint8_t value)
+{
+  if ((address >= RegSC16IS7XX_IODir) && (address <= RegSC16IS7XX_IOControl)) channel = 0;
+  FakeChannel[channel & 0x1].Reg[bank][address & 0xF] = value;
+}
+
+size_t Fake_CountAccesses(uint8_t channel, uint8_t address, uint8_t bank, bool isRead)
+{
+  size_t Count = 0;
+  const size_t End = (Fake.AccessCount < FAKE_LOG_SIZE ? Fake.AccessCount : FAKE_LOG_SIZE);
+  for (size_t z = 0; z < End; ++z)
+  {
+    const Fake_Access* pAccess = &Fake.Log[z];
+    if ((pAccess->Channel == channel) && (pAccess->Address == address) && (pAccess->IsRead == isRead) && ((bank == FAKE_BANK_COUNT) || (pAccess->Bank == bank))) Count++;
+  }
+  return Count;
+}
+
+
+//=============================================================================
+// Device helpers
+//=============================================================================
+eERRORRESULT Fake_InitDevice(SC16IS7XX *pComp)
+{
+  memset(pComp, 0, sizeof(*pComp));
+  pComp->XtalFreq            = 14745600;
+  pComp->DevicePN            = SC16IS752;
+  pComp->Interface           = SC16IS7XX_INTERFACE_SPI;
+  pComp->SPIchipSelect       = 0;
+#ifdef USE_DYNAMIC_INTERFACE
+  pComp->SPI                 = &FakeSPI;
+#else
+  pComp->SPI                 = FakeSPI;
+#endif
+  pComp->InterfaceClockSpeed = 1000000;
+  pComp->fnGetCurrentms      = Fake_GetCurrentms;
+  Fake_Reset();
+  return Init_SC16IS7XX(pComp, NULL);
+}
+
+void Fake_DefaultUARTconfig(SC16IS7XX_UARTconfig *pConf)
+{
+  static int32_t BaudrateError;
+  memset(pConf, 0, sizeof(*pConf));
+  pConf->UARTtype     = SC16IS7XX_UART_RS232;
+  pConf->UARTwordLen  = SC16IS7XX_DATA_LENGTH_8bits;
+  pConf->UARTparity   = SC16IS7XX_NO_PARITY;
+  pConf->UARTstopBit  = SC16IS7XX_STOP_BIT_1bit;
+  pConf->UARTbaudrate = 115200;
+  pConf->UARTbaudrateError = &BaudrateError;
+  pConf->RS232.ControlFlowType = SC16IS7XX_NO_CONTROL_FLOW;
+  pConf->UseFIFOs     = true;
+  pConf->TxTrigLvl    = SC16IS7XX_TX_FIFO_TRIGGER_AT_16_CHAR_SPACE;
+  pConf->RxTrigLvl    = SC16IS7XX_RX_FIFO_TRIGGER_AT_8_CHAR_AVAILABLE;
+  pConf->Interrupts   = SC16IS7XX_NO_INTERRUPT;
+}
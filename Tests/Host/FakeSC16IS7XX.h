@@ -0,0 +1,120 @@
+/*!*****************************************************************************
+ * @file    FakeSC16IS7XX.h
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host fake of a SC16IS752 on SPI, used by the host unit tests
+ * @details The fake decodes the SPI transfers of the driver (address byte then
+ * data bytes until the chip select is released) and models the register banks
+ * (LCR, EFR[4], MCR[2]), the Tx/Rx FIFOs, the FIFO levels, LSR, IIR and the
+ * software reset. Transfers are logged to let the tests count the accesses
+ ******************************************************************************/
+#ifndef FAKESC16IS7XX_H_INC
+#define FAKESC16IS7XX_H_INC
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#include "SC16IS7XX.h"
+#include <stdio.h>
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+#define FAKE_FIFO_SIZE  ( 64 ) //!< Size of the Tx and Rx FIFOs of the fake
+#define FAKE_LOG_SIZE   ( 512 ) //!< Count of register accesses kept in the access log
+
+//! Register banks of the fake
+typedef enum
+{
+  FAKE_BANK_GENERAL,  //!< General register set
+  FAKE_BANK_TCR_TLR,  //!< TCR and TLR registers
+  FAKE_BANK_SPECIAL,  //!< Special register set (DLL, DLH)
+  FAKE_BANK_ENHANCED, //!< Enhanced register set (EFR, XON1, XON2, XOFF1, XOFF2)
+  FAKE_BANK_COUNT,    // Keep last
+} eFake_Bank;
+
+//! Register access of the access log
+typedef struct
+{
+  uint8_t Channel; //!< Channel of the access
+  uint8_t Address; //!< Register address of the access
+  uint8_t Bank;    //!< Bank accessed (#eFake_Bank)
+  uint8_t Value;   //!< First data byte of the access
+  uint8_t Count;   //!< Count of data bytes of the access
+  bool IsRead;     //!< Indicate a read access
+} Fake_Access;
+
+//! Fake device state
+typedef struct
+{
+  uint32_t Currentms;                  //!< Current time given by Fake_GetCurrentms()
+  unsigned Transactions;               //!< Count of SPI transactions (address byte) since the last Fake_Reset()
+  size_t AccessCount;                  //!< Count of register accesses since the last Fake_ClearLog()
+  Fake_Access Log[FAKE_LOG_SIZE];      //!< Access log, the first FAKE_LOG_SIZE accesses since the last Fake_ClearLog()
+  bool IsSelected;                     //!< Indicate that the chip select is asserted
+  unsigned FailTransfer;               //!< When not 0, the FailTransfer-th next transfer returns ERR__SPI_COMM_ERROR
+  bool Verbose;                        //!< Print the accesses
+} Fake_State;
+
+extern Fake_State Fake;            //!< State of the fake device
+extern SPI_Interface FakeSPI;      //!< SPI interface connected to the fake device
+
+//-----------------------------------------------------------------------------
+
+//! Reset the fake device (registers, FIFOs, log and counters)
+void Fake_Reset(void);
+
+//! Clear the access log
+void Fake_ClearLog(void);
+
+//! Give the fake time in milliseconds, to use as fnGetCurrentms
+uint32_t Fake_GetCurrentms(void);
+
+//! Push chars in the Rx FIFO of a channel (as received on the UART line). Chars beyond the FIFO size set the overrun error
+void Fake_PushRx(uint8_t channel, const uint8_t *data, size_t size);
+
+//! Set line error bits (LSR[4:1]) on the last char pushed in the Rx FIFO of a channel
+void Fake_SetRxError(uint8_t channel, uint8_t lsrBits);
+
+//! Get and remove the chars sent in the Tx FIFO of a channel (as sent on the UART line)
+size_t Fake_DrainTx(uint8_t channel, uint8_t *data, size_t max);
+
+//! Get a register value of a bank of a channel, without side effects
+uint8_t Fake_GetRegister(uint8_t channel, eFake_Bank bank, uint8_t address);
+
+//! Set a register value of a bank of a channel, without side effects
+void Fake_SetRegister(uint8_t channel, eFake_Bank bank, uint8_t address, uint8_t value);
+
+//! Count the accesses of the log matching a channel, an address, a bank (FAKE_BANK_COUNT for any) and a direction
+size_t Fake_CountAccesses(uint8_t channel, uint8_t address, uint8_t bank, bool isRead);
+
+//! Initialize a device structure connected to the fake and run Init_SC16IS7XX()
+eERRORRESULT Fake_InitDevice(SC16IS7XX *pComp);
+
+//! Fill a default UART configuration (115200 8N1, FIFOs enabled, no interrupts)
+void Fake_DefaultUARTconfig(SC16IS7XX_UARTconfig *pConf);
+
+//-----------------------------------------------------------------------------
+
+extern unsigned TestFailures; //!< Count of failed checks
+
+//! Check a condition and report the failure without stopping the test
+#define TEST_CHECK(condition)  do { if (!(condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); TestFailures++; } } while (0)
+
+//! Check that two integers are equal
+#define TEST_EQUAL(expected, actual)  do { const long long Exp_ = (long long)(expected), Act_ = (long long)(actual); if (Exp_ != Act_) { printf("%s:%d: check failed: %s == %s (%lld != %lld)\n", __FILE__, __LINE__, #expected, #actual, Exp_, Act_); TestFailures++; } } while (0)
+
+//! Check that a data array is equal to a string
+#define TEST_DATA(expected, data, size)  do { const size_t Len_ = strlen(expected); if ((Len_ != (size_t)(size)) || (memcmp((expected), (data), Len_) != 0)) { printf("%s:%d: check failed: \"%s\" == \"%.*s\"\n", __FILE__, __LINE__, (expected), (int)(size), (const char*)(data)); TestFailures++; } } while (0)
+
+//! Print the test result and give the exit code
+#define TEST_RESULT(name)  ( printf("%s: %s (%u failure(s))\n", (name), (TestFailures == 0 ? "PASS" : "FAIL"), TestFailures), (TestFailures == 0 ? 0 : 1) )
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* FAKESC16IS7XX_H_INC */
@@ -0,0 +1,111 @@
+/*!*****************************************************************************
+ * @file    TestBankSession.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the bank sessions with the shadow registers (SC16IS7XX_USE_BANK_TRACKING and SC16IS7XX_USE_SHADOW_REGISTERS)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// A modification after a deferred return to general registers uses the general register value
+//=============================================================================
+static void Test_ModifyAfterDeferredReturn(void)
+{
+  SC16IS7XX Device;
+  uint8_t OriginalLCR;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_EnableEnhancedFunctions(&Device, SC16IS7XX_CHANNEL_A)); // EFR known, then MCR writes are stored
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0x03));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_MCR, 0x00));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_BeginBankSession(&Device, SC16IS7XX_CHANNEL_A));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_SetRegisterAccess(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER, &OriginalLCR));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_XON1, 0x11)); // XON1 is at the MCR address
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReturnAccessToGeneralRegister(&Device, SC16IS7XX_CHANNEL_A, OriginalLCR)); // Deferred
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ModifyRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_MCR, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE, SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_EndBankSession(&Device, SC16IS7XX_CHANNEL_A));
+
+  TEST_EQUAL(SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_MCR));
+  TEST_EQUAL(0x11, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_ENHANCED, RegSC16IS7XX_XON1));
+  TEST_EQUAL(0x03, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_LCR));
+}
+
+
+//=============================================================================
+// A modification after a deferred return from the special registers uses the general register value
+//=============================================================================
+static void Test_ModifyAfterDeferredSpecialReturn(void)
+{
+  SC16IS7XX Device;
+  uint8_t OriginalLCR;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_EnableEnhancedFunctions(&Device, SC16IS7XX_CHANNEL_A)); // EFR known, then IER writes are stored
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0x03));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_IER, 0x01));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_BeginBankSession(&Device, SC16IS7XX_CHANNEL_A));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_SetRegisterAccess(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_LCR_VALUE_SET_SPECIAL_REGISTER, &OriginalLCR));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_DLH, 0x00)); // DLH is at the IER address
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReturnAccessToGeneralRegister(&Device, SC16IS7XX_CHANNEL_A, OriginalLCR)); // Deferred
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ModifyRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_IER, 0x02, 0x02));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_EndBankSession(&Device, SC16IS7XX_CHANNEL_A));
+
+  TEST_EQUAL(0x00, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_SPECIAL, RegSC16IS7XX_DLH));
+  TEST_EQUAL(0x03, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_IER));
+}
+
+
+//=============================================================================
+// A UART initialization with software control flow leaves the registers with the configured values
+//=============================================================================
+static void Test_InitUARTsoftFlow(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&UART, 0, sizeof(UART));
+  UART.Device  = &Device;
+  UART.Channel = SC16IS7XX_CHANNEL_B;
+  Fake_DefaultUARTconfig(&Config);
+  Config.RS232.ControlFlowType = SC16IS7XX_SOFTWARE_CONTROL_FLOW;
+  Config.RS232.SoftFlowControl.HoldAt     = SC16IS7XX_RESUME_WHEN_RX_FIFO_AT_48_CHAR;
+  Config.RS232.SoftFlowControl.ResumeAt   = SC16IS7XX_RESUME_WHEN_RX_FIFO_AT_16_CHAR;
+  Config.RS232.SoftFlowControl.Config     = SC16IS7XX_TxXon1Xoff1_RxXon1Xoff1;
+  Config.RS232.SoftFlowControl.XonAnyChar = true;
+  Config.RS232.SoftFlowControl.Xon1  = 0x11;
+  Config.RS232.SoftFlowControl.Xon2  = 0x12;
+  Config.RS232.SoftFlowControl.Xoff1 = 0x13;
+  Config.RS232.SoftFlowControl.Xoff2 = 0x14;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, &Config));
+
+  TEST_EQUAL(0x03, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_GENERAL, RegSC16IS7XX_LCR));   // 8N1, back to general registers
+  TEST_EQUAL(SC16IS7XX_MCR_XON_ANY_FUNCTION_ENABLE, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_GENERAL, RegSC16IS7XX_MCR) & (SC16IS7XX_MCR_XON_ANY_FUNCTION_Mask | SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_Mask)); // Xon any, TCR and TLR disabled
+  TEST_EQUAL(0x11, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_ENHANCED, RegSC16IS7XX_XON1));
+  TEST_EQUAL(0x12, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_ENHANCED, RegSC16IS7XX_XON2));
+  TEST_EQUAL(0x13, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_ENHANCED, RegSC16IS7XX_XOFF1));
+  TEST_EQUAL(0x14, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_ENHANCED, RegSC16IS7XX_XOFF2));
+  TEST_EQUAL(SC16IS7XX_EFR_SOFT_FLOW_CONTROL_SET(SC16IS7XX_TxXon1Xoff1_RxXon1Xoff1) | SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE,
+             Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_ENHANCED, RegSC16IS7XX_EFR));
+  TEST_EQUAL(0, Device.BankState[SC16IS7XX_CHANNEL_B].SessionDepth);
+  TEST_CHECK(Device.BankState[SC16IS7XX_CHANNEL_B].IsPending == false);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_ModifyAfterDeferredReturn();
+  Test_ModifyAfterDeferredSpecialReturn();
+  Test_InitUARTsoftFlow();
+  return TEST_RESULT("TestBankSession");
+}
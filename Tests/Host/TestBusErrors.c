@@ -0,0 +1,109 @@
+/*!*****************************************************************************
+ * @file    TestBusErrors.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the bus error handling (blocking, SC16IS7XX_USE_NON_BLOCKING_TRANSFERS and SC16IS7XX_USE_TRACE)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// A failed data phase of a register write releases the chip select
+//=============================================================================
+static void Test_WriteDataPhaseFailure(void)
+{
+  SC16IS7XX Device;
+  uint8_t Value;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  Fake.FailTransfer = 2;                                                 // The address is sent, the data phase fails
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x5A));
+  TEST_CHECK(Fake.IsSelected == false);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0xA5)); // The next transfer starts with an address byte
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, &Value));
+  TEST_EQUAL(0xA5, Value);
+}
+
+
+//=============================================================================
+// A failed data phase of a register read releases the chip select
+//=============================================================================
+static void Test_ReadDataPhaseFailure(void)
+{
+  SC16IS7XX Device;
+  uint8_t Value;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x3C));
+  Fake.FailTransfer = 2;                                                 // The address is sent, the data phase fails
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, &Value));
+  TEST_CHECK(Fake.IsSelected == false);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, &Value));
+  TEST_EQUAL(0x3C, Value);
+}
+
+
+//=============================================================================
+// A failed start of a non-blocking burst releases the chip select and the UART
+//=============================================================================
+static void Test_NonBlockingDataPhaseFailure(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint8_t Data[4] = { 'a', 'b', 'c', 'd' };
+  uint8_t Sent[8];
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&UART, 0, sizeof(UART));
+  UART.Device  = &Device;
+  UART.Channel = SC16IS7XX_CHANNEL_A;
+  Fake.FailTransfer = 2;                                                 // The address is sent, the data phase fails
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, SC16IS7XX_StartTransmitBurst(&UART, &Data[0], sizeof(Data)));
+  TEST_CHECK(Fake.IsSelected == false);
+  TEST_CHECK(UART.TransferInProgress == false);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartTransmitBurst(&UART, &Data[0], sizeof(Data)));
+  TEST_DATA("abcd", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+}
+
+
+//=============================================================================
+// A failed LCR write makes the traced LCR value unknown
+//=============================================================================
+static void Test_TraceFailedLCRwrite(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_Trace Trace;
+  SC16IS7XX_TraceEntry Entries[8];
+  uint8_t Value;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&Trace, 0, sizeof(Trace));
+  Trace.pEntries   = &Entries[0];
+  Trace.EntryCount = 8;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartTrace(&Device, &Trace));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0x03));
+  TEST_CHECK((Trace.LCRknown & 0x1) > 0);
+  Fake.FailTransfer = 2;                                                 // The address is sent, the data phase fails
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0xBF));
+  TEST_CHECK((Trace.LCRknown & 0x1) == 0);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, &Value));
+  TEST_CHECK((Entries[Trace.PosIn - 1].Flags & SC16IS7XX_TRACE_LCR_KNOWN) == 0); // The register bank of the access is not known
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, &Value));
+  TEST_CHECK((Trace.LCRknown & 0x1) > 0);                                // A blocking read gives the LCR value back
+  TEST_EQUAL(Value, Trace.LastLCR[SC16IS7XX_CHANNEL_A]);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_WriteDataPhaseFailure();
+  Test_ReadDataPhaseFailure();
+  Test_NonBlockingDataPhaseFailure();
+  Test_TraceFailedLCRwrite();
+  return TEST_RESULT("TestBusErrors");
+}
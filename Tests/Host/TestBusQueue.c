@@ -0,0 +1,147 @@
+/*!*****************************************************************************
+ * @file    TestBusQueue.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the shared bus request queue (SC16IS7XX_USE_BUS_QUEUE)
+ * @details The requests only record their execution order, the nested
+ * submissions play the other contexts (ex: an ISR) while the bus owner runs
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static SC16IS7XX Device;
+static SC16IS7XX_BusQueue Queue;
+static char Executed[16];       // Names of the requests executed, in order
+static size_t ExecutedCount;    // Count of requests executed
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Reset the device, the queue and the execution record
+//=============================================================================
+static void Test_Reset(void)
+{
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&Queue, 0, sizeof(Queue));
+  Device.BusQueue = &Queue;
+  memset(&Executed[0], 0, sizeof(Executed));
+  ExecutedCount = 0;
+}
+
+static void Test_InitRequest(SC16IS7XX_BusRequest *pRequest, SC16IS7XX_BusRequest_Func fnExecute, const char *name)
+{
+  memset(pRequest, 0, sizeof(*pRequest));
+  pRequest->fnExecute = fnExecute;
+  pRequest->pContext  = (void*)name;
+}
+
+//! Record the execution of a request
+static eERRORRESULT Test_Record(SC16IS7XX_BusRequest *pRequest)
+{
+  if (ExecutedCount < (sizeof(Executed) - 1)) Executed[ExecutedCount++] = *(const char*)pRequest->pContext;
+  return ERR_OK;
+}
+
+
+static SC16IS7XX_BusRequest RequestRx, RequestTx, RequestConfig;
+
+//! Record the execution, then submit requests of all priorities as other contexts would do while the bus is owned
+static eERRORRESULT Test_SubmitDuringExecution(SC16IS7XX_BusRequest *pRequest)
+{
+  Test_Record(pRequest);
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_SubmitBusRequest(&Device, &RequestConfig, SC16IS7XX_PRIORITY_CONFIG));
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_SubmitBusRequest(&Device, &RequestTx, SC16IS7XX_PRIORITY_TX_FILL));
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_SubmitBusRequest(&Device, &RequestRx, SC16IS7XX_PRIORITY_RX_DRAIN));
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_SubmitBusRequest(&Device, &RequestRx, SC16IS7XX_PRIORITY_RX_DRAIN)); // Submitted again before its execution
+  return ERR_OK;
+}
+
+//! A configuration request of two steps, with the Rx drain requests executed between them
+static eERRORRESULT Test_ConfigWithYield(SC16IS7XX_BusRequest *pRequest)
+{
+  Test_Record(pRequest);
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_SubmitBusRequest(&Device, &RequestTx, SC16IS7XX_PRIORITY_TX_FILL));
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_SubmitBusRequest(&Device, &RequestRx, SC16IS7XX_PRIORITY_RX_DRAIN));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_YieldBusQueue(&Queue));
+  Test_Record(pRequest);                                                // Second step
+  return ERR_OK;
+}
+
+
+//=============================================================================
+// The pending requests are executed by the bus owner by priority order
+//=============================================================================
+static void Test_PriorityOrder(void)
+{
+  SC16IS7XX_BusRequest RequestFirst;
+  Test_Reset();
+  Test_InitRequest(&RequestFirst, Test_SubmitDuringExecution, "F");
+  Test_InitRequest(&RequestRx, Test_Record, "R");
+  Test_InitRequest(&RequestTx, Test_Record, "T");
+  Test_InitRequest(&RequestConfig, Test_Record, "C");
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_SubmitBusRequest(&Device, &RequestFirst, SC16IS7XX_PRIORITY_CONFIG));
+  TEST_DATA("FRTC", Executed, ExecutedCount);                          // The Rx drain request is executed once
+  TEST_CHECK(RequestRx.IsDone && RequestTx.IsDone && RequestConfig.IsDone);
+  TEST_CHECK(Queue.IsOwned == false);
+}
+
+
+//=============================================================================
+// A request submitted while another context owns the bus is executed by the owner
+//=============================================================================
+static void Test_OwnershipHandOff(void)
+{
+  Test_Reset();
+  Test_InitRequest(&RequestRx, Test_Record, "R");
+  Queue.IsOwned = true;                                                 // Another context owns the bus
+
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_SubmitBusRequest(&Device, &RequestRx, SC16IS7XX_PRIORITY_RX_DRAIN));
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_SubmitBusRequest(&Device, &RequestRx, SC16IS7XX_PRIORITY_RX_DRAIN)); // Submitted again before its execution
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_ProcessBusQueue(&Queue));
+  TEST_EQUAL(0, ExecutedCount);
+
+  Queue.IsOwned = false;                                                // The owner ends its request and processes the queue
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ProcessBusQueue(&Queue));
+  TEST_DATA("R", Executed, ExecutedCount);
+  TEST_CHECK(RequestRx.IsDone);
+  TEST_CHECK(RequestRx.IsQueued == false);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_SubmitBusRequest(&Device, &RequestRx, SC16IS7XX_PRIORITY_RX_DRAIN)); // Submitted again after its execution
+  TEST_DATA("RR", Executed, ExecutedCount);
+}
+
+
+//=============================================================================
+// A configuration request lets the Rx drain requests run between its steps
+//=============================================================================
+static void Test_YieldToRxDrain(void)
+{
+  SC16IS7XX_BusRequest RequestLong;
+  Test_Reset();
+  Test_InitRequest(&RequestLong, Test_ConfigWithYield, "L");
+  Test_InitRequest(&RequestRx, Test_Record, "R");
+  Test_InitRequest(&RequestTx, Test_Record, "T");
+
+  TEST_EQUAL(ERR__NOT_AVAILABLE, SC16IS7XX_YieldBusQueue(&Queue));     // Not the bus owner
+  TEST_EQUAL(ERR_OK, SC16IS7XX_SubmitBusRequest(&Device, &RequestLong, SC16IS7XX_PRIORITY_CONFIG));
+  TEST_DATA("LRLT", Executed, ExecutedCount);                          // Only the Rx drain request runs between the steps
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_PriorityOrder();
+  Test_OwnershipHandOff();
+  Test_YieldToRxDrain();
+  return TEST_RESULT("TestBusQueue");
+}
@@ -0,0 +1,145 @@
+/*!*****************************************************************************
+ * @file    TestBusStatistics.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the bus statistics (SC16IS7XX_USE_BUS_STATISTICS)
+ * @details The SPI accesses use the fake device, the I2C accesses use an
+ * interface that only accepts the transfers
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static SC16IS7XX Device;
+static SC16IS7XX_BusStatistics Statistics;
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// I2C transfer that accepts all the transfers, and check of counters
+//=============================================================================
+static eERRORRESULT Test_I2Ctransfer(I2C_Interface *pIntDev, I2CInterface_Packet* const pPacketDesc)
+{
+  (void)pIntDev;
+  if ((pPacketDesc->pBuffer != NULL) && ((pPacketDesc->ChipAddr & I2C_READ_ORMASK) > 0)) memset(pPacketDesc->pBuffer, 0x00, pPacketDesc->BufferSize);
+  return ERR_OK;
+}
+
+static void Test_Counters(int line, const SC16IS7XX_BusCounters *pCounters, uint32_t transactions, uint32_t payloadBytes, uint32_t overheadBytes)
+{
+  if ((pCounters->Transactions != transactions) || (pCounters->PayloadBytes != payloadBytes) || (pCounters->OverheadBytes != overheadBytes))
+  {
+    printf("%s:%d: counters failed: { %u, %u, %u } != { %u, %u, %u }\n", __FILE__, line, (unsigned)transactions, (unsigned)payloadBytes, (unsigned)overheadBytes,
+           (unsigned)pCounters->Transactions, (unsigned)pCounters->PayloadBytes, (unsigned)pCounters->OverheadBytes);
+    TestFailures++;
+  }
+}
+
+
+//=============================================================================
+// The SPI transactions are counted per channel and register, with the register address as overhead
+//=============================================================================
+static void Test_SPIcounters(void)
+{
+  SC16IS7XX_UART UART;
+  SC16IS7XX_UARTconfig Config;
+  SC16IS7XX_BusCounters Total;
+  size_t ActuallySent;
+  uint8_t Value;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&UART, 0, sizeof(UART));
+  UART.Device       = &Device;
+  UART.Channel      = SC16IS7XX_CHANNEL_A;
+  UART.DriverConfig = SC16IS7XX_DRIVER_BURST_TX;
+  Fake_DefaultUARTconfig(&Config);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, &Config));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ResetBusStatistics(&Device));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x12));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x34));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_B, RegSC16IS7XX_SPR, &Value));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, (uint8_t*)"hello", 5, &ActuallySent)); // TXLVL read, then THR burst
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetBusStatistics(&Device, &Statistics, false));
+  Test_Counters(__LINE__, &Statistics.Write[SC16IS7XX_CHANNEL_A][RegSC16IS7XX_SPR], 2, 2, 2);
+  Test_Counters(__LINE__, &Statistics.Read[SC16IS7XX_CHANNEL_B][RegSC16IS7XX_SPR], 1, 1, 1);
+  Test_Counters(__LINE__, &Statistics.Read[SC16IS7XX_CHANNEL_A][RegSC16IS7XX_TXLVL], 1, 1, 1);
+  Test_Counters(__LINE__, &Statistics.Write[SC16IS7XX_CHANNEL_A][RegSC16IS7XX_THR], 1, 5, 1);
+  Test_Counters(__LINE__, &Statistics.Read[SC16IS7XX_CHANNEL_A][RegSC16IS7XX_SPR], 0, 0, 0);
+  SC16IS7XX_GetBusTotalCounters(&Statistics, SC16IS7XX_CHANNEL_A, &Total);
+  Test_Counters(__LINE__, &Total, 4, 8, 4);
+  SC16IS7XX_GetBusTotalCounters(&Statistics, SC16IS7XX_CHANNEL_B, &Total);
+  Test_Counters(__LINE__, &Total, 1, 1, 1);
+  SC16IS7XX_GetBusTotalCounters(&Statistics, (eSC16IS7XX_Channel)SC16IS7XX_CHANNEL_COUNT, &Total); // Not a channel of the statistics
+  Test_Counters(__LINE__, &Total, 0, 0, 0);
+
+  Fake.FailTransfer = 1;                                                // A failed transaction is not counted
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x56));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetBusStatistics(&Device, &Statistics, false));
+  Test_Counters(__LINE__, &Statistics.Write[SC16IS7XX_CHANNEL_A][RegSC16IS7XX_SPR], 2, 2, 2);
+}
+
+
+//=============================================================================
+// The snapshot can reset the statistics, as the reset function
+//=============================================================================
+static void Test_SnapshotAndReset(void)
+{
+  SC16IS7XX_BusCounters Total;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ResetBusStatistics(&Device));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_B, RegSC16IS7XX_SPR, 0x12));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetBusStatistics(&Device, &Statistics, true));
+  Test_Counters(__LINE__, &Statistics.Write[SC16IS7XX_CHANNEL_B][RegSC16IS7XX_SPR], 1, 1, 1); // The snapshot is taken before the reset
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetBusStatistics(&Device, &Statistics, false));
+  SC16IS7XX_GetBusTotalCounters(&Statistics, SC16IS7XX_CHANNEL_B, &Total);
+  Test_Counters(__LINE__, &Total, 0, 0, 0);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_B, RegSC16IS7XX_SPR, 0x34));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ResetBusStatistics(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetBusStatistics(&Device, &Statistics, false));
+  SC16IS7XX_GetBusTotalCounters(&Statistics, SC16IS7XX_CHANNEL_B, &Total);
+  Test_Counters(__LINE__, &Total, 0, 0, 0);
+}
+
+
+//=============================================================================
+// The I2C transactions have the chip address and register address as overhead, plus the chip address of the restart for a read
+//=============================================================================
+static void Test_I2Ccounters(void)
+{
+  SC16IS7XX_BusCounters Total;
+  uint8_t Value;
+  memset(&Device, 0, sizeof(Device));
+  Device.Interface          = SC16IS7XX_INTERFACE_I2C;
+  Device.I2Caddress         = SC16IS7XX_ADDRESS_A1L_A0L;
+  Device.I2C.fnI2C_Transfer = Test_I2Ctransfer;
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x12));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_B, RegSC16IS7XX_SPR, &Value));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_B, RegSC16IS7XX_SPR, &Value));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetBusStatistics(&Device, &Statistics, false));
+  Test_Counters(__LINE__, &Statistics.Write[SC16IS7XX_CHANNEL_A][RegSC16IS7XX_SPR], 1, 1, 2);
+  Test_Counters(__LINE__, &Statistics.Read[SC16IS7XX_CHANNEL_B][RegSC16IS7XX_SPR], 2, 2, 6);
+  SC16IS7XX_GetBusTotalCounters(&Statistics, SC16IS7XX_CHANNEL_A, &Total);
+  Test_Counters(__LINE__, &Total, 1, 1, 2);
+  SC16IS7XX_GetBusTotalCounters(&Statistics, SC16IS7XX_CHANNEL_B, &Total);
+  Test_Counters(__LINE__, &Total, 2, 2, 6);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_SPIcounters();
+  Test_SnapshotAndReset();
+  Test_I2Ccounters();
+  return TEST_RESULT("TestBusStatistics");
+}
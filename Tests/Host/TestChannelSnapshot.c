@@ -0,0 +1,90 @@
+/*!*****************************************************************************
+ * @file    TestChannelSnapshot.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of SC16IS7XX_GetChannelSnapshot() (SC16IS7XX_USE_BUFFERS, with or without SC16IS7XX_USE_ADAPTIVE_TRIGGER)
+ * @details With the adaptive trigger levels, the TCR and TLR access stays
+ * enabled: the register chain reads TCR at the MSR address, then MSR is read
+ * with a second access
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+#  define TEST_NAME  "TestChannelSnapshotAdaptive"
+#else
+#  define TEST_NAME  "TestChannelSnapshot"
+#endif
+
+static SC16IS7XX Device;
+static SC16IS7XX_UART UART;
+static uint8_t RxData[16]; // Rx buffer of the UART
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+static SC16IS7XX_TriggerControl Control;
+#endif
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// The snapshot gives the status registers of the channel
+//=============================================================================
+static void Test_Snapshot(void)
+{
+  SC16IS7XX_UARTconfig Config;
+  SC16IS7XX_ChannelSnapshot Snapshot;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&UART, 0, sizeof(UART));
+  UART.Device       = &Device;
+  UART.Channel      = SC16IS7XX_CHANNEL_B;
+  UART.DriverConfig = SC16IS7XX_DRIVER_BURST_RX;
+  UART.RxBuffer.pData      = &RxData[0];
+  UART.RxBuffer.BufferSize = sizeof(RxData);
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+  memset(&Control, 0, sizeof(Control));
+  UART.pTriggerControl = &Control;
+#endif
+  Fake_DefaultUARTconfig(&Config);
+  Config.Interrupts = SC16IS7XX_RX_FIFO_INTERRUPT;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, &Config));
+  Fake_SetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_TCR_TLR, RegSC16IS7XX_TCR, 0xAB);
+  Fake_PushRx(SC16IS7XX_CHANNEL_B, (const uint8_t*)"abc", 3);
+  uint8_t Sent[4];
+  size_t ActuallySent;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, (uint8_t*)"xy", 2, &ActuallySent));
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetChannelSnapshot(&UART, &Snapshot));
+  TEST_EQUAL(SC16IS7XX_RECEIVER_TIMEOUT, Snapshot.InterruptSource);    // 3 chars, below the Rx trigger level
+  TEST_CHECK((Snapshot.LineStatus & SC16IS7XX_LSR_DATA_IN_RX_FIFO) > 0);
+  TEST_EQUAL(3, Snapshot.RxFIFOcount);
+  TEST_EQUAL(FAKE_FIFO_SIZE - 2, Snapshot.TxFIFOspace);
+  TEST_EQUAL(0x00, Snapshot.ControlPinsStatus);                         // MSR of the fake, not TCR
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_B, RegSC16IS7XX_MSR, FAKE_BANK_GENERAL, true));
+#ifdef SC16IS7XX_USE_ADAPTIVE_TRIGGER
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_B, RegSC16IS7XX_TCR, FAKE_BANK_TCR_TLR, true)); // Read by the register chain
+  TEST_CHECK((Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_GENERAL, RegSC16IS7XX_MCR) & SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE) > 0); // The TLR access is enabled again
+#else
+  TEST_EQUAL(5, Fake.AccessCount);                                      // Only the register chain
+#endif
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_B, RegSC16IS7XX_LSR, FAKE_BANK_GENERAL, true));
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_B, RegSC16IS7XX_RXLVL, FAKE_BANK_GENERAL, true));
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_B, RegSC16IS7XX_TXLVL, FAKE_BANK_GENERAL, true));
+  TEST_EQUAL(0, Fake_CountAccesses(SC16IS7XX_CHANNEL_B, RegSC16IS7XX_RHR, FAKE_BANK_COUNT, true)); // The snapshot does not consume data
+  TEST_DATA("xy", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_B, &Sent[0], sizeof(Sent)));
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_Snapshot();
+  return TEST_RESULT(TEST_NAME);
+}
@@ -0,0 +1,83 @@
+/*!*****************************************************************************
+ * @file    TestFastPath.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the fast path functions (SC16IS7XX_USE_FAST_PATH with SC16IS7XX_ONLY_SPI)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static SC16IS7XX Device;
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// The fast register accesses are one transaction each
+//=============================================================================
+static void Test_Registers(void)
+{
+  uint8_t Value = 0;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_FastWriteRegister(&Device, SC16IS7XX_CHANNEL_B, RegSC16IS7XX_SPR, 0x5A));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_FastReadRegister(&Device, SC16IS7XX_CHANNEL_B, RegSC16IS7XX_SPR, &Value));
+  TEST_EQUAL(0x5A, Value);
+  TEST_EQUAL(2, Fake.AccessCount);
+  TEST_EQUAL(0x5A, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_GENERAL, RegSC16IS7XX_SPR));
+}
+
+
+//=============================================================================
+// The fast FIFO bursts transfer the data and consume the Tx FIFO credit
+//=============================================================================
+static void Test_FIFObursts(void)
+{
+  uint8_t Data[4] = { 'a', 'b', 'c', 'd' }, Received[4], Sent[8];
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  Device.TxFIFOcredit[SC16IS7XX_CHANNEL_A] = FAKE_FIFO_SIZE;
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"wxyz", 4);
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_FastWriteTHR(&Device, SC16IS7XX_CHANNEL_A, &Data[0], sizeof(Data)));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_FastReadRHR(&Device, SC16IS7XX_CHANNEL_A, &Received[0], sizeof(Received)));
+  TEST_EQUAL(2, Fake.AccessCount);
+  TEST_EQUAL(FAKE_FIFO_SIZE - sizeof(Data), Device.TxFIFOcredit[SC16IS7XX_CHANNEL_A]);
+  TEST_DATA("abcd", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+  TEST_DATA("wxyz", Received, sizeof(Received));
+}
+
+
+//=============================================================================
+// A failed data phase releases the chip select
+//=============================================================================
+static void Test_FailedDataPhase(void)
+{
+  uint8_t Data[2] = { 'a', 'b' };
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+
+  Fake.FailTransfer = 2;                                                // The address is sent, the data fail
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, SC16IS7XX_FastWriteTHR(&Device, SC16IS7XX_CHANNEL_A, &Data[0], sizeof(Data)));
+  TEST_CHECK(Fake.IsSelected == false);
+  Fake.FailTransfer = 2;
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, SC16IS7XX_FastReadRHR(&Device, SC16IS7XX_CHANNEL_A, &Data[0], sizeof(Data)));
+  TEST_CHECK(Fake.IsSelected == false);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_Registers();
+  Test_FIFObursts();
+  Test_FailedDataPhase();
+  return TEST_RESULT("TestFastPath");
+}
@@ -0,0 +1,134 @@
+/*!*****************************************************************************
+ * @file    TestInterruptService.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the interrupt service with the Tx/Rx buffers (SC16IS7XX_USE_BUFFERS)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static uint8_t RxData[16];            // Rx buffer of the UART, holds 15 bytes
+static size_t RxErrorPosition;        // Position given by the last call of Test_RxError()
+static unsigned RxErrorCount;         // Count of calls of Test_RxError()
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Initialize a UART with a Rx buffer and the Rx interrupts
+//=============================================================================
+static void Test_InitUART(SC16IS7XX *pComp, SC16IS7XX_UART *pUART, setSC16IS7XX_DriverConfig driverConfig)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(pComp));
+  memset(pUART, 0, sizeof(*pUART));
+  pUART->Device       = pComp;
+  pUART->Channel      = SC16IS7XX_CHANNEL_A;
+  pUART->DriverConfig = driverConfig;
+  pUART->RxBuffer.pData      = &RxData[0];
+  pUART->RxBuffer.BufferSize = sizeof(RxData);
+  Fake_DefaultUARTconfig(&Config);
+  Config.Interrupts = SC16IS7XX_RX_FIFO_INTERRUPT | SC16IS7XX_RX_LINE_INTERRUPT;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(pUART, &Config));
+}
+
+static void Test_RxError(SC16IS7XX_UART *pUART, size_t position, setSC16IS7XX_ReceiveError error)
+{
+  RxErrorPosition = position;
+  RxErrorCount++;
+}
+
+
+//=============================================================================
+// A full Rx buffer masks the Rx interrupts until the application consumes data
+//=============================================================================
+static void Test_RxBufferFullMasksInterrupts(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint8_t *pData1, *pData2, Data[32], RxLevel;
+  size_t Size1, Size2;
+  Test_InitUART(&Device, &UART, SC16IS7XX_DRIVER_BURST_RX);
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)('A' + z);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, &Data[0], sizeof(Data));
+
+  TEST_EQUAL(ERR__BUFFER_FULL, SC16IS7XX_ServiceInterrupt(&UART));
+  TEST_EQUAL(0x00, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_IER) & 0x05); // Rx interrupts masked
+  TEST_EQUAL(0x05, UART.RxIERmasked);
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ServiceInterrupt(&UART));                // No Rx interrupt pending anymore
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_IIR, FAKE_BANK_COUNT, true));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxPeek(&UART, &pData1, &Size1, &pData2, &Size2));
+  TEST_EQUAL(15, Size1 + Size2);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxConsume(&UART, 10));
+  TEST_EQUAL(0x05, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_IER) & 0x05); // Rx interrupts enabled again
+  TEST_EQUAL(0x00, UART.RxIERmasked);
+  TEST_EQUAL(ERR__BUFFER_FULL, SC16IS7XX_ServiceInterrupt(&UART));      // 10 more chars received, the buffer is full again
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetDataCountRxFIFO(&UART, &RxLevel));
+  TEST_EQUAL(32 - 25, RxLevel);
+}
+
+
+//=============================================================================
+// With SC16IS7XX_DRIVER_SAFE_RX, the service stops after an erroneous char
+//=============================================================================
+static void Test_SafeRxStopsAtError(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint8_t Data[16];
+  size_t Size;
+  setSC16IS7XX_ReceiveError LastError;
+  Test_InitUART(&Device, &UART, SC16IS7XX_DRIVER_SAFE_RX);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"ab", 2);
+  Fake_SetRxError(SC16IS7XX_CHANNEL_A, SC16IS7XX_LSR_PARITY_ERROR);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"cd", 2);
+
+  TEST_EQUAL(ERR__RECEIVE_ERROR, SC16IS7XX_ServiceInterrupt(&UART));
+  TEST_CHECK((UART.RxErrors & SC16IS7XX_PARITY_ERROR) > 0);
+  TEST_EQUAL(2, UART.RxBuffer.PosIn - UART.RxBuffer.PosOut);            // The erroneous char is the last one of the Rx buffer
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ServiceInterrupt(&UART));
+  UART.DriverConfig = SC16IS7XX_DRIVER_BURST_RX;                        // Get the data from the Rx buffer only
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReceiveData(&UART, &Data[0], sizeof(Data), &Size, &LastError));
+  TEST_DATA("abcd", Data, Size);
+}
+
+
+//=============================================================================
+// With SC16IS7XX_DRIVER_HYBRID_RX, each erroneous char is reported to fnRxError
+//=============================================================================
+static void Test_HybridRxReportsError(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  Test_InitUART(&Device, &UART, SC16IS7XX_DRIVER_HYBRID_RX);
+  UART.fnRxError = Test_RxError;
+  RxErrorCount = 0;
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"abc", 3);
+  Fake_SetRxError(SC16IS7XX_CHANNEL_A, SC16IS7XX_LSR_FRAMING_ERROR);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"def", 3);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ServiceInterrupt(&UART));
+  TEST_EQUAL(1, RxErrorCount);
+  TEST_EQUAL(2, RxErrorPosition);                                       // Index of 'c' in the Rx buffer
+  TEST_CHECK((UART.RxErrors & SC16IS7XX_FRAMING_ERROR) > 0);
+  TEST_DATA("abcdef", UART.RxBuffer.pData, UART.RxBuffer.PosIn - UART.RxBuffer.PosOut);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_RxBufferFullMasksInterrupts();
+  Test_SafeRxStopsAtError();
+  Test_HybridRxReportsError();
+  return TEST_RESULT("TestInterruptService");
+}
@@ -0,0 +1,193 @@
+/*!*****************************************************************************
+ * @file    TestNonBlocking.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the non-blocking transfers completion (SC16IS7XX_USE_NON_BLOCKING_TRANSFERS and SC16IS7XX_USE_TRACE)
+ * @details The SPI interface of the tests plays a DMA: the polling transfers
+ * are accepted busy, and their data are transferred with the fake device when
+ * a status check finds them complete
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static SC16IS7XX Device;
+static SC16IS7XX_UART UART;
+static SC16IS7XX_Trace Trace;
+static SC16IS7XX_TraceEntry Entries[8];
+static SPIInterface_Packet PendingPacket; // Polling transfer in progress
+static bool IsPending;                    // Indicate that a polling transfer is in progress
+static unsigned BusyChecks;               // Count of next status checks that find the transfer in progress
+static unsigned CompleteCount;            // Count of fnTransferComplete calls
+static eERRORRESULT CompleteResult;       // Last result given to fnTransferComplete
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// SPI transfer with a DMA, and transfer complete callback
+//=============================================================================
+static eERRORRESULT Test_DMAtransfer(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketDesc)
+{
+  if ((pPacketDesc->Config.Value & SPI_USE_POLLING) == 0) return FakeSPI.fnSPI_Transfer(pIntDev, pPacketDesc); // Blocking transfer
+  if (pPacketDesc->DataSize > 0)                                        // Start of a polling transfer
+  {
+    if (IsPending) return ERR__SPI_OTHER_BUSY;
+    PendingPacket = *pPacketDesc;
+    PendingPacket.Config.Value &= ~SPI_USE_POLLING;
+    IsPending = true;
+    pPacketDesc->Config.Bits.TransactionInc = 1;
+    return ERR__SPI_BUSY;
+  }
+  if (BusyChecks > 0) { --BusyChecks; return ERR__SPI_BUSY; }           // Status check
+  IsPending = false;
+  return FakeSPI.fnSPI_Transfer(pIntDev, &PendingPacket);               // The data are transferred at the completion
+}
+
+static void Test_TransferComplete(SC16IS7XX_UART *pUART, eERRORRESULT transferResult)
+{
+  CompleteCount++;
+  CompleteResult = transferResult;
+}
+
+
+//=============================================================================
+// Initialize the device with the DMA interface, the UART and the trace
+//=============================================================================
+static void Test_Init(bool useDMA)
+{
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  if (useDMA) Device.SPI.fnSPI_Transfer = Test_DMAtransfer;
+  memset(&UART, 0, sizeof(UART));
+  UART.Device             = &Device;
+  UART.Channel            = SC16IS7XX_CHANNEL_A;
+  UART.fnTransferComplete = Test_TransferComplete;
+  memset(&Trace, 0, sizeof(Trace));
+  Trace.pEntries   = &Entries[0];
+  Trace.EntryCount = sizeof(Entries) / sizeof(Entries[0]);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartTrace(&Device, &Trace));
+  IsPending      = false;
+  BusyChecks     = 0;
+  CompleteCount  = 0;
+  CompleteResult = ERR__NO_DATA_AVAILABLE;
+}
+
+
+//=============================================================================
+// A non-blocking read completes at the poll, and is then recorded with its data
+//=============================================================================
+static void Test_ReadCompletion(void)
+{
+  uint8_t Value = 0x00;
+  Test_Init(true);
+  Fake_SetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_SPR, 0x5A);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_PollTransfer(&UART));                    // No transfer in progress
+  TEST_EQUAL(0, CompleteCount);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartReadRegister(&UART, RegSC16IS7XX_SPR, &Value));
+  TEST_CHECK(UART.TransferInProgress);
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_StartReadRegister(&UART, RegSC16IS7XX_SPR, &Value));
+  TEST_EQUAL(0, Trace.TotalCount);                                      // Not recorded before the data are received
+  BusyChecks = 1;
+  TEST_EQUAL(ERR__BUSY, SC16IS7XX_PollTransfer(&UART));
+  TEST_EQUAL(0, CompleteCount);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_PollTransfer(&UART));
+  TEST_EQUAL(1, CompleteCount);
+  TEST_EQUAL(ERR_OK, CompleteResult);
+  TEST_CHECK(UART.TransferInProgress == false);
+  TEST_EQUAL(0x5A, Value);
+  TEST_EQUAL(1, Trace.TotalCount);
+  TEST_EQUAL(SC16IS7XX_CHANNEL_SET(SC16IS7XX_CHANNEL_A) | SC16IS7XX_ADDRESS_SET(RegSC16IS7XX_SPR), Entries[0].Command);
+  TEST_EQUAL(SC16IS7XX_TRACE_READ | SC16IS7XX_TRACE_NON_BLOCKING, Entries[0].Flags & (SC16IS7XX_TRACE_READ | SC16IS7XX_TRACE_NON_BLOCKING));
+  TEST_EQUAL(0x5A, Entries[0].Data[0]);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_PollTransfer(&UART));                    // Completed once
+  TEST_EQUAL(1, CompleteCount);
+  TEST_EQUAL(1, Trace.TotalCount);
+}
+
+
+//=============================================================================
+// A non-blocking burst receive is recorded with the data received, and gives the LCR value of the channel
+//=============================================================================
+static void Test_ReceiveBurstCompletion(void)
+{
+  uint8_t Received[4];
+  Test_Init(true);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"wxyz", 4);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartReceiveBurst(&UART, &Received[0], sizeof(Received)));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_PollTransfer(&UART));
+  TEST_DATA("wxyz", Received, sizeof(Received));
+  TEST_DATA("wxyz", Entries[0].Data, Entries[0].Size);
+
+  uint8_t LCR = 0x00;
+  TEST_CHECK((Trace.LCRknown & 0x1) == 0);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartReadRegister(&UART, RegSC16IS7XX_LCR, &LCR));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_PollTransfer(&UART));
+  TEST_CHECK((Trace.LCRknown & 0x1) > 0);
+  TEST_EQUAL(LCR, Trace.LastLCR[SC16IS7XX_CHANNEL_A]);
+}
+
+
+//=============================================================================
+// A failed completion is given to the callback, and a failed read is not recorded
+//=============================================================================
+static void Test_FailedCompletion(void)
+{
+  uint8_t Data[2] = { 'a', 'b' }, Value;
+  Test_Init(true);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartTransmitBurst(&UART, &Data[0], sizeof(Data)));
+  TEST_EQUAL(1, Trace.TotalCount);                                      // A write is recorded at its start
+  TEST_EQUAL(SC16IS7XX_TRACE_NON_BLOCKING, Entries[0].Flags & (SC16IS7XX_TRACE_READ | SC16IS7XX_TRACE_NON_BLOCKING));
+  Fake.FailTransfer = 1;
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, SC16IS7XX_PollTransfer(&UART));
+  TEST_EQUAL(1, CompleteCount);
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, CompleteResult);
+  TEST_CHECK(UART.TransferInProgress == false);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartReadRegister(&UART, RegSC16IS7XX_SPR, &Value));
+  Fake.FailTransfer = 1;
+  TEST_EQUAL(ERR__SPI_COMM_ERROR, SC16IS7XX_PollTransfer(&UART));
+  TEST_EQUAL(2, CompleteCount);
+  TEST_EQUAL(1, Trace.TotalCount);
+}
+
+
+//=============================================================================
+// With a blocking interface, the transfer is complete at its start
+//=============================================================================
+static void Test_BlockingInterface(void)
+{
+  uint8_t Value = 0x00;
+  Test_Init(false);
+  Fake_SetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_SPR, 0xA5);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartReadRegister(&UART, RegSC16IS7XX_SPR, &Value));
+  TEST_CHECK(UART.TransferInProgress == false);
+  TEST_EQUAL(1, CompleteCount);
+  TEST_EQUAL(ERR_OK, CompleteResult);
+  TEST_EQUAL(0xA5, Value);
+  TEST_EQUAL(1, Trace.TotalCount);
+  TEST_EQUAL(SC16IS7XX_TRACE_READ, Entries[0].Flags & (SC16IS7XX_TRACE_READ | SC16IS7XX_TRACE_NON_BLOCKING));
+  TEST_EQUAL(0xA5, Entries[0].Data[0]);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_PollTransfer(&UART));
+  TEST_EQUAL(1, CompleteCount);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_ReadCompletion();
+  Test_ReceiveBurstCompletion();
+  Test_FailedCompletion();
+  Test_BlockingInterface();
+  return TEST_RESULT("TestNonBlocking");
+}
@@ -0,0 +1,118 @@
+/*!*****************************************************************************
+ * @file    TestPoller.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the UART poller (SC16IS7XX_USE_BUFFERS)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static uint8_t RxData[32]; // Rx buffer of the UART
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Initialize a UART with a Rx buffer and a poller of this UART
+//=============================================================================
+static void Test_InitPoller(SC16IS7XX *pComp, SC16IS7XX_UART *pUART, SC16IS7XX_UART **pUARTs, SC16IS7XX_Poller *pPoller, setSC16IS7XX_DriverConfig driverConfig)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(pComp));
+  memset(pUART, 0, sizeof(*pUART));
+  pUART->Device       = pComp;
+  pUART->Channel      = SC16IS7XX_CHANNEL_A;
+  pUART->DriverConfig = driverConfig;
+  pUART->RxBuffer.pData      = &RxData[0];
+  pUART->RxBuffer.BufferSize = sizeof(RxData);
+  Fake_DefaultUARTconfig(&Config);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(pUART, &Config));
+  pUARTs[0] = pUART;
+  memset(pPoller, 0, sizeof(*pPoller));
+  pPoller->pUARTs    = pUARTs;
+  pPoller->UARTcount = 1;
+}
+
+
+//=============================================================================
+// The poll interval limits are checked, and 0 is no limit
+//=============================================================================
+static void Test_IntervalLimits(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART, *pUARTs[1];
+  SC16IS7XX_Poller Poller;
+  Test_InitPoller(&Device, &UART, pUARTs, &Poller, SC16IS7XX_DRIVER_BURST_RX);
+
+  Poller.MinIntervalus = 200;
+  Poller.MaxIntervalus = 100;
+  TEST_EQUAL(ERR__CONFIGURATION, SC16IS7XX_PollUARTs(&Poller));
+
+  Poller.MinIntervalus = 0;
+  Poller.MaxIntervalus = 0;                                             // No maximum, the interval is doubled without traffic
+  Poller.Intervalus    = 1000;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_PollUARTs(&Poller));
+  TEST_EQUAL(2000, Poller.Intervalus);
+
+  Poller.MaxIntervalus = 3000;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_PollUARTs(&Poller));
+  TEST_EQUAL(3000, Poller.Intervalus);
+}
+
+
+//=============================================================================
+// With SC16IS7XX_DRIVER_SAFE_RX, the poller reports the receive errors
+//=============================================================================
+static void Test_SafeRxError(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART, *pUARTs[1];
+  SC16IS7XX_Poller Poller;
+  Test_InitPoller(&Device, &UART, pUARTs, &Poller, SC16IS7XX_DRIVER_SAFE_RX);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"ab", 2);
+  Fake_SetRxError(SC16IS7XX_CHANNEL_A, SC16IS7XX_LSR_PARITY_ERROR);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"cd", 2);
+
+  TEST_EQUAL(ERR__RECEIVE_ERROR, SC16IS7XX_PollUARTs(&Poller));
+  TEST_CHECK((UART.RxErrors & SC16IS7XX_PARITY_ERROR) > 0);
+  TEST_EQUAL(2, UART.RxBuffer.PosIn - UART.RxBuffer.PosOut);            // The erroneous char is the last one of the Rx buffer
+  TEST_EQUAL(ERR_OK, SC16IS7XX_PollUARTs(&Poller));                     // The next pass continues the drain
+  TEST_DATA("abcd", UART.RxBuffer.pData, UART.RxBuffer.PosIn - UART.RxBuffer.PosOut);
+}
+
+
+
+//=============================================================================
+// An UART with SC16IS7XX_DRIVER_IRQ_SERVICE is rejected without access to its FIFOs
+//=============================================================================
+static void Test_IRQserviceRejected(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART, *pUARTs[1];
+  SC16IS7XX_Poller Poller;
+  Test_InitPoller(&Device, &UART, pUARTs, &Poller, SC16IS7XX_DRIVER_BURST_RX);
+  UART.DriverConfig |= SC16IS7XX_DRIVER_IRQ_SERVICE;                    // The Rx FIFO is drained by SC16IS7XX_ServiceInterrupt() only
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"ab", 2);
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR__CONFIGURATION, SC16IS7XX_PollUARTs(&Poller));
+  TEST_EQUAL(0, Fake.AccessCount);
+  TEST_EQUAL(0, UART.RxBuffer.PosIn - UART.RxBuffer.PosOut);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_IntervalLimits();
+  Test_SafeRxError();
+  Test_IRQserviceRejected();
+  return TEST_RESULT("TestPoller");
+}
@@ -0,0 +1,99 @@
+/*!*****************************************************************************
+ * @file    TestPrintf.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of SC16IS7XX_Printf() against the snprintf() of the host (SC16IS7XX_USE_BUFFERS)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <stdarg.h>
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static SC16IS7XX Device;
+static SC16IS7XX_UART UART;
+static uint8_t TxData[128]; // Tx buffer of the UART
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Format with SC16IS7XX_VPrintf() and vsnprintf(), then compare the outputs
+//=============================================================================
+static void Test_Format(int line, const char *format, ...)
+{
+  char Expected[FAKE_FIFO_SIZE];
+  uint8_t Sent[FAKE_FIFO_SIZE];
+  va_list Args, ArgsCopy;
+  va_start(Args, format);
+  va_copy(ArgsCopy, Args);
+  vsnprintf(&Expected[0], sizeof(Expected), format, Args);
+  const eERRORRESULT Error = SC16IS7XX_VPrintf(&UART, format, ArgsCopy);
+  va_end(ArgsCopy);
+  va_end(Args);
+  const size_t Size = Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent));
+  if ((Error != ERR_OK) || (strlen(Expected) != Size) || (memcmp(&Expected[0], &Sent[0], Size) != 0))
+  {
+    printf("%s:%d: format \"%s\" failed: \"%s\" != \"%.*s\" (error %d)\n", __FILE__, line, format, Expected, (int)Size, (const char*)&Sent[0], (int)Error);
+    TestFailures++;
+  }
+}
+
+
+//=============================================================================
+// The conversions give the same output as snprintf()
+//=============================================================================
+static void Test_FormatMatrix(void)
+{
+  Test_Format(__LINE__, "%hhd", 300);
+  Test_Format(__LINE__, "%hhu|%hhx", 300, -1);
+  Test_Format(__LINE__, "%hd", 70000);
+  Test_Format(__LINE__, "%hx|%hX", (int16_t)-2, (int16_t)-32768);
+  Test_Format(__LINE__, "%hu|%hi", 65537, 32768);
+  Test_Format(__LINE__, "%#.0o|%#o|%#.0x|%.0d", 0, 0, 0, 0);
+  Test_Format(__LINE__, "%#o|%#.5o|%#05o|%#x|%#X", 8, 8, 8, 255, 255);
+  Test_Format(__LINE__, "%d|%i|%+d|% d|%-5d|%05d|%5.3d", -12, 34, 5, 6, 7, -8, 9);
+  Test_Format(__LINE__, "%ld|%lu|%lld|%llx", -123456789L, 123456789UL, -1234567890123LL, 0xFEDCBA9876ULL);
+  Test_Format(__LINE__, "%c|%3c|%-3c|", 'a', 'b', 'c');
+  Test_Format(__LINE__, "%s|%.2s|%5s|%-5s|%*s|%.*s", "abc", "abc", "ab", "ab", 4, "x", 1, "yz");
+  Test_Format(__LINE__, "%*d|%-*d|%%", -4, 1, 3, 2);
+}
+
+
+//=============================================================================
+// The length modifiers and the conversions without support stop the output with a parameter error
+//=============================================================================
+static void Test_UnsupportedLength(void)
+{
+  static const char* const FORMATS[] = { "ab%jd", "ab%zu", "ab%td", "ab%Lf", "ab%n|%d", "ab%f|%d", "ab%e|%d", "ab%G|%d", "ab%a|%d", "ab%q|%d" };
+  uint8_t Sent[8];
+  for (size_t z = 0; z < (sizeof(FORMATS) / sizeof(FORMATS[0])); ++z)
+  {
+    TEST_EQUAL(ERR__PARAMETER_ERROR, SC16IS7XX_Printf(&UART, FORMATS[z], NULL, 7));
+    TEST_DATA("ab", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent))); // The chars formatted before the error are sent
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&UART, 0, sizeof(UART));
+  UART.Device  = &Device;
+  UART.Channel = SC16IS7XX_CHANNEL_A;
+  UART.TxBuffer.pData      = &TxData[0];
+  UART.TxBuffer.BufferSize = sizeof(TxData);
+  Fake_DefaultUARTconfig(&Config);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, &Config));
+
+  Test_FormatMatrix();
+  Test_UnsupportedLength();
+  return TEST_RESULT("TestPrintf");
+}
@@ -0,0 +1,159 @@
+/*!*****************************************************************************
+ * @file    TestRegisterScript.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the register scripts (SC16IS7XX_USE_REGISTER_SCRIPT)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static uint32_t Ticks;      // Time of Test_TickingClock()
+static uint32_t Sleptus;    // Total time slept by Test_Sleep()
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Clock that advances 1ms at each call, and sleep that advances the fake clock
+//=============================================================================
+static uint32_t Test_TickingClock(void)
+{
+  return ++Ticks;
+}
+
+static void Test_Sleep(SC16IS7XX *pComp, uint32_t durationus)
+{
+  Sleptus += durationus;
+  Fake.Currentms += durationus / 1000u;
+}
+
+
+//=============================================================================
+// A recorded UART initialization replayed after a device reset gives the same registers
+//=============================================================================
+static void Test_RecordAndReplay(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  SC16IS7XX_UARTconfig Config;
+  SC16IS7XX_ScriptStep Steps[64];
+  SC16IS7XX_Script Script = { &Steps[0], sizeof(Steps) / sizeof(Steps[0]), 0 };
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&UART, 0, sizeof(UART));
+  UART.Device  = &Device;
+  UART.Channel = SC16IS7XX_CHANNEL_B;
+  Fake_DefaultUARTconfig(&Config);
+  Config.UARTparity = SC16IS7XX_EVEN_PARITY;
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartScriptRecording(&Device, &Script));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, &Config));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StopScriptRecording(&Device));
+  TEST_CHECK(Script.StepCount > 0);
+  const uint8_t LCR = Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_GENERAL, RegSC16IS7XX_LCR);
+  const uint8_t DLL = Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_SPECIAL, RegSC16IS7XX_DLL);
+  const uint8_t EFR = Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_ENHANCED, RegSC16IS7XX_EFR);
+
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));                         // Device reset
+  TEST_CHECK(Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_SPECIAL, RegSC16IS7XX_DLL) != DLL);
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ExecuteScript(&Device, &Steps[0], Script.StepCount));
+  TEST_EQUAL(Script.StepCount, Fake.AccessCount);                       // Only the writes are replayed
+  TEST_EQUAL(LCR, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_GENERAL, RegSC16IS7XX_LCR));
+  TEST_EQUAL(DLL, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_SPECIAL, RegSC16IS7XX_DLL));
+  TEST_EQUAL(EFR, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_ENHANCED, RegSC16IS7XX_EFR));
+}
+
+
+//=============================================================================
+// A recording with too many writes for the script reports the overflow
+//=============================================================================
+static void Test_RecordOverflow(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_ScriptStep Steps[2];
+  SC16IS7XX_Script Script = { &Steps[0], 2, 0 };
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_StartScriptRecording(&Device, &Script));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x11));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_B, RegSC16IS7XX_SPR, 0x22));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x33));
+  TEST_EQUAL(ERR__BUFFER_FULL, SC16IS7XX_StopScriptRecording(&Device));
+  TEST_EQUAL(3, Script.StepCount);
+  TEST_EQUAL(SC16IS7XX_CHANNEL_B, SC16IS7XX_CHANNEL_GET(Steps[1].Command));
+  TEST_EQUAL(0x22, Steps[1].Value);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x44)); // Not recorded anymore
+  TEST_EQUAL(3, Script.StepCount);
+}
+
+
+//=============================================================================
+// The register access of each channel is restored with its own original LCR
+//=============================================================================
+static void Test_AccessAcrossChannels(void)
+{
+  SC16IS7XX Device;
+  const SC16IS7XX_ScriptStep Steps[] =
+  {
+    SC16IS7XX_SCRIPT_SET_ACCESS_STEP(SC16IS7XX_CHANNEL_A, SC16IS7XX_LCR_VALUE_SET_SPECIAL_REGISTER),
+    SC16IS7XX_SCRIPT_SET_ACCESS_STEP(SC16IS7XX_CHANNEL_B, SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER),
+    SC16IS7XX_SCRIPT_WRITE_STEP(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_DLL, 0x08),
+    SC16IS7XX_SCRIPT_RESTORE_ACCESS_STEP(SC16IS7XX_CHANNEL_A),
+    SC16IS7XX_SCRIPT_WRITE_STEP(SC16IS7XX_CHANNEL_B, RegSC16IS7XX_XON1, 0x11),
+    SC16IS7XX_SCRIPT_RESTORE_ACCESS_STEP(SC16IS7XX_CHANNEL_B),
+  };
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0x03));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_B, RegSC16IS7XX_LCR, 0x1B));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ExecuteScript(&Device, &Steps[0], sizeof(Steps) / sizeof(Steps[0])));
+  TEST_EQUAL(0x03, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_LCR));
+  TEST_EQUAL(0x1B, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_GENERAL, RegSC16IS7XX_LCR));
+  TEST_EQUAL(0x08, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_SPECIAL, RegSC16IS7XX_DLL));
+  TEST_EQUAL(0x11, Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK_ENHANCED, RegSC16IS7XX_XON1));
+}
+
+
+//=============================================================================
+// The delay step waits at least the delay, with or without the fnSleep function
+//=============================================================================
+static void Test_Delay(void)
+{
+  SC16IS7XX Device;
+  const SC16IS7XX_ScriptStep Steps[] = { SC16IS7XX_SCRIPT_DELAY_STEP(5) };
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+
+  Device.fnGetCurrentms = Test_TickingClock;                            // Polling
+  Ticks = 0;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ExecuteScript(&Device, &Steps[0], 1));
+  TEST_EQUAL(1 + 6, Ticks);                                             // Started at 1, ended at more than 5ms after
+
+  Device.fnGetCurrentms = Fake_GetCurrentms;                            // Sleep
+  Device.fnSleep        = Test_Sleep;
+  Fake.Currentms = 100;
+  Sleptus        = 0;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ExecuteScript(&Device, &Steps[0], 1));
+  TEST_EQUAL(6000, Sleptus);
+  TEST_EQUAL(106, Fake.Currentms);
+
+  Device.fnGetCurrentms = NULL;
+  TEST_EQUAL(ERR__PARAMETER_ERROR, SC16IS7XX_ExecuteScript(&Device, &Steps[0], 1));
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_RecordAndReplay();
+  Test_RecordOverflow();
+  Test_AccessAcrossChannels();
+  Test_Delay();
+  return TEST_RESULT("TestRegisterScript");
+}
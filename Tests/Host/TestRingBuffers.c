@@ -0,0 +1,258 @@
+/*!*****************************************************************************
+ * @file    TestRingBuffers.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the Tx/Rx ring buffers (SC16IS7XX_USE_BUFFERS), built with and without SC16IS7XX_USE_POW2_BUFFERS
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+#define RING_SIZE  ( 16 )
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+#  define RING_CAPACITY  ( RING_SIZE )     // Free-running positions, the buffer can be completely filled
+#  define TEST_NAME      "TestRingBuffersPow2"
+#else
+#  define RING_CAPACITY  ( RING_SIZE - 1 ) // One byte is always left free
+#  define TEST_NAME      "TestRingBuffers"
+#endif
+
+static uint8_t TxData[RING_SIZE]; // Tx buffer of the UART
+static uint8_t RxData[RING_SIZE]; // Rx buffer of the UART
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Initialize a UART with the Tx and Rx buffers
+//=============================================================================
+static void Test_InitUART(SC16IS7XX *pComp, SC16IS7XX_UART *pUART, setSC16IS7XX_DriverConfig driverConfig, setSC16IS7XX_Interrupts interrupts)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(pComp));
+  memset(pUART, 0, sizeof(*pUART));
+  pUART->Device       = pComp;
+  pUART->Channel      = SC16IS7XX_CHANNEL_A;
+  pUART->DriverConfig = driverConfig;
+  pUART->TxBuffer.pData      = &TxData[0];
+  pUART->TxBuffer.BufferSize = sizeof(TxData);
+  pUART->RxBuffer.pData      = &RxData[0];
+  pUART->RxBuffer.BufferSize = sizeof(RxData);
+  Fake_DefaultUARTconfig(&Config);
+  Config.Interrupts = interrupts;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(pUART, &Config));
+}
+
+
+//=============================================================================
+// Peek all the data of the Rx buffer and compare them to a string
+//=============================================================================
+static void Test_CheckRxBuffer(SC16IS7XX_UART *pUART, const char *expected, bool expectWrap)
+{
+  uint8_t *pData1, *pData2, Data[RING_SIZE];
+  size_t Size1, Size2;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxPeek(pUART, &pData1, &Size1, &pData2, &Size2));
+  TEST_CHECK(expectWrap == (Size2 > 0));
+  TEST_CHECK((Size1 + Size2) <= sizeof(Data));
+  if ((Size1 + Size2) > sizeof(Data)) return;
+  memcpy(&Data[0], pData1, Size1);
+  memcpy(&Data[Size1], pData2, Size2);
+  TEST_DATA(expected, Data, Size1 + Size2);
+}
+
+
+//=============================================================================
+// An empty Rx buffer gives no data
+//=============================================================================
+static void Test_RxEmpty(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint8_t Data[4];
+  size_t Size;
+  setSC16IS7XX_ReceiveError LastError;
+  Test_InitUART(&Device, &UART, SC16IS7XX_DRIVER_BURST_RX, SC16IS7XX_NO_INTERRUPT);
+  Test_CheckRxBuffer(&UART, "", false);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxConsume(&UART, 0));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReceiveData(&UART, &Data[0], sizeof(Data), &Size, &LastError));
+  TEST_EQUAL(0, Size);
+}
+
+
+//=============================================================================
+// A full Rx buffer keeps the remaining data in the Rx FIFO, then the data wrap
+//=============================================================================
+static void Test_RxFullAndWrap(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint8_t RxLevel;
+  Test_InitUART(&Device, &UART, SC16IS7XX_DRIVER_BURST_RX, SC16IS7XX_NO_INTERRUPT);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"ABCDEFGHIJKLMNOPQRSTUVWXYZ", 26);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));
+  TEST_EQUAL(RING_CAPACITY, UART.RxBuffer.PosIn - UART.RxBuffer.PosOut);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetDataCountRxFIFO(&UART, &RxLevel));
+  TEST_EQUAL(26 - RING_CAPACITY, RxLevel);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));        // Full, nothing more is received
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetDataCountRxFIFO(&UART, &RxLevel));
+  TEST_EQUAL(26 - RING_CAPACITY, RxLevel);
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+  Test_CheckRxBuffer(&UART, "ABCDEFGHIJKLMNOP", false);
+#else
+  Test_CheckRxBuffer(&UART, "ABCDEFGHIJKLMNO", false);
+#endif
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxConsume(&UART, 10));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));        // The data wrap at the end of the buffer
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+  Test_CheckRxBuffer(&UART, "KLMNOPQRSTUVWXYZ", true);
+#else
+  Test_CheckRxBuffer(&UART, "KLMNOPQRSTUVWXY", true);
+#endif
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxConsume(&UART, RING_CAPACITY));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+  Test_CheckRxBuffer(&UART, "", false);
+#else
+  Test_CheckRxBuffer(&UART, "Z", false);
+#endif
+}
+
+
+//=============================================================================
+// A full Tx buffer refuses the reservations, then the reservations wrap
+//=============================================================================
+static void Test_TxFullAndWrap(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint8_t *pData, Sent[2 * RING_SIZE];
+  size_t Size;
+  Test_InitUART(&Device, &UART, SC16IS7XX_DRIVER_BURST_TX, SC16IS7XX_NO_INTERRUPT);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TxReserve(&UART, 10, &pData, &Size));
+  TEST_EQUAL(10, Size);
+  memcpy(pData, "0123456789", 10);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TxCommit(&UART, 10));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_FlushTxBufferToFIFO(&UART));
+  TEST_DATA("0123456789", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+  TEST_EQUAL(UART.TxBuffer.PosIn, UART.TxBuffer.PosOut);               // Empty
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TxReserve(&UART, RING_SIZE, &pData, &Size));
+  TEST_EQUAL(RING_SIZE - 10, Size);                                    // Contiguous space up to the end of the buffer
+  memcpy(pData, "abcdef", Size);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TxCommit(&UART, Size));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TxReserve(&UART, RING_SIZE, &pData, &Size)); // The reservation wraps to the start of the buffer
+  TEST_EQUAL(RING_CAPACITY - (RING_SIZE - 10), Size);
+  TEST_CHECK(pData == &TxData[0]);
+  memcpy(pData, "ghijklmnop", Size);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TxCommit(&UART, Size));
+  TEST_EQUAL(ERR__BUFFER_FULL, SC16IS7XX_TxReserve(&UART, 1, &pData, &Size));
+  TEST_EQUAL(0, Size);
+  TEST_EQUAL(ERR__OUT_OF_RANGE, SC16IS7XX_TxCommit(&UART, 1));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_FlushTxBufferToFIFO(&UART));
+#ifdef SC16IS7XX_USE_POW2_BUFFERS
+  TEST_DATA("abcdefghijklmnop", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+#else
+  TEST_DATA("abcdefghijklmno", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+#endif
+  TEST_EQUAL(UART.TxBuffer.PosIn, UART.TxBuffer.PosOut);               // Empty
+}
+
+
+//=============================================================================
+// A line longer than the Rx buffer is returned as a fragment, then its continuation
+//=============================================================================
+static void Test_ReceiveUntilLongLine(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint8_t Frame[32];
+  size_t Size;
+  Test_InitUART(&Device, &UART, SC16IS7XX_DRIVER_BURST_RX, SC16IS7XX_NO_INTERRUPT);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"line two is a bit longer\n", 25);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));
+  TEST_EQUAL(ERR__BUFFER_FULL, SC16IS7XX_ReceiveUntil(&UART, "\n", &Frame[0], sizeof(Frame), &Size)); // Fragment
+  TEST_EQUAL(RING_CAPACITY, Size);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReceiveUntil(&UART, "\n", &Frame[Size], sizeof(Frame) - Size, &Size)); // Continuation up to the delimiter
+  TEST_DATA("line two is a bit longer\n", Frame, RING_CAPACITY + Size);
+}
+
+
+//=============================================================================
+// A scan of ReceiveUntil() is restarted by a consume, even when the Out position comes back to the same value
+//=============================================================================
+static void Test_ReceiveUntilAfterConsume(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint8_t Frame[RING_SIZE];
+  size_t Size;
+  Test_InitUART(&Device, &UART, SC16IS7XX_DRIVER_BURST_RX, SC16IS7XX_NO_INTERRUPT);
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"abc", 3);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReceiveUntil(&UART, "\n", &Frame[0], sizeof(Frame), &Size)); // "abc" scanned, no delimiter
+  TEST_EQUAL(0, Size);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxConsume(&UART, 3));
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"0123456789ABC", RING_SIZE - 3);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxConsume(&UART, RING_SIZE - 3));       // RING_SIZE data consumed, the Out position is back at the same index
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"x\nyz", 4);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReceiveUntil(&UART, "\n", &Frame[0], sizeof(Frame), &Size));
+  TEST_DATA("x\n", Frame, Size);
+}
+
+
+//=============================================================================
+// With SC16IS7XX_DRIVER_IRQ_SERVICE, only the interrupt service accesses the FIFOs
+//=============================================================================
+static void Test_InterruptServiceMode(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint8_t Data[8], RxLevel;
+  size_t Size;
+  setSC16IS7XX_ReceiveError LastError;
+  Test_InitUART(&Device, &UART, SC16IS7XX_DRIVER_IRQ_SERVICE, SC16IS7XX_TX_FIFO_INTERRUPT);
+  TEST_EQUAL(ERR__NOT_AVAILABLE, SC16IS7XX_FlushTxBufferToFIFO(&UART));
+  TEST_EQUAL(ERR__NOT_AVAILABLE, SC16IS7XX_RetrieveRxFIFOtoBuffer(&UART));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ServiceInterrupt(&UART));              // THR interrupt with nothing to send, it is masked
+  TEST_EQUAL(0x00, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_IER) & SC16IS7XX_IER_THR_INTERRUPT_ENABLE);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, (uint8_t*)"hello", 5, &Size));
+  TEST_EQUAL(5, Size);
+  TEST_EQUAL(0, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Data[0], sizeof(Data))); // Not sent to the Tx FIFO by the application
+  TEST_EQUAL(SC16IS7XX_IER_THR_INTERRUPT_ENABLE, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_IER) & SC16IS7XX_IER_THR_INTERRUPT_ENABLE);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ServiceInterrupt(&UART));              // The THR interrupt sends the Tx buffer
+  TEST_DATA("hello", Data, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Data[0], sizeof(Data)));
+
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"xy", 2);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReceiveData(&UART, &Data[0], sizeof(Data), &Size, &LastError));
+  TEST_EQUAL(0, Size);                                                // Only from the Rx buffer
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetDataCountRxFIFO(&UART, &RxLevel));
+  TEST_EQUAL(2, RxLevel);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_RxEmpty();
+  Test_RxFullAndWrap();
+  Test_TxFullAndWrap();
+  Test_ReceiveUntilLongLine();
+  Test_ReceiveUntilAfterConsume();
+  Test_InterruptServiceMode();
+  return TEST_RESULT(TEST_NAME);
+}
@@ -0,0 +1,104 @@
+/*!*****************************************************************************
+ * @file    TestRxTimestamps.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the Rx timestamps (SC16IS7XX_USE_BUFFERS and SC16IS7XX_USE_RX_TIMESTAMPS)
+ * @details The driver is built with a SC16IS7XX_MEMORY_BARRIER() that calls
+ * Test_Barrier(), which plays the consumer at each barrier of the producer
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static uint8_t RxData[16];                 // Rx buffer of the UART, holds 15 bytes
+static SC16IS7XX_RxTimestamp RxStamps[4];  // Timestamps ring of the UART, holds 3 timestamps
+static SC16IS7XX_UART *pConsumerUART;      // UART checked by Test_Barrier(). NULL to not check
+static bool InConsumer;                    // Indicate that Test_Barrier() is checking the UART
+static unsigned ConsumerChecks;            // Count of consumer checks done by Test_Barrier()
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Memory barrier of the driver: each data visible in the Rx buffer has a timestamp
+//=============================================================================
+void Test_Barrier(void)
+{
+  if ((pConsumerUART == NULL) || InConsumer) return;
+  InConsumer = true;
+  uint8_t *pData1, *pData2;
+  size_t Size1, Size2;
+  uint32_t Timems;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxPeek(pConsumerUART, &pData1, &Size1, &pData2, &Size2));
+  for (size_t z = 0; z < (Size1 + Size2); ++z)
+    TEST_EQUAL(ERR_OK, SC16IS7XX_GetRxTimestamp(pConsumerUART, z, &Timems));
+  ConsumerChecks++;
+  InConsumer = false;
+}
+
+
+//=============================================================================
+// Initialize a UART with a Rx buffer, a timestamps ring and the Rx interrupts
+//=============================================================================
+static void Test_InitUART(SC16IS7XX *pComp, SC16IS7XX_UART *pUART)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(pComp));
+  memset(pUART, 0, sizeof(*pUART));
+  pUART->Device       = pComp;
+  pUART->Channel      = SC16IS7XX_CHANNEL_A;
+  pUART->DriverConfig = SC16IS7XX_DRIVER_BURST_RX;
+  pUART->RxBuffer.pData      = &RxData[0];
+  pUART->RxBuffer.BufferSize = sizeof(RxData);
+  pUART->RxTimestamps.pStamps    = &RxStamps[0];
+  pUART->RxTimestamps.StampCount = sizeof(RxStamps) / sizeof(RxStamps[0]);
+  Fake_DefaultUARTconfig(&Config);
+  Config.Interrupts = SC16IS7XX_RX_FIFO_INTERRUPT | SC16IS7XX_RX_LINE_INTERRUPT;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(pUART, &Config));
+}
+
+
+//=============================================================================
+// The consumer never sees data without their timestamp, also across the Rx buffer wrap
+//=============================================================================
+static void Test_TimestampBeforePublication(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  uint32_t Timems;
+  Test_InitUART(&Device, &UART);
+  pConsumerUART  = &UART;
+  ConsumerChecks = 0;
+
+  Fake.Currentms = 100;
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"abcdefghij", 10);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ServiceInterrupt(&UART));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_RxConsume(&UART, 8));
+  Fake.Currentms = 200;
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"klmnopqrst", 10);  // Stored in two parts across the wrap of the Rx buffer
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ServiceInterrupt(&UART));
+  pConsumerUART = NULL;
+  TEST_CHECK(ConsumerChecks > 0);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetRxTimestamp(&UART, 0, &Timems));     // 'i'
+  TEST_EQUAL(100, Timems);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetRxTimestamp(&UART, 2, &Timems));     // 'k'
+  TEST_EQUAL(200, Timems);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetRxTimestamp(&UART, 11, &Timems));    // 't'
+  TEST_EQUAL(200, Timems);
+  TEST_EQUAL(0, UART.RxTimestamps.Dropped);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_TimestampBeforePublication();
+  return TEST_RESULT("TestRxTimestamps");
+}
@@ -0,0 +1,133 @@
+/*!*****************************************************************************
+ * @file    TestSPIsinglePacket.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the single packet SPI accesses (SC16IS7XX_USE_SPI_SINGLE_PACKET)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static SC16IS7XX Device;
+static SC16IS7XX_UART UART;
+static unsigned TransferCount; // Count of fnSPI_Transfer calls
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// SPI transfer that counts the calls
+//=============================================================================
+static eERRORRESULT Test_CountTransfer(SPI_Interface *pIntDev, SPIInterface_Packet* const pPacketDesc)
+{
+  TransferCount++;
+  return FakeSPI.fnSPI_Transfer(pIntDev, pPacketDesc);
+}
+
+
+//=============================================================================
+// Initialize a UART in burst mode with the counting SPI transfer
+//=============================================================================
+static void Test_InitUART(void)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  Device.SPI.fnSPI_Transfer = Test_CountTransfer;
+  memset(&UART, 0, sizeof(UART));
+  UART.Device       = &Device;
+  UART.Channel      = SC16IS7XX_CHANNEL_A;
+  UART.DriverConfig = SC16IS7XX_DRIVER_BURST_TX | SC16IS7XX_DRIVER_BURST_RX;
+  Fake_DefaultUARTconfig(&Config);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, &Config));
+}
+
+
+//=============================================================================
+// A register access is one SPI transfer
+//=============================================================================
+static void Test_RegisterAccess(void)
+{
+  uint8_t Value = 0x00;
+  Test_InitUART();
+
+  TransferCount = 0;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x5A));
+  TEST_EQUAL(1, TransferCount);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, &Value));
+  TEST_EQUAL(2, TransferCount);
+  TEST_EQUAL(0x5A, Value);
+  TEST_CHECK(Fake.IsSelected == false);
+}
+
+
+//=============================================================================
+// A THR burst is one SPI transfer up to the scratch buffer size, else separate address and data transfers
+//=============================================================================
+static void Test_THRburst(void)
+{
+  uint8_t Data[40], Sent[FAKE_FIFO_SIZE];
+  size_t ActuallySent;
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)('a' + (z % 26));
+  Test_InitUART();
+
+  const size_t MaxSingle = SC16IS7XX_SPI_SCRATCH_BUFFER_SIZE - 1;       // The address byte uses one byte of the scratch buffer
+  TransferCount = 0;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, &Data[0], MaxSingle, &ActuallySent));
+  TEST_EQUAL(1 + 1, TransferCount);                                     // TXLVL read, then THR burst
+  TEST_EQUAL(MaxSingle, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+  TEST_CHECK(memcmp(&Data[0], &Sent[0], MaxSingle) == 0);
+
+  TransferCount = 0;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, &Data[0], MaxSingle + 1, &ActuallySent));
+  TEST_EQUAL(1 + 2, TransferCount);                                     // Too large for the scratch buffer
+  TEST_EQUAL(MaxSingle + 1, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+  TEST_CHECK(memcmp(&Data[0], &Sent[0], MaxSingle + 1) == 0);
+
+  TransferCount = 0;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, &Data[0], sizeof(Data), &ActuallySent));
+  TEST_EQUAL(1 + 2, TransferCount);
+  TEST_EQUAL(sizeof(Data), Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+  TEST_CHECK(memcmp(&Data[0], &Sent[0], sizeof(Data)) == 0);
+  TEST_CHECK(Fake.IsSelected == false);
+}
+
+
+//=============================================================================
+// A RHR burst is one SPI transfer up to the scratch buffer size, else separate address and data transfers
+//=============================================================================
+static void Test_RHRburst(void)
+{
+  uint8_t Received[32];
+  size_t ActuallyReceived;
+  setSC16IS7XX_ReceiveError LastError;
+  Test_InitUART();
+
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"abcdefg", 7);
+  TransferCount = 0;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReceiveData(&UART, &Received[0], sizeof(Received), &ActuallyReceived, &LastError));
+  TEST_EQUAL(1 + 1, TransferCount);                                     // RXLVL read, then RHR burst
+  TEST_DATA("abcdefg", Received, ActuallyReceived);
+
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"0123456789ABCDEFGHIJ", 20);
+  TransferCount = 0;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReceiveData(&UART, &Received[0], sizeof(Received), &ActuallyReceived, &LastError));
+  TEST_EQUAL(1 + 2, TransferCount);                                     // Too large for the scratch buffer
+  TEST_DATA("0123456789ABCDEFGHIJ", Received, ActuallyReceived);
+  TEST_CHECK(Fake.IsSelected == false);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_RegisterAccess();
+  Test_THRburst();
+  Test_RHRburst();
+  return TEST_RESULT("TestSPIsinglePacket");
+}
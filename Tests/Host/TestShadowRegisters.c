@@ -0,0 +1,165 @@
+/*!*****************************************************************************
+ * @file    TestShadowRegisters.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the shadow registers (SC16IS7XX_USE_SHADOW_REGISTERS)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+#define SHADOW_VALID(pComp,channel,bank,addr)  ( ((pComp)->Shadow[(channel)].Valid[(bank)] & (1u << (addr))) > 0 )
+
+
+
+//=============================================================================
+// A read-back before a modification is served by the shadow
+//=============================================================================
+static void Test_ModifyUsesShadow(void)
+{
+  SC16IS7XX Device;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_EnableEnhancedFunctions(&Device, SC16IS7XX_CHANNEL_A)); // EFR known, then MCR writes are stored
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0x03));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_MCR, 0x00)); // TCR and TLR disabled, address 7 is SPR
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x5A));
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ModifyRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x01, 0x0F));
+  TEST_EQUAL(0, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, FAKE_BANK_COUNT, true)); // No read-back
+  TEST_EQUAL(0x51, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_SPR));
+}
+
+
+//=============================================================================
+// A write of IER while the enhanced functions are unknown invalidates the shadow IER
+//=============================================================================
+static void Test_WriteWithUnknownEnhancedInvalidates(void)
+{
+  SC16IS7XX Device;
+  uint8_t Value;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, &Value)); // The register set is now known
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_IER, &Value)); // IER = 0x00 is now in the shadow
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_GENERAL, RegSC16IS7XX_IER));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_IER, 0x01)); // EFR not known: the shadow cannot tell the register value
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_GENERAL, RegSC16IS7XX_IER) == false);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ModifyRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_IER, 0x02, 0x02)); // Shall read IER back instead of using the stale 0x00
+  TEST_EQUAL(0x03, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_IER));
+}
+
+
+//=============================================================================
+// A write of IER while the enhanced functions are disabled invalidates the shadow IER
+//=============================================================================
+static void Test_WriteWithEnhancedDisabledInvalidates(void)
+{
+  SC16IS7XX Device;
+  uint8_t Value;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0xBF));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_EFR, 0x10)); // Enhanced functions enabled
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0x03));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_IER, 0x11)); // IER[4] written and stored
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_GENERAL, RegSC16IS7XX_IER));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0xBF));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_EFR, 0x00)); // Enhanced functions disabled
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0x03));
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_IER, 0x01)); // IER[4] is kept by the device
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_GENERAL, RegSC16IS7XX_IER) == false);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_IER, &Value));
+  TEST_EQUAL(0x11, Value);                                               // The read gives the device value
+}
+
+
+//=============================================================================
+// A write at an address whose bank is unknown invalidates the address in all banks
+//=============================================================================
+static void Test_WriteWithUnknownBankInvalidates(void)
+{
+  SC16IS7XX Device;
+  uint8_t Value;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0xBF));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_EFR, 0x10));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0x03));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_MCR, 0x04)); // TCR and TLR enabled
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_TLR, 0x22));
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_TCR_TLR, RegSC16IS7XX_TLR));
+
+  Device.Shadow[SC16IS7XX_CHANNEL_A].Valid[SC16IS7XX_BANK_GENERAL] &= ~(1u << RegSC16IS7XX_MCR); // MCR not known anymore: address 7 can be SPR or TLR
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_TLR, 0x33));
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_TCR_TLR, RegSC16IS7XX_TLR) == false);
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_GENERAL, RegSC16IS7XX_SPR) == false);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReadRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_MCR, &Value)); // MCR known again
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ModifyRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_TLR, 0x00, 0x0F));
+  TEST_EQUAL(0x30, Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_TCR_TLR, RegSC16IS7XX_TLR)); // Modified from the device value, not from the stale 0x22
+}
+
+
+//=============================================================================
+// A software reset invalidates all the shadow registers
+//=============================================================================
+static void Test_SoftResetInvalidates(void)
+{
+  SC16IS7XX Device;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_EnableEnhancedFunctions(&Device, SC16IS7XX_CHANNEL_A)); // EFR known, then MCR writes are stored
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_LCR, 0x03));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_MCR, 0x00));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WriteRegister(&Device, SC16IS7XX_CHANNEL_A, RegSC16IS7XX_SPR, 0x5A));
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_GENERAL, RegSC16IS7XX_SPR));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_SoftResetDevice(&Device));
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_GENERAL, RegSC16IS7XX_SPR) == false);
+  TEST_CHECK(SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_A, SC16IS7XX_BANK_GENERAL, RegSC16IS7XX_LCR) == false);
+}
+
+
+//=============================================================================
+// A UART initialization keeps the shadow and the device coherent
+//=============================================================================
+static void Test_InitUARTcoherent(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&UART, 0, sizeof(UART));
+  UART.Device  = &Device;
+  UART.Channel = SC16IS7XX_CHANNEL_B;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ConfigureInterrupt(&UART, SC16IS7XX_RX_FIFO_INTERRUPT)); // Before the enhanced functions are enabled
+  Fake_DefaultUARTconfig(&Config);
+  Config.Interrupts = SC16IS7XX_RX_FIFO_INTERRUPT | SC16IS7XX_TX_FIFO_INTERRUPT;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, &Config));
+  for (uint8_t zAddr = 0; zAddr < 16; ++zAddr)                           // Each register known by the shadow shall have the device value
+  {
+    for (uint8_t zBank = 0; zBank < SC16IS7XX_BANK_COUNT; ++zBank)
+    {
+      if (SHADOW_VALID(&Device, SC16IS7XX_CHANNEL_B, zBank, zAddr) == false) continue;
+      if ((zBank == SC16IS7XX_BANK_GENERAL) && ((zAddr == RegSC16IS7XX_FCR) || ((zAddr >= RegSC16IS7XX_IODir) && (zAddr <= RegSC16IS7XX_IOControl)))) continue;
+      static const eFake_Bank FAKE_BANK[SC16IS7XX_BANK_COUNT] = { FAKE_BANK_GENERAL, FAKE_BANK_TCR_TLR, FAKE_BANK_SPECIAL, FAKE_BANK_ENHANCED };
+      TEST_EQUAL(Fake_GetRegister(SC16IS7XX_CHANNEL_B, FAKE_BANK[zBank], zAddr), Device.Shadow[SC16IS7XX_CHANNEL_B].Value[zBank][zAddr]);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_ModifyUsesShadow();
+  Test_WriteWithUnknownEnhancedInvalidates();
+  Test_WriteWithEnhancedDisabledInvalidates();
+  Test_WriteWithUnknownBankInvalidates();
+  Test_SoftResetInvalidates();
+  Test_InitUARTcoherent();
+  return TEST_RESULT("TestShadowRegisters");
+}
@@ -0,0 +1,218 @@
+/*!*****************************************************************************
+ * @file    TestTimeouts.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the timeout and sleep of the blocking functions (fnSleep and BlockingTimeoutms)
+ * @details The sleep function of the tests advances the fake clock, the
+ * blocking functions then time out without a real wait
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+#define TEST_TIMEOUT_MS     10u
+#define TEST_CHAR_TIME_US   87u  // 10 bits at 115200 bauds, rounded up
+
+static SC16IS7XX Device;
+static SC16IS7XX_UART UART;
+static uint32_t Ticks;           // Time of the ticking clock
+static uint32_t Sleptus;         // Total of the sleep durations
+static uint32_t FirstSleepus;    // First sleep duration
+static uint32_t LastSleepus;     // Last sleep duration
+static unsigned SleepCount;      // Count of fnSleep calls
+static unsigned DrainAfterSleep; // Count of sleeps before the Tx FIFO is sent, 0 to never send it
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Sleep that advances the fake clock, and clock that advances 1ms at each call
+//=============================================================================
+static void Test_Sleep(SC16IS7XX *pComp, uint32_t durationus)
+{
+  (void)pComp;
+  if (SleepCount == 0) FirstSleepus = durationus;
+  LastSleepus = durationus;
+  SleepCount++;
+  Sleptus += durationus;
+  Fake.Currentms = 1000u + (Sleptus / 1000u);
+  if ((DrainAfterSleep > 0) && (SleepCount == DrainAfterSleep))
+  {
+    uint8_t Sent[FAKE_FIFO_SIZE];
+    (void)Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent));
+  }
+}
+
+static uint32_t Test_TickingClock(void)
+{
+  return ++Ticks;
+}
+
+
+//=============================================================================
+// Initialize the device with the sleep function and a UART
+//=============================================================================
+static void Test_InitUART(SC16IS7XX_UARTconfig *pConfig)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  Device.fnSleep           = Test_Sleep;
+  Device.BlockingTimeoutms = TEST_TIMEOUT_MS;
+  memset(&UART, 0, sizeof(UART));
+  UART.Device       = &Device;
+  UART.Channel      = SC16IS7XX_CHANNEL_A;
+  UART.DriverConfig = SC16IS7XX_DRIVER_BURST_TX | SC16IS7XX_DRIVER_BURST_RX;
+  if (pConfig == NULL)
+  {
+    Fake_DefaultUARTconfig(&Config);
+    pConfig = &Config;
+  }
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, pConfig));
+  Fake.Currentms  = 1000u;
+  Ticks           = 0;
+  Sleptus         = 0;
+  FirstSleepus    = 0;
+  LastSleepus     = 0;
+  SleepCount      = 0;
+  DrainAfterSleep = 0;
+}
+
+
+//=============================================================================
+// Fill the Tx FIFO of the UART
+//=============================================================================
+static void Test_FillTxFIFO(void)
+{
+  uint8_t Data[FAKE_FIFO_SIZE];
+  size_t ActuallySent;
+  memset(&Data[0], 'x', sizeof(Data));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, &Data[0], sizeof(Data), &ActuallySent));
+  TEST_EQUAL(FAKE_FIFO_SIZE, ActuallySent);
+}
+
+
+//=============================================================================
+// The char time is computed from the UART configuration
+//=============================================================================
+static void Test_CharTime(void)
+{
+  SC16IS7XX_UARTconfig Config;
+  Test_InitUART(NULL);
+  TEST_EQUAL(TEST_CHAR_TIME_US, UART.CharTimeus);
+
+  Fake_DefaultUARTconfig(&Config);
+  Config.UARTwordLen  = SC16IS7XX_DATA_LENGTH_7bits;
+  Config.UARTparity   = SC16IS7XX_EVEN_PARITY;
+  Config.UARTstopBit  = SC16IS7XX_STOP_BIT_2bits;
+  Config.UARTbaudrate = 9600;
+  Test_InitUART(&Config);
+  TEST_EQUAL(1146, UART.CharTimeus);                                    // 11 bits at 9600 bauds, rounded up
+
+  Config.UARTwordLen  = SC16IS7XX_DATA_LENGTH_5bits;
+  Config.UARTparity   = SC16IS7XX_NO_PARITY;
+  Config.UARTstopBit  = SC16IS7XX_STOP_BIT_1bit5;
+  Test_InitUART(&Config);
+  TEST_EQUAL(834, UART.CharTimeus);                                     // 8 bits (1.5 stop bit rounded up) at 9600 bauds, rounded up
+}
+
+
+//=============================================================================
+// SC16IS7XX_TransmitChar() sleeps one char time while the Tx FIFO is full, and times out
+//=============================================================================
+static void Test_TransmitCharTimeout(void)
+{
+  Test_InitUART(NULL);
+  Test_FillTxFIFO();
+
+  TEST_EQUAL(ERR__TIMEOUT, SC16IS7XX_TransmitChar(&UART, 'a'));
+  TEST_CHECK(SleepCount > 0);
+  TEST_EQUAL(TEST_CHAR_TIME_US, FirstSleepus);
+  TEST_EQUAL(TEST_CHAR_TIME_US, LastSleepus);
+  TEST_EQUAL(1000u + TEST_TIMEOUT_MS, Fake.Currentms);                  // Timed out as soon as the timeout elapsed
+  TEST_EQUAL(SleepCount * TEST_CHAR_TIME_US, Sleptus);
+
+  Test_InitUART(NULL);
+  Test_FillTxFIFO();
+  DrainAfterSleep = 3;                                                  // The Tx FIFO is sent during the third sleep
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitChar(&UART, 'a'));
+  TEST_EQUAL(3, SleepCount);
+}
+
+
+//=============================================================================
+// SC16IS7XX_ReceiveChar() sleeps one char time while no char is received, and times out
+//=============================================================================
+static void Test_ReceiveCharTimeout(void)
+{
+  char Data = 0;
+  setSC16IS7XX_ReceiveError CharError;
+  Test_InitUART(NULL);
+
+  TEST_EQUAL(ERR__TIMEOUT, SC16IS7XX_ReceiveChar(&UART, &Data, &CharError));
+  TEST_CHECK(SleepCount > 0);
+  TEST_EQUAL(TEST_CHAR_TIME_US, FirstSleepus);
+  TEST_EQUAL(1000u + TEST_TIMEOUT_MS, Fake.Currentms);
+
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, (const uint8_t*)"r", 1);
+  SleepCount = 0;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ReceiveChar(&UART, &Data, &CharError));
+  TEST_EQUAL('r', Data);
+  TEST_EQUAL(0, SleepCount);                                            // No sleep when a char is available
+}
+
+
+//=============================================================================
+// SC16IS7XX_WaitEndTx() sleeps the time to send the Tx FIFO and the TSR, and times out
+//=============================================================================
+static void Test_WaitEndTxTimeout(void)
+{
+  Test_InitUART(NULL);
+  Test_FillTxFIFO();
+
+  TEST_EQUAL(ERR__TIMEOUT, SC16IS7XX_WaitEndTx(&UART));
+  TEST_EQUAL((FAKE_FIFO_SIZE + 1) * TEST_CHAR_TIME_US, FirstSleepus);  // The Tx FIFO chars and the char in the TSR
+  TEST_CHECK(Fake.Currentms >= 1000u + TEST_TIMEOUT_MS);
+
+  Test_InitUART(NULL);
+  Test_FillTxFIFO();
+  Device.BlockingTimeoutms = 0;                                         // Wait forever
+  DrainAfterSleep = 100;                                                // Far after the timeout of the other tests
+  TEST_EQUAL(ERR_OK, SC16IS7XX_WaitEndTx(&UART));
+  TEST_EQUAL(100, SleepCount);
+}
+
+
+//=============================================================================
+// Without fnSleep, the device is polled continuously until the timeout
+//=============================================================================
+static void Test_PollWithoutSleep(void)
+{
+  Test_InitUART(NULL);
+  Test_FillTxFIFO();
+  Device.fnSleep        = NULL;
+  Device.fnGetCurrentms = Test_TickingClock;
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR__TIMEOUT, SC16IS7XX_TransmitChar(&UART, 'a'));
+  TEST_EQUAL(0, SleepCount);
+  TEST_EQUAL(1 + TEST_TIMEOUT_MS, Ticks);                               // Start time, then one check per poll
+  TEST_EQUAL(TEST_TIMEOUT_MS, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_TXLVL, FAKE_BANK_COUNT, true));
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_CharTime();
+  Test_TransmitCharTimeout();
+  Test_ReceiveCharTimeout();
+  Test_WaitEndTxTimeout();
+  Test_PollWithoutSleep();
+  return TEST_RESULT("TestTimeouts");
+}
@@ -0,0 +1,162 @@
+/*!*****************************************************************************
+ * @file    TestTransmitV.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of SC16IS7XX_TransmitDataV() (SC16IS7XX_USE_BUFFERS)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static SC16IS7XX Device;
+static SC16IS7XX_UART UART;
+static uint8_t TxData[32]; // Tx buffer of the UART, holds 31 bytes
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Initialize a UART with or without a Tx buffer
+//=============================================================================
+static void Test_InitUART(setSC16IS7XX_DriverConfig driverConfig, bool useTxBuffer)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&UART, 0, sizeof(UART));
+  UART.Device       = &Device;
+  UART.Channel      = SC16IS7XX_CHANNEL_A;
+  UART.DriverConfig = driverConfig;
+  if (useTxBuffer)
+  {
+    UART.TxBuffer.pData      = &TxData[0];
+    UART.TxBuffer.BufferSize = sizeof(TxData);
+  }
+  Fake_DefaultUARTconfig(&Config);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, &Config));
+}
+
+
+//=============================================================================
+// The data of all the segments are sent in one THR burst
+//=============================================================================
+static void Test_BurstAcrossSegments(void)
+{
+  const SC16IS7XX_TxSegment Segments[] = { { (const uint8_t*)"head", 4 }, { NULL, 0 }, { (const uint8_t*)"-body-", 6 }, { (const uint8_t*)"tail", 4 } };
+  size_t Index = 0, Offset = 0;
+  uint8_t Sent[FAKE_FIFO_SIZE];
+  Test_InitUART(SC16IS7XX_DRIVER_BURST_TX, false);
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 4, &Index, &Offset));
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_THR, FAKE_BANK_COUNT, false));
+  TEST_EQUAL(4, Index);
+  TEST_EQUAL(0, Offset);
+  TEST_DATA("head-body-tail", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+}
+
+
+//=============================================================================
+// The data that do not fit in the Tx FIFO are sent by the next call
+//=============================================================================
+static void Test_PartialSendResume(void)
+{
+  uint8_t Data1[40], Data2[40], Sent[FAKE_FIFO_SIZE];
+  const SC16IS7XX_TxSegment Segments[] = { { &Data1[0], sizeof(Data1) }, { &Data2[0], sizeof(Data2) } };
+  size_t Index = 0, Offset = 0;
+  memset(&Data1[0], '1', sizeof(Data1));
+  memset(&Data2[0], '2', sizeof(Data2));
+  Test_InitUART(SC16IS7XX_DRIVER_BURST_TX, false);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 2, &Index, &Offset));
+  TEST_EQUAL(1, Index);                                                 // The Tx FIFO is full after 64 chars
+  TEST_EQUAL(FAKE_FIFO_SIZE - sizeof(Data1), Offset);
+  TEST_EQUAL(FAKE_FIFO_SIZE, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 2, &Index, &Offset));
+  TEST_EQUAL(2, Index);
+  TEST_EQUAL(0, Offset);
+  TEST_DATA("2222222222222222", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+}
+
+
+//=============================================================================
+// With SC16IS7XX_DRIVER_SAFE_TX, each char is a THR write
+//=============================================================================
+static void Test_SafeTX(void)
+{
+  const SC16IS7XX_TxSegment Segments[] = { { (const uint8_t*)"ab", 2 }, { (const uint8_t*)"cde", 3 } };
+  size_t Index = 0, Offset = 1;
+  uint8_t Sent[8];
+  Test_InitUART(SC16IS7XX_DRIVER_SAFE_TX, false);
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 2, &Index, &Offset));
+  TEST_EQUAL(4, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_THR, FAKE_BANK_COUNT, false));
+  TEST_EQUAL(2, Index);
+  TEST_DATA("bcde", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+}
+
+
+//=============================================================================
+// With a Tx buffer, the data not sent are kept in the Tx buffer
+//=============================================================================
+static void Test_BufferedMode(void)
+{
+  uint8_t Data[80], Sent[FAKE_FIFO_SIZE];
+  const SC16IS7XX_TxSegment Segments[] = { { &Data[0], 30 }, { &Data[30], 50 } };
+  size_t Index = 0, Offset = 0;
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)('0' + (z % 10));
+  Test_InitUART(SC16IS7XX_DRIVER_BURST_TX, true);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 2, &Index, &Offset));
+  TEST_EQUAL(31, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent))); // The Tx buffer content is sent, then the Tx buffer is filled again
+  TEST_CHECK(memcmp(&Data[0], &Sent[0], 31) == 0);
+  TEST_EQUAL(1, Index);
+  TEST_EQUAL(62 - 30, Offset);
+  TEST_EQUAL(31, (UART.TxBuffer.PosIn + UART.TxBuffer.BufferSize - UART.TxBuffer.PosOut) % UART.TxBuffer.BufferSize); // The Tx buffer is full
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 2, &Index, &Offset));
+  TEST_EQUAL(2, Index);                                                 // All data in the Tx FIFO or the Tx buffer
+  TEST_EQUAL(0, Offset);
+  TEST_EQUAL(ERR_OK, SC16IS7XX_FlushTxBufferToFIFO(&UART));
+  TEST_EQUAL(sizeof(Data) - 31, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+  TEST_CHECK(memcmp(&Data[31], &Sent[0], sizeof(Data) - 31) == 0);
+}
+
+
+//=============================================================================
+// A position out of the segments is rejected
+//=============================================================================
+static void Test_PositionOutOfRange(void)
+{
+  const SC16IS7XX_TxSegment Segments[] = { { (const uint8_t*)"abc", 3 } };
+  size_t Index, Offset;
+  Test_InitUART(SC16IS7XX_DRIVER_BURST_TX, false);
+
+  Fake_ClearLog();
+  Index = 1; Offset = 2;
+  TEST_EQUAL(ERR__OUT_OF_RANGE, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 1, &Index, &Offset));
+  Index = 2; Offset = 0;
+  TEST_EQUAL(ERR__OUT_OF_RANGE, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 1, &Index, &Offset));
+  Index = 0; Offset = 4;
+  TEST_EQUAL(ERR__OUT_OF_RANGE, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 1, &Index, &Offset));
+  TEST_EQUAL(0, Fake.AccessCount);
+  Index = 1; Offset = 0;                                                // All data sent
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitDataV(&UART, &Segments[0], 1, &Index, &Offset));
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_BurstAcrossSegments();
+  Test_PartialSendResume();
+  Test_SafeTX();
+  Test_BufferedMode();
+  Test_PositionOutOfRange();
+  return TEST_RESULT("TestTransmitV");
+}
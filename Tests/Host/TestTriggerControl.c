@@ -0,0 +1,109 @@
+/*!*****************************************************************************
+ * @file    TestTriggerControl.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the adaptive trigger levels (SC16IS7XX_USE_BUFFERS and SC16IS7XX_USE_ADAPTIVE_TRIGGER)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static uint8_t RxData[16]; // Rx buffer of the UART, holds 15 bytes
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Initialize a UART with a Rx buffer, the Rx interrupts and the adaptive trigger levels
+//=============================================================================
+static void Test_InitUART(SC16IS7XX *pComp, SC16IS7XX_UART *pUART, SC16IS7XX_TriggerControl *pControl)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(pComp));
+  memset(pUART, 0, sizeof(*pUART));
+  memset(pControl, 0, sizeof(*pControl));
+  pUART->Device       = pComp;
+  pUART->Channel      = SC16IS7XX_CHANNEL_A;
+  pUART->DriverConfig = SC16IS7XX_DRIVER_BURST_RX;
+  pUART->RxBuffer.pData      = &RxData[0];
+  pUART->RxBuffer.BufferSize = sizeof(RxData);
+  pUART->pTriggerControl     = pControl;
+  Fake_DefaultUARTconfig(&Config);
+  Config.Interrupts = SC16IS7XX_RX_FIFO_INTERRUPT | SC16IS7XX_RX_LINE_INTERRUPT;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(pUART, &Config));
+}
+
+
+//=============================================================================
+// The TCR and TLR access stays enabled and a trigger levels change writes only TLR
+//=============================================================================
+static void Test_TriggerLevelsWriteOnlyTLR(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  SC16IS7XX_TriggerControl Control;
+  Test_InitUART(&Device, &UART, &Control);
+  TEST_CHECK((Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_MCR) & SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE) > 0);
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_SetTriggerLevels(&UART, SC16IS7XX_TX_FIFO_TRIGGER_AT_16_CHAR_SPACE, SC16IS7XX_RX_FIFO_TRIGGER_AT_32_CHAR_AVAILABLE));
+  TEST_EQUAL(1, Fake.AccessCount);
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_TLR, FAKE_BANK_TCR_TLR, false));
+  TEST_EQUAL(16, Control.TxTrigger);
+  TEST_EQUAL(32, Control.RxTrigger);
+}
+
+
+//=============================================================================
+// The control pins status is read from MSR, not from TCR at the same address
+//=============================================================================
+static void Test_ControlPinStatusReadsMSR(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  SC16IS7XX_TriggerControl Control;
+  uint8_t Status;
+  Test_InitUART(&Device, &UART, &Control);
+  Fake_SetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_TCR_TLR, RegSC16IS7XX_TCR, 0xAB);
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_GetControlPinStatus(&UART, &Status));
+  TEST_EQUAL(0x00, Status);                                             // MSR of the fake
+  TEST_EQUAL(0, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_TCR, FAKE_BANK_TCR_TLR, true));
+  TEST_CHECK((Fake_GetRegister(SC16IS7XX_CHANNEL_A, FAKE_BANK_GENERAL, RegSC16IS7XX_MCR) & SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE) > 0);
+}
+
+
+//=============================================================================
+// A service that fills the Rx buffer is accounted by the adaptive trigger levels
+//=============================================================================
+static void Test_FullRxBufferServiceAccounted(void)
+{
+  SC16IS7XX Device;
+  SC16IS7XX_UART UART;
+  SC16IS7XX_TriggerControl Control;
+  uint8_t Data[32];
+  Test_InitUART(&Device, &UART, &Control);
+  memset(&Data[0], 'A', sizeof(Data));
+  Fake_PushRx(SC16IS7XX_CHANNEL_A, &Data[0], sizeof(Data));
+
+  TEST_EQUAL(ERR__BUFFER_FULL, SC16IS7XX_ServiceInterrupt(&UART));
+  TEST_EQUAL(1, Control.ServiceCount);
+  TEST_EQUAL(32, Control.RxBytes);
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_TriggerLevelsWriteOnlyTLR();
+  Test_ControlPinStatusReadsMSR();
+  Test_FullRxBufferServiceAccounted();
+  return TEST_RESULT("TestTriggerControl");
+}
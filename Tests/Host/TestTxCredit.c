@@ -0,0 +1,116 @@
+/*!*****************************************************************************
+ * @file    TestTxCredit.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    16/10/2026
+ * @brief   Host unit tests of the Tx FIFO credit (SC16IS7XX_USE_TX_CREDIT)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#include "FakeSC16IS7XX.h"
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+static SC16IS7XX Device;
+static SC16IS7XX_UART UART;
+static uint8_t TxData[128]; // Tx buffer of the UART
+
+//-----------------------------------------------------------------------------
+
+
+
+//=============================================================================
+// Initialize a UART with or without a Tx buffer
+//=============================================================================
+static void Test_InitUART(bool useTxBuffer, setSC16IS7XX_Interrupts interrupts)
+{
+  SC16IS7XX_UARTconfig Config;
+  TEST_EQUAL(ERR_OK, Fake_InitDevice(&Device));
+  memset(&UART, 0, sizeof(UART));
+  UART.Device       = &Device;
+  UART.Channel      = SC16IS7XX_CHANNEL_A;
+  UART.DriverConfig = SC16IS7XX_DRIVER_BURST_TX;
+  if (useTxBuffer)
+  {
+    UART.TxBuffer.pData      = &TxData[0];
+    UART.TxBuffer.BufferSize = sizeof(TxData);
+  }
+  Fake_DefaultUARTconfig(&Config);
+  Config.Interrupts = interrupts;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_InitUART(&UART, &Config));
+}
+
+
+//=============================================================================
+// A small write costs one bus transaction while the credit is enough
+//=============================================================================
+static void Test_SmallWriteOneTransaction(void)
+{
+  uint8_t Data[FAKE_FIFO_SIZE], Sent[FAKE_FIFO_SIZE];
+  size_t ActuallySent;
+  memset(&Data[0], 'x', sizeof(Data));
+  Test_InitUART(false, SC16IS7XX_NO_INTERRUPT);
+  TEST_EQUAL(0, Device.TxFIFOcredit[SC16IS7XX_CHANNEL_A]);             // No credit after initialization
+
+  unsigned Transactions = Fake.Transactions;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, (uint8_t*)"ab", 2, &ActuallySent));
+  TEST_EQUAL(2, Fake.Transactions - Transactions);                      // TXLVL read, then THR write
+  TEST_EQUAL(FAKE_FIFO_SIZE - 2, Device.TxFIFOcredit[SC16IS7XX_CHANNEL_A]);
+
+  Transactions = Fake.Transactions;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, (uint8_t*)"cd", 2, &ActuallySent));
+  TEST_EQUAL(1, Fake.Transactions - Transactions);                      // THR write only
+  TEST_EQUAL(FAKE_FIFO_SIZE - 4, Device.TxFIFOcredit[SC16IS7XX_CHANNEL_A]);
+  TEST_DATA("abcd", Sent, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+
+  Transactions = Fake.Transactions;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, &Data[0], FAKE_FIFO_SIZE - 4, &ActuallySent));
+  TEST_EQUAL(1, Fake.Transactions - Transactions);                      // The whole credit is used
+  TEST_EQUAL(0, Device.TxFIFOcredit[SC16IS7XX_CHANNEL_A]);
+
+  Transactions = Fake.Transactions;
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, (uint8_t*)"e", 1, &ActuallySent));
+  TEST_EQUAL(2, Fake.Transactions - Transactions);                      // No credit left, TXLVL is read again
+  TEST_EQUAL(1, ActuallySent);
+  TEST_EQUAL(4 - 1, Device.TxFIFOcredit[SC16IS7XX_CHANNEL_A]);         // The space of "abcd" sent, minus the char written
+}
+
+
+//=============================================================================
+// The TXLVL read of the THR interrupt service refreshes the credit
+//=============================================================================
+static void Test_CreditRefreshByInterrupt(void)
+{
+  uint8_t Data[100], Sent[FAKE_FIFO_SIZE];
+  size_t ActuallySent;
+  for (size_t z = 0; z < sizeof(Data); ++z) Data[z] = (uint8_t)('0' + (z % 10));
+  Test_InitUART(true, SC16IS7XX_TX_FIFO_INTERRUPT);
+
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, &Data[0], sizeof(Data), &ActuallySent));
+  TEST_EQUAL(sizeof(Data), ActuallySent);                               // The Tx FIFO is full, the rest is in the Tx buffer
+  TEST_EQUAL(0, Device.TxFIFOcredit[SC16IS7XX_CHANNEL_A]);
+  TEST_EQUAL(FAKE_FIFO_SIZE, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent))); // The Tx FIFO is sent, this gives a THR interrupt
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_ServiceInterrupt(&UART));
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_TXLVL, FAKE_BANK_COUNT, true));
+  TEST_EQUAL(FAKE_FIFO_SIZE - (sizeof(Data) - FAKE_FIFO_SIZE), Device.TxFIFOcredit[SC16IS7XX_CHANNEL_A]); // TXLVL read, minus the chars of the Tx buffer
+  TEST_EQUAL(sizeof(Data) - FAKE_FIFO_SIZE, Fake_DrainTx(SC16IS7XX_CHANNEL_A, &Sent[0], sizeof(Sent)));
+  TEST_CHECK(memcmp(&Data[FAKE_FIFO_SIZE], &Sent[0], sizeof(Data) - FAKE_FIFO_SIZE) == 0);
+
+  Fake_ClearLog();
+  TEST_EQUAL(ERR_OK, SC16IS7XX_TransmitData(&UART, (uint8_t*)"z", 1, &ActuallySent));
+  TEST_EQUAL(0, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_TXLVL, FAKE_BANK_COUNT, true)); // The credit of the interrupt service is used
+  TEST_EQUAL(1, Fake_CountAccesses(SC16IS7XX_CHANNEL_A, RegSC16IS7XX_THR, FAKE_BANK_COUNT, false));
+}
+
+//-----------------------------------------------------------------------------
+
+
+
+int main(void)
+{
+  Test_SmallWriteOneTransaction();
+  Test_CreditRefreshByInterrupt();
+  return TEST_RESULT("TestTxCredit");
+}
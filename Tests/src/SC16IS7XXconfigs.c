@@ -92,6 +92,9 @@ struct SC16IS7XX SC16IS7XX_EXT1 =
   .SPI                 = &SPI0_Interface,
   .InterfaceClockSpeed = 4000000, // SPI speed at 4MHz
 
+  //--- Time call function ---
+  .fnGetCurrentms      = GetCurrentms_V71,
+
   //--- GPIO configuration ---
   .GPIOsOutLevel       = 0, // No GPIO on this device
 };
@@ -129,7 +132,6 @@ struct SC16IS7XX_UART UART_Chan0_EXT1 = // SC16IS7XX UART
     .BufferSize   = 0,
     .PosIn        = 0,     // No need to fill (set a default value)
     .PosOut       = 0,     // No need to fill (set a default value)
-    .IsFull       = false, // No need to fill (set a default value)
   },
   .RxBuffer       =
   {
@@ -137,7 +139,6 @@ struct SC16IS7XX_UART UART_Chan0_EXT1 = // SC16IS7XX UART
     .BufferSize   = 0,
     .PosIn        = 0,     // No need to fill (set a default value)
     .PosOut       = 0,     // No need to fill (set a default value)
-    .IsFull       = false, // No need to fill (set a default value)
   },
 #endif
 };
@@ -206,6 +207,9 @@ struct SC16IS7XX SC16IS7XX_I2C =
   .I2C                 = &I2C0_Interface,
   .InterfaceClockSpeed = 400000, // I2C speed at 400kHz
 
+  //--- Time call function ---
+  .fnGetCurrentms      = GetCurrentms_V71,
+
   //--- GPIO configuration ---
   .GPIOsOutLevel       = 0, // Set all GPIO to 0
 };
@@ -244,7 +248,6 @@ struct SC16IS7XX_UART UART_Chan0_I2C = // SC16IS7XX UART
     .BufferSize   = 0,
     .PosIn        = 0,     // No need to fill (set a default value)
     .PosOut       = 0,     // No need to fill (set a default value)
-    .IsFull       = false, // No need to fill (set a default value)
   },
   .RxBuffer       =
   {
@@ -252,7 +255,6 @@ struct SC16IS7XX_UART UART_Chan0_I2C = // SC16IS7XX UART
     .BufferSize   = 0,
     .PosIn        = 0,     // No need to fill (set a default value)
     .PosOut       = 0,     // No need to fill (set a default value)
-    .IsFull       = false, // No need to fill (set a default value)
   },
 #endif
 };
@@ -321,6 +323,9 @@ struct SC16IS7XX SC16IS7XX_EXT2 =
   .SPI                 = &SPI0_Interface,
   .InterfaceClockSpeed = 4000000, // SPI speed at 4MHz
 
+  //--- Time call function ---
+  .fnGetCurrentms      = GetCurrentms_V71,
+
   //--- GPIO configuration ---
   .GPIOsOutLevel       = 0, // Set all GPIO to 0
 };
@@ -365,7 +370,6 @@ struct SC16IS7XX_UART UART_Chan0_EXT2 = // SC16IS7XX UART
     .BufferSize   = UART0_EXT2_TXBUFFER_SIZE,
     .PosIn        = 0,     // No need to fill (will be changed at UART initialization)
     .PosOut       = 0,     // No need to fill (will be changed at UART initialization)
-    .IsFull       = false, // No need to fill (will be changed at UART initialization)
   },
   .RxBuffer       =
   {
@@ -373,7 +377,6 @@ struct SC16IS7XX_UART UART_Chan0_EXT2 = // SC16IS7XX UART
     .BufferSize   = UART0_EXT2_RXBUFFER_SIZE,
     .PosIn        = 0,     // No need to fill (will be changed at UART initialization)
     .PosOut       = 0,     // No need to fill (will be changed at UART initialization)
-    .IsFull       = false, // No need to fill (will be changed at UART initialization)
   },
 #endif
 };
@@ -415,7 +418,6 @@ struct SC16IS7XX_UART UART_Chan1_EXT2 = // SC16IS7XX UART
     .BufferSize   = UART1_EXT2_TXBUFFER_SIZE,
     .PosIn        = 0,     // No need to fill (will be changed at UART initialization)
     .PosOut       = 0,     // No need to fill (will be changed at UART initialization)
-    .IsFull       = false, // No need to fill (will be changed at UART initialization)
   },
   .RxBuffer       =
   {
@@ -423,7 +425,6 @@ struct SC16IS7XX_UART UART_Chan1_EXT2 = // SC16IS7XX UART
     .BufferSize   = UART1_EXT2_RXBUFFER_SIZE,
     .PosIn        = 0,     // No need to fill (will be changed at UART initialization)
     .PosOut       = 0,     // No need to fill (will be changed at UART initialization)
-    .IsFull       = false, // No need to fill (will be changed at UART initialization)
   },
 #endif
 };
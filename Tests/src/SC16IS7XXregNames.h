@@ -0,0 +1,71 @@
+/*******************************************************************************
+  File name:    SC16IS7XXregNames.h
+  Author:       FMA
+  Version:      1.0
+  Date (d/m/y): 15/10/2026
+  Description:  SC16IS7XX register names tables for the DEMO and the trace
+                decoder (Tools/SC16IS7XXtraceDecoder.c)
+
+  History :
+*******************************************************************************/
+#ifndef SC16IS7XXREGNAMES_H_
+#define SC16IS7XXREGNAMES_H_
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+//-----------------------------------------------------------------------------
+
+//! General register set names (LCR[7] = 0)
+static const char SC16IS7XX_RegGenNames[16][9+1/* \0 */] =
+{
+  "         ",
+  "IER      ",
+  "IIR      ",
+  "LCR      ",
+  "MCR      ",
+  "LSR      ",
+  "MSR      ",
+  "SPR      ",
+  "TXLVL    ",
+  "RXLVL    ",
+  "IODir    ",
+  "IOState  ",
+  "IOIntEna ",
+  "Reserved ",
+  "IOControl",
+  "EFCR     ",
+};
+//! Special register set names (LCR[7] = 1 and LCR != 0xBF)
+static const char SC16IS7XX_RegSpeNames[2][9+1/* \0 */] =
+{
+  "DLL      ",
+  "DLH      ",
+};
+//! Enhanced register set names (LCR = 0xBF)
+static const char SC16IS7XX_RegEnhNames[8][9+1/* \0 */] =
+{
+  "         ",
+  "         ",
+  "EFR      ",
+  "         ",
+  "XON1     ",
+  "XON2     ",
+  "XOFF1    ",
+  "XOFF2    ",
+};
+//! TCR and TLR registers names (LCR[7] = 0, MCR[2] = 1 and EFR[4] = 1)
+static const char SC16IS7XX_RegTxRNames[2][9+1/* \0 */] =
+{
+  "TCR      ",
+  "TLR      ",
+};
+
+//-----------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
+//-----------------------------------------------------------------------------
+#endif /* SC16IS7XXREGNAMES_H_ */
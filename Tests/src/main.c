@@ -18,6 +18,7 @@
 #include "Interface/Console_V71Interface.h"
 #include "SC16IS7XXconfigs.h"
 #include "SC16IS7XX.h"
+#include "SC16IS7XXregNames.h"
 #include "StringTools.h"
 //-----------------------------------------------------------------------------
 
@@ -174,47 +175,6 @@ static bool CheckUARTselected(void)
 //=============================================================================
 // Show registers of the device selected
 //=============================================================================
-const char SC16IS7XX_RegGenNames[16][9+1/* \0 */] =
-{
-  "         ",
-  "IER      ",
-  "IIR      ",
-  "LCR      ",
-  "MCR      ",
-  "LSR      ",
-  "MSR      ",
-  "SPR      ",
-  "TXLVL    ",
-  "RXLVL    ",
-  "IODir    ",
-  "IOState  ",
-  "IOIntEna ",
-  "Reserved ",
-  "IOControl",
-  "EFCR     ",
-};
-const char SC16IS7XX_RegSpeNames[2][9+1/* \0 */] =
-{
-  "DLL      ",
-  "DLH      ",
-};
-const char SC16IS7XX_RegEnhNames[8][9+1/* \0 */] =
-{
-  "         ",
-  "         ",
-  "EFR      ",
-  "         ",
-  "XON1     ",
-  "XON2     ",
-  "XOFF1    ",
-  "XOFF2    ",
-};
-const char SC16IS7XX_RegTxRNames[2][9+1/* \0 */] =
-{
-  "TCR      ",
-  "TLR      ",
-};
-
 static void ShowRegistersUARTSelected(void)
 {
   if (UARTSelected < 0) return;
@@ -411,6 +371,16 @@ static void SC16IS7XX_EXT1_CheckIRQ(SC16IS7XX_UART *pUART)
 #ifdef APP_USE_IRQ_PIN
   if (ioport_get_pin_level(EXT1_PIN_IRQ) != 0) return;             // Check IRQ pin status of the SC16IS7XX (Active low state)
 
+# ifdef SC16IS7XX_USE_BUFFERS
+  Error = SC16IS7XX_ServiceInterrupt(pUART);                       // Drain the Rx FIFO to the Rx buffer, refill the Tx FIFO from the Tx buffer and call fnInterruptEvent for the other sources
+  if (Error == ERR__BUFFER_FULL) return;                           // The Rx interrupts are masked until the Rx buffer is consumed
+  if (Error != ERR_OK) { ShowError(Error); return; }
+  if (pUART->RxErrors != SC16IS7XX_NO_RX_ERROR)                    // Overrun Error, Framing Error, Parity Error, or Break Interrupt errors occur in characters in the Rx FIFO
+  {
+    LOGERROR("Rx errors: 0x%02X", (unsigned int)pUART->RxErrors);
+    pUART->RxErrors = SC16IS7XX_NO_RX_ERROR;
+  }
+# else
   eSC16IS7XX_InterruptSource LastInterruptFlag;
   Error = SC16IS7XX_GetInterruptEvents(pUART, &LastInterruptFlag); // Get UART interrupts
   if (Error != ERR_OK) { ShowError(Error); return; }
@@ -447,6 +417,7 @@ static void SC16IS7XX_EXT1_CheckIRQ(SC16IS7XX_UART *pUART)
       LOGERROR("Unknown IRQ: %u", (unsigned int)LastInterruptFlag);
       break;
   }
+# endif
 #else
   setSC16IS7XX_Status Status = 0;
   Error = SC16IS7XX_GetUARTstatus(UART0_I2C, &Status); // Get the current status
@@ -0,0 +1,221 @@
+/*!*****************************************************************************
+ * @file    SC16IS7XXtraceDecoder.c
+ * @author  Fabien 'Emandhal' MAILLY
+ * @version 1.0.0
+ * @date    15/10/2026
+ * @brief   Host decoder of the SC16IS7XX register access trace
+ * @details Decode a dump of the trace entries got with SC16IS7XX_GetTraceEntries()
+ * (raw little-endian SC16IS7XX_TraceEntry array) into readable register accesses
+ * and print the cost of each call site tag set with SC16IS7XX_SetTraceCallSite()
+ *
+ * Build on the host (from this directory):
+ *   gcc -I.. -I../Tests/src -o SC16IS7XXtraceDecoder SC16IS7XXtraceDecoder.c
+ * Usage:
+ *   SC16IS7XXtraceDecoder <dump file> [data size]
+ * Where [data size] is the SC16IS7XX_TRACE_DATA_SIZE of the firmware (default 4)
+ ******************************************************************************/
+
+//-----------------------------------------------------------------------------
+#ifndef SC16IS7XX_USE_TRACE
+#  define SC16IS7XX_USE_TRACE
+#endif
+#include "SC16IS7XX.h"
+#include "SC16IS7XXregNames.h"
+#include <stdio.h>
+#include <string.h>
+//-----------------------------------------------------------------------------
+
+#define TRACE_HEADER_SIZE  ( offsetof(SC16IS7XX_TraceEntry, Data) ) //!< Size of the entry fields before the data bytes
+#define TRACE_MAX_DATA     ( 255 )                                  //!< Maximum data size of an entry
+#define CALL_SITE_MAX      ( 256 )                                  //!< Maximum count of different call sites in the summary
+
+//! Decoded trace entry
+typedef struct
+{
+  uint32_t Timestamp;
+  uint16_t CallSite;
+  uint8_t Channel;
+  uint8_t Address;
+  uint8_t Flags;
+  uint8_t LCR;
+  uint8_t Size;
+  const uint8_t* pData;
+} TraceAccess;
+
+//! Registers state of a channel, followed along the trace to know when TCR and TLR are accessible
+typedef struct
+{
+  uint8_t MCR, EFR;
+  bool MCRknown, EFRknown;
+} ChannelState;
+
+//! Cost of a call site
+typedef struct
+{
+  uint16_t CallSite;
+  uint32_t Transactions;
+  uint32_t PayloadBytes;
+  uint32_t AccessChanges; //!< Count of LCR writes, each one is a register bank switch
+  uint32_t FirstTimestamp, LastTimestamp;
+} CallSiteCost;
+
+static ChannelState Channels[SC16IS7XX_CHANNEL_COUNT + 2];
+static CallSiteCost CallSites[CALL_SITE_MAX];
+static size_t CallSiteCount = 0;
+
+
+
+//=============================================================================
+// Get the register name of an access following the LCR value of the entry
+//=============================================================================
+static const char* GetRegisterName(const TraceAccess* pAccess, const char** pBank)
+{
+  const ChannelState* pState = &Channels[pAccess->Channel];
+  const uint8_t Addr = pAccess->Address;
+
+  if (Addr == RegSC16IS7XX_LCR) { *pBank = "GEN"; return SC16IS7XX_RegGenNames[Addr]; } // The LCR register is accessible whatever the register set selected
+  if ((pAccess->Flags & SC16IS7XX_TRACE_LCR_KNOWN) == 0)
+  {
+    *pBank = "???";                                                                       // The register set is unknown, show the general register name
+    if (Addr == RegSC16IS7XX_RHR) return ((pAccess->Flags & SC16IS7XX_TRACE_READ) > 0 ? "RHR      " : "THR      ");
+    return SC16IS7XX_RegGenNames[Addr];
+  }
+  //--- Enhanced register set ---
+  if (pAccess->LCR == SC16IS7XX_LCR_VALUE_SET_ENHANCED_FEATURE_REGISTER)
+  {
+    *pBank = "ENH";
+    if ((Addr < 8) && (SC16IS7XX_RegEnhNames[Addr][0] != ' ')) return SC16IS7XX_RegEnhNames[Addr];
+    return "Invalid  ";
+  }
+  //--- Special register set ---
+  if ((pAccess->LCR & SC16IS7XX_LCR_DIVISOR_LATCH_ENABLE) > 0)
+  {
+    *pBank = "SPE";
+    if (Addr <= RegSC16IS7XX_DLH) return SC16IS7XX_RegSpeNames[Addr];
+    return "Invalid  ";
+  }
+  //--- General register set ---
+  *pBank = "GEN";
+  if ((Addr == RegSC16IS7XX_TCR) || (Addr == RegSC16IS7XX_TLR))
+  {
+    if (!pState->MCRknown || !pState->EFRknown) *pBank = "G/T";                           // The TCR and TLR access is unknown
+    else if (((pState->MCR & SC16IS7XX_MCR_TCR_AND_TLR_REGISTER_ENABLE) > 0) && ((pState->EFR & SC16IS7XX_EFR_ENHANCED_FUNCTION_ENABLE) > 0))
+    {
+      *pBank = "TXR";
+      return SC16IS7XX_RegTxRNames[Addr - RegSC16IS7XX_TCR];
+    }
+  }
+  if (Addr == RegSC16IS7XX_RHR) return ((pAccess->Flags & SC16IS7XX_TRACE_READ) > 0 ? "RHR      " : "THR      ");
+  return SC16IS7XX_RegGenNames[Addr];
+}
+
+
+
+//=============================================================================
+// Follow the MCR and EFR values of the channel
+//=============================================================================
+static void UpdateChannelState(const TraceAccess* pAccess, const char* bank)
+{
+  ChannelState* pState = &Channels[pAccess->Channel];
+  if (pAccess->Size == 0) return;
+  const uint8_t Value = pAccess->pData[0];
+
+  if ((pAccess->Address == RegSC16IS7XX_MCR) && (strcmp(bank, "GEN") == 0)) { pState->MCR = Value; pState->MCRknown = true; }
+  if ((pAccess->Address == RegSC16IS7XX_EFR) && (strcmp(bank, "ENH") == 0)) { pState->EFR = Value; pState->EFRknown = true; }
+  if ((pAccess->Address == RegSC16IS7XX_IOControl) && ((pAccess->Flags & SC16IS7XX_TRACE_READ) == 0) && ((Value & SC16IS7XX_IOCTRL_SOFTWARE_RESET) > 0))
+    memset(&Channels[0], 0, sizeof(Channels));                                            // A software reset puts all registers back to their default values
+}
+
+
+
+//=============================================================================
+// Account an access in the cost of its call site
+//=============================================================================
+static void CountCallSite(const TraceAccess* pAccess)
+{
+  CallSiteCost* pCost = NULL;
+  for (size_t z = 0; z < CallSiteCount; ++z)
+    if (CallSites[z].CallSite == pAccess->CallSite) { pCost = &CallSites[z]; break; }
+  if (pCost == NULL)
+  {
+    if (CallSiteCount >= CALL_SITE_MAX) return;
+    pCost = &CallSites[CallSiteCount++];
+    memset(pCost, 0, sizeof(CallSiteCost));
+    pCost->CallSite       = pAccess->CallSite;
+    pCost->FirstTimestamp = pAccess->Timestamp;
+  }
+  pCost->Transactions++;
+  pCost->PayloadBytes += pAccess->Size;
+  if ((pAccess->Address == RegSC16IS7XX_LCR) && ((pAccess->Flags & SC16IS7XX_TRACE_READ) == 0)) pCost->AccessChanges++;
+  pCost->LastTimestamp = pAccess->Timestamp;
+}
+
+
+
+//=============================================================================
+// Main
+//=============================================================================
+int main(int argc, char *argv[])
+{
+  if ((argc < 2) || (argc > 3))
+  {
+    fprintf(stderr, "Usage: %s <dump file> [data size]\n", argv[0]);
+    return 1;
+  }
+  size_t DataSize = SC16IS7XX_TRACE_DATA_SIZE;
+  if (argc == 3) DataSize = (size_t)strtoul(argv[2], NULL, 0);
+  if ((DataSize == 0) || (DataSize > TRACE_MAX_DATA))
+  {
+    fprintf(stderr, "Invalid data size %s\n", argv[2]);
+    return 1;
+  }
+  FILE* pFile = fopen(argv[1], "rb");
+  if (pFile == NULL)
+  {
+    fprintf(stderr, "Cannot open %s\n", argv[1]);
+    return 1;
+  }
+
+  //--- Decode each entry ---
+  const size_t EntrySize = TRACE_HEADER_SIZE + DataSize;
+  uint8_t Raw[TRACE_HEADER_SIZE + TRACE_MAX_DATA];
+  size_t EntryCount = 0;
+  printf("  Entry  Timestamp  Site  Ch  Dir  Bank  Register   Size  Data\n");
+  while (fread(&Raw[0], EntrySize, 1, pFile) == 1)
+  {
+    TraceAccess Access;
+    Access.Timestamp = (uint32_t)Raw[0] | ((uint32_t)Raw[1] << 8) | ((uint32_t)Raw[2] << 16) | ((uint32_t)Raw[3] << 24);
+    Access.CallSite  = (uint16_t)(Raw[4] | (Raw[5] << 8));
+    Access.Channel   = SC16IS7XX_CHANNEL_GET(Raw[6]);
+    Access.Address   = SC16IS7XX_ADDRESS_GET(Raw[6]);
+    Access.Flags     = Raw[7];
+    Access.LCR       = Raw[8];
+    Access.Size      = Raw[9];
+    Access.pData     = &Raw[TRACE_HEADER_SIZE];
+
+    const char* Bank;
+    const char* Name = GetRegisterName(&Access, &Bank);
+    printf("%7u  %9u  %4u  %c   %s    %s   %s  %4u ", (unsigned)EntryCount, (unsigned)Access.Timestamp, (unsigned)Access.CallSite, 'A' + Access.Channel,
+           ((Access.Flags & SC16IS7XX_TRACE_READ) > 0 ? "Rd" : "Wr"), Bank, Name, (unsigned)Access.Size);
+    const size_t Count = (Access.Size < DataSize ? Access.Size : DataSize);
+    for (size_t z = 0; z < Count; ++z) printf(" %02X", Access.pData[z]);
+    if (Access.Size > DataSize) printf(" ...");
+    if ((Access.Flags & SC16IS7XX_TRACE_NON_BLOCKING) > 0) printf(" (non-blocking)");
+    printf("\n");
+    UpdateChannelState(&Access, Bank);
+    CountCallSite(&Access);
+    EntryCount++;
+  }
+  fclose(pFile);
+
+  //--- Show the cost of each call site ---
+  printf("\n%u entries decoded\n\n", (unsigned)EntryCount);
+  printf("  Site  Transactions  Payload bytes  LCR writes  Duration (ms)\n");
+  for (size_t z = 0; z < CallSiteCount; ++z)
+  {
+    const CallSiteCost* pCost = &CallSites[z];
+    printf("  %4u  %12u  %13u  %10u  %13u\n", (unsigned)pCost->CallSite, (unsigned)pCost->Transactions, (unsigned)pCost->PayloadBytes,
+           (unsigned)pCost->AccessChanges, (unsigned)(pCost->LastTimestamp - pCost->FirstTimestamp));
+  }
+  return 0;
+}